@@ -0,0 +1,53 @@
+/* This example runs a continuous sound level meter on the microphone.
+ * Blocks from the background stream are fed to an Adafruit_CPlay_MicLevel,
+ * which keeps a running RMS ("fast" 125 ms meter) and a held peak, so
+ * levels are available at any time without capturing a new window.
+ *
+ * The NeoPixels show the RMS level in green with the held peak in red.
+ * open the serial plotter window in the arduino IDE to graph both.
+ */
+
+#include <Adafruit_CircuitPlayground.h>
+
+#define NUM_BLOCKS 4
+#define BLOCK_LEN  64
+
+#define INPUT_FLOOR    56 // Lower range of display in dB SPL
+#define INPUT_CEILING 110 // Upper range of display in dB SPL
+
+int16_t blocks[NUM_BLOCKS * BLOCK_LEN];
+Adafruit_CPlay_MicLevel level; // Board's sample rate and calibration
+
+void setup() {
+  CircuitPlayground.begin();
+  Serial.begin(115200);
+  // DC tracking, RMS, peak hold and peak decay times in ms
+  level.setTimeConstants(50, 125, 1000, 300);
+  CircuitPlayground.mic.startStream(blocks, NUM_BLOCKS, BLOCK_LEN);
+}
+
+void loop() {
+  const int16_t *block;
+  while((block = CircuitPlayground.mic.readBlock())) {
+    level.update(block, BLOCK_LEN);
+    CircuitPlayground.mic.releaseBlock();
+  }
+
+  static uint32_t lastShow = 0;
+  if(millis() - lastShow < 30) return;
+  lastShow = millis();
+
+  float rms  = level.rmsSPL(),
+        peak = level.peakSPL();
+  Serial.print(rms);
+  Serial.print(' ');
+  Serial.println(peak);
+
+  int lit  = constrain(map(rms,  INPUT_FLOOR, INPUT_CEILING, 0, 10), 0, 10),
+      dot  = constrain(map(peak, INPUT_FLOOR, INPUT_CEILING, 0, 9), 0, 9);
+  for(int i=0; i<10; i++) {
+    if(i == dot)     CircuitPlayground.setPixelColor(i, 40, 0, 0);
+    else if(i < lit) CircuitPlayground.setPixelColor(i, 0, 20, 0);
+    else             CircuitPlayground.setPixelColor(i, 0, 0, 0);
+  }
+}
@@ -0,0 +1,83 @@
+/* This example checks and times the PDM-to-PCM conversion used by
+ * mic.capture() on Circuit Playground Express.
+ *
+ * A buffer of pseudo-random PDM words is converted twice: once with the
+ * original bit-at-a-time sinc filter (64 tests per sample) and once with
+ * mic.decimate(), which applies the same filter a byte at a time from a
+ * lookup table.  The outputs must match exactly; the cycles per sample of
+ * each are printed.
+ *
+ * Circuit Playground Express (SAMD21) only.
+ */
+
+#include <Adafruit_CircuitPlayground.h>
+
+#if !defined(ARDUINO_ARCH_SAMD)
+#error "This example needs Circuit Playground Express"
+#endif
+
+#define DECIMATION 64
+#define NSAMPLES   256
+#define WORDS      (NSAMPLES * DECIMATION / 16)
+
+// Same filter as the library
+uint16_t sincfilter[DECIMATION] = {0, 2, 9, 21, 39, 63, 94, 132, 179, 236, 302, 379, 467, 565, 674, 792, 920, 1055, 1196, 1341, 1487, 1633, 1776, 1913, 2042, 2159, 2263, 2352, 2422, 
+                                  2474, 2506, 2516, 2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913, 1776, 1633, 1487, 1341, 1196, 1055, 920, 792, 674, 565, 467, 379, 302, 236, 179, 132, 94, 63, 39, 21, 9, 2, 0, 0};
+
+#define ADAPDM_REPEAT_LOOP_16(X) X X X X X X X X X X X X X X X X
+
+uint32_t pdmWords[WORDS];
+int16_t  bitwise[NSAMPLES], lookup[NSAMPLES];
+
+// The conversion capture() used before decimate()
+void decimateBitwise(const uint32_t *in, int16_t *out, uint16_t n) {
+  while(n--) {
+    uint16_t runningsum = 0;
+    uint16_t *sinc_ptr = sincfilter;
+    for (uint8_t samplenum=0; samplenum < (DECIMATION/16) ; samplenum++) {
+      uint16_t sample = *in++ & 0xFFFF;
+      ADAPDM_REPEAT_LOOP_16(
+        {
+          if (sample & 0x1) {
+            runningsum += *sinc_ptr;
+          }
+          sinc_ptr++;
+          sample >>= 1;
+        }
+      )
+    }
+    runningsum /= 64;
+    runningsum -= 512;
+    *out++ = runningsum;
+  }
+}
+
+void setup() {
+  CircuitPlayground.begin();
+  Serial.begin(115200);
+  while(!Serial);
+
+  randomSeed(1);
+  for(uint16_t i=0; i<WORDS; i++) pdmWords[i] = random(0x10000);
+
+  uint32_t t0 = micros();
+  decimateBitwise(pdmWords, bitwise, NSAMPLES);
+  uint32_t t1 = micros();
+  CircuitPlayground.mic.decimate(pdmWords, lookup, NSAMPLES);
+  uint32_t t2 = micros();
+
+  uint16_t errors = 0;
+  for(uint16_t i=0; i<NSAMPLES; i++) {
+    if(bitwise[i] != lookup[i]) errors++;
+  }
+
+  Serial.print("Mismatched samples: ");
+  Serial.println(errors);
+  Serial.print("Bitwise cycles/sample: ");
+  Serial.println((t1 - t0) * (F_CPU / 1000000) / NSAMPLES);
+  Serial.print("Lookup cycles/sample:  ");
+  Serial.println((t2 - t1) * (F_CPU / 1000000) / NSAMPLES);
+}
+
+void loop() {
+}
@@ -0,0 +1,42 @@
+/* This example captures the microphone continuously in the background
+ * and prints the sound pressure level of each block as it arrives,
+ * leaving loop() free for other work (here, a NeoPixel animation) instead
+ * of blocking for the whole sample window like soundPressureLevel(ms).
+ *
+ * open the serial plotter window in the arduino IDE for a nice graph
+ * of sound pressure level over time.
+ */
+
+#include <Adafruit_CircuitPlayground.h>
+
+#define NUM_BLOCKS 4   // Power of 2; up to NUM_BLOCKS-1 can wait
+#define BLOCK_LEN  256 // Samples per block (~12-27 ms depending on board)
+
+int16_t blocks[NUM_BLOCKS * BLOCK_LEN];
+
+void setup() {
+  CircuitPlayground.begin();
+  Serial.begin(115200);
+  if(!CircuitPlayground.mic.startStream(blocks, NUM_BLOCKS, BLOCK_LEN)) {
+    Serial.println("Streaming not supported on this board");
+    while(1);
+  }
+}
+
+void loop() {
+  const int16_t *block = CircuitPlayground.mic.readBlock();
+  if(block) {
+    Serial.println(CircuitPlayground.mic.soundPressureLevel(block, BLOCK_LEN));
+    CircuitPlayground.mic.releaseBlock();
+  }
+
+  // Meanwhile, keep the lights moving
+  static uint8_t pixel = 0;
+  static uint32_t lastStep = 0;
+  if(millis() - lastStep >= 50) {
+    lastStep = millis();
+    CircuitPlayground.clearPixels();
+    CircuitPlayground.setPixelColor(pixel, 0, 0, 40);
+    pixel = (pixel + 1) % 10;
+  }
+}
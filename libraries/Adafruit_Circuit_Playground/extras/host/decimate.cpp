@@ -0,0 +1,102 @@
+// Checks Adafruit_CPlay_Mic::decimate(), which applies the sinc filter a
+// byte at a time from sincLUT, against the bit at a time loop capture()
+// used before, written here as it was and using the library's own
+// sincfilter.  Random PDM words, with junk in the high 16 bits that both
+// must ignore, plus silence, full scale and single bits.  Then runs the
+// same words through capture(), reading them from a stand-in for the I2S
+// receiver.  Prints the number of mismatched samples and exits non-zero if
+// there were any.
+//
+// Usage: decimate [samples]
+#include <Adafruit_ZeroDMA.h>
+
+#include "../../utility/Adafruit_CPlay_Mic.h"
+
+#define DECIMATION 64
+#define WORDS (DECIMATION / 16) // per sample
+
+I2s hostI2S;
+Adafruit_ZeroDMA *hostDma = NULL;
+unsigned long millis(void) { return 0; }
+unsigned long micros(void) { return 0; }
+void delay(unsigned long) {}
+void yield(void) {}
+
+extern uint16_t sincfilter[DECIMATION];
+
+// what pdm.read() hands capture()
+static const uint32_t *pdmNext;
+
+Adafruit_ZeroPDM::Adafruit_ZeroPDM(int, int, uint8_t) {
+  _i2sserializer = I2S_SERIALIZER_0;
+}
+bool Adafruit_ZeroPDM::begin(void) { return true; }
+bool Adafruit_ZeroPDM::configure(uint32_t, boolean) { return true; }
+uint32_t Adafruit_ZeroPDM::read(void) { return *pdmNext++; }
+
+// the conversion capture() used before decimate()
+#define ADAPDM_REPEAT_LOOP_16(X) X X X X X X X X X X X X X X X X
+
+static void decimateBitwise(const uint32_t *in, int16_t *out, uint32_t n) {
+  while (n--) {
+    uint16_t runningsum = 0;
+    uint16_t *sinc_ptr = sincfilter;
+    for (uint8_t samplenum = 0; samplenum < (DECIMATION / 16); samplenum++) {
+      uint16_t sample = *in++ & 0xFFFF;
+      ADAPDM_REPEAT_LOOP_16({
+        if (sample & 0x1) {
+          runningsum += *sinc_ptr;
+        }
+        sinc_ptr++;
+        sample >>= 1;
+      })
+    }
+    runningsum /= 64;
+    runningsum -= 512;
+    *out++ = runningsum;
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t random = argc > 1 ? atol(argv[1]) : 100000;
+  uint32_t n = random + 2 + DECIMATION;
+  uint32_t *words = (uint32_t *)malloc(n * WORDS * sizeof(uint32_t));
+  int16_t *want = (int16_t *)malloc(n * sizeof(int16_t));
+  int16_t *got = (int16_t *)malloc(n * sizeof(int16_t));
+
+  srand(1);
+  uint32_t *w = words;
+  for (uint32_t i = 0; i < random * WORDS; i++)
+    *w++ = (uint32_t)rand() << 16 ^ rand();
+  for (int i = 0; i < WORDS; i++)
+    *w++ = 0; // silence
+  for (int i = 0; i < WORDS; i++)
+    *w++ = 0xFFFFFFFF; // full scale
+  for (int bit = 0; bit < DECIMATION; bit++)
+    for (int i = 0; i < WORDS; i++) // one tap at a time
+      *w++ = i == bit / 16 ? 1UL << bit % 16 : 0xFFFF0000;
+  decimateBitwise(words, want, n);
+
+  Adafruit_CPlay_Mic mic;
+  uint32_t bad = 0;
+  // both take at most 65535 samples a call
+  for (uint32_t i = 0; i < n; i += 50000)
+    mic.decimate(words + i * WORDS, got + i, n - i < 50000 ? n - i : 50000);
+  for (uint32_t i = 0; i < n; i++)
+    if (got[i] != want[i] && bad++ < 20)
+      printf("decimate() sample %u is %d, not %d\n", i, got[i], want[i]);
+
+  memset(got, 0, n * sizeof(int16_t));
+  pdmNext = words;
+  for (uint32_t i = 0; i < n; i += 50000)
+    mic.capture(got + i, n - i < 50000 ? n - i : 50000);
+  for (uint32_t i = 0; i < n; i++)
+    if (got[i] != want[i] && bad++ < 20)
+      printf("capture() sample %u is %d, not %d\n", i, got[i], want[i]);
+
+  printf("%u samples, %u bad\n", n, bad);
+  free(words);
+  free(want);
+  free(got);
+  return bad != 0;
+}
@@ -0,0 +1,131 @@
+// Checks Adafruit_CPlay_MicLevel against the same meter in double
+// precision: exponential DC removal, exponential mean of squares and a
+// held, then decaying, peak, with the time constants rounded to the same
+// powers of two.  The meter keeps the sample less DC to 1/16 count, and
+// a peak within that of the held one restarts the hold or not depending
+// on the rounding, so the peak is checked between two references that
+// restart the hold 1/16 count either side of the held peak.
+//
+// Tones from 60 Hz to 4 kHz and 2 to 1000 counts, on DC offsets either
+// side of zero, are fed in blocks of random length, then cut to silence so
+// the hold and decay are followed too.  RMS and peak levels are compared
+// after every block once the DC has settled.
+//
+// Prints the worst differences and the number of failures, and exits
+// non-zero if there were any.
+//
+// Usage: miclevel
+#include "../../utility/Adafruit_CPlay_MicLevel.h"
+
+#include <Arduino.h>
+
+#define RMS_TOLERANCE 0.1   // dB
+#define PEAK_TOLERANCE 0.25 // dB
+#define FLOOR 52.0          // dB, what both give for no signal
+
+static int bad = 0;
+
+// samples for a time constant, rounded to a power of 2 as the meter does
+static double shiftFor(double ms, double rate) {
+  double n = ms * rate / 1000, s = 0;
+  while (s < 15 && n * 181 / 128 >= 2 * pow(2, s))
+    s++;
+  return s;
+}
+
+/** The meter in double precision */
+struct Reference {
+  Reference(double rate, double gain, double dcMs, double rmsMs,
+            double holdMs, double decayMs, double slack = 0)
+      : slack(slack), offset(20 * log10(gain / (1023 * 0.00002))),
+        dcK(pow(2, -shiftFor(dcMs, rate))),
+        rmsK(pow(2, -shiftFor(rmsMs, rate))),
+        decayK(pow(2, -shiftFor(decayMs, rate))),
+        holdSamples(floor(holdMs * rate / 1000)) {}
+
+  void update(const int16_t *x, int n) {
+    while (n--) {
+      dc += (*x - dc) * dcK;
+      double v = *x++ - dc;
+      ms += (v * v - ms) * rmsK;
+      if (fabs(v) + slack >= peak) {
+        peak = fmax(peak, fabs(v));
+        hold = holdSamples;
+      } else if (hold) {
+        hold--;
+      } else {
+        peak -= peak * decayK;
+      }
+    }
+  }
+  double rmsSPL(void) const {
+    return ms > 0 ? 10 * log10(ms) + offset : FLOOR;
+  }
+  double peakSPL(void) const {
+    return peak > 0 ? 20 * log10(peak) + offset : FLOOR;
+  }
+
+  double slack, offset, dcK, rmsK, decayK, holdSamples;
+  double dc = 0, ms = 0, peak = 0, hold = 0;
+};
+
+static double worstRms = 0, worstPeak = 0;
+
+static void run(double rate, double gain, double hz, double amp, int dc) {
+  Adafruit_CPlay_MicLevel meter(rate, gain);
+  Reference ref(rate, gain, 50, 125, 500, 250),
+      lo(rate, gain, 50, 125, 500, 250, -1 / 16.0),
+      hi(rate, gain, 50, 125, 500, 250, 1 / 16.0);
+  // 2 s of tone then 1.5 s of silence, both on the same DC
+  long tone = 2 * rate, total = 3.5 * rate, settle = 0.4 * rate;
+  int16_t block[300];
+  for (long t = 0; t < total;) {
+    int n = 1 + rand() % 300;
+    if (n > total - t)
+      n = total - t;
+    for (int i = 0; i < n; i++, t++)
+      block[i] = lround(dc + (t < tone ? amp * sin(2 * M_PI * hz * t / rate)
+                                       : 0));
+    meter.update(block, n);
+    ref.update(block, n);
+    lo.update(block, n);
+    hi.update(block, n);
+    if (t < settle)
+      continue;
+    // a level at the floor stands for any signal below it, so only
+    // compare where the reference is clear of the floor
+    double r = ref.rmsSPL(), p = meter.peakSPL();
+    double dr = fabs(meter.rmsSPL() - r);
+    double dp = fmax(fmax(lo.peakSPL() - p, p - hi.peakSPL()), 0);
+    if (r > FLOOR + 3 && dr > worstRms)
+      worstRms = dr;
+    if (lo.peakSPL() > FLOOR + 3 && dp > worstPeak)
+      worstPeak = dp;
+    if ((r > FLOOR + 3 && dr > RMS_TOLERANCE) ||
+        (lo.peakSPL() > FLOOR + 3 && dp > PEAK_TOLERANCE)) {
+      if (bad++ < 20)
+        printf("%g Hz, %g counts on %d, %.2f s: rms %.2f (%.2f), peak %.2f "
+               "(%.2f to %.2f)\n",
+               hz, amp, dc, t / rate, meter.rmsSPL(), r, p, lo.peakSPL(),
+               hi.peakSPL());
+      return;
+    }
+  }
+}
+
+int main(void) {
+  static const double hz[] = {60, 100, 440, 1000, 4000};
+  static const double amp[] = {2, 3, 10, 50, 200, 1000};
+  static const int dc[] = {0, -40, 120};
+  srand(1);
+  for (double h : hz)
+    for (double a : amp)
+      for (int d : dc) {
+        run(22000, 9, h, a, d);  // SAMD
+        run(9615, 1.3, h, a, d); // AVR
+      }
+  printf("worst difference: rms %.3f dB, peak %.3f dB\n", worstRms,
+         worstPeak);
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
@@ -0,0 +1,191 @@
+// Checks Adafruit_CPlay_MicRing, the block ring between the microphone
+// interrupt and the sketch.  begin() must refuse bad sizes; an empty ring
+// gives no block; a full one drops what the producer commits and counts
+// it.  Then random runs of commits and releases, for every ring size, long
+// enough for the free-running indexes to wrap many times, against a model
+// queue: blocks must come out in order, the producer must never be handed
+// the block the consumer holds, and the drop count must match.
+//
+// Last, streams through startStream() with a simulated DMA channel filling
+// the two halves of the raw buffer, and checks each block read is
+// decimate() of the words DMA delivered for it, with overruns() counting
+// the blocks dropped while the sketch held on to its block.
+//
+// Prints the number of failures and exits non-zero if there were any.
+//
+// Usage: micring
+#include <Adafruit_ZeroDMA.h>
+
+#include <deque>
+#include <vector>
+
+#include "../../utility/Adafruit_CPlay_Mic.h"
+
+I2s hostI2S;
+Adafruit_ZeroDMA *hostDma = NULL;
+unsigned long millis(void) { return 0; }
+unsigned long micros(void) { return 0; }
+void delay(unsigned long) {}
+void yield(void) {}
+
+Adafruit_ZeroPDM::Adafruit_ZeroPDM(int, int, uint8_t) {
+  _i2sserializer = I2S_SERIALIZER_0;
+}
+bool Adafruit_ZeroPDM::begin(void) { return true; }
+bool Adafruit_ZeroPDM::configure(uint32_t, boolean) { return true; }
+uint32_t Adafruit_ZeroPDM::read(void) { return 0; }
+
+static int bad = 0;
+
+static void fail(const char *what, long i) {
+  if (bad++ < 20)
+    printf("%s (%ld)\n", what, i);
+}
+
+#define LEN 16
+
+static int16_t storage[128 * LEN];
+
+static void sizes(void) {
+  Adafruit_CPlay_MicRing ring;
+  static const uint8_t wrong[] = {0, 1, 3, 6, 129, 255};
+  for (uint8_t n : wrong)
+    if (ring.begin(storage, n, LEN))
+      fail("begin() took a bad block count", n);
+  if (ring.begin(storage, 4, 0) || ring.begin(NULL, 4, LEN))
+    fail("begin() took no storage", 0);
+  for (int n = 2; n <= 128; n *= 2)
+    if (!ring.begin(storage, n, LEN))
+      fail("begin() refused a good block count", n);
+}
+
+static void emptyAndFull(void) {
+  Adafruit_CPlay_MicRing ring;
+  ring.begin(storage, 4, LEN);
+  if (ring.readBlock() || ring.available())
+    fail("block from an empty ring", 0);
+  ring.release(); // nothing to release, must not move the ring
+  if (ring.readBlock() || ring.available())
+    fail("release() on an empty ring queued a block", 0);
+
+  for (int i = 0; i < 3; i++)
+    if (!ring.commit())
+      fail("commit() to a ring with room failed", i);
+  if (ring.available() != 3)
+    fail("three blocks committed but not queued", ring.available());
+  int16_t *w = ring.writeBlock();
+  if (ring.commit() || ring.overruns() != 1)
+    fail("commit() to a full ring not dropped", ring.overruns());
+  if (ring.writeBlock() != w)
+    fail("dropped block not refilled in place", 0);
+  ring.release();
+  if (!ring.commit() || ring.available() != 3)
+    fail("commit() after a release failed", 0);
+}
+
+// random commits and releases against a model queue of block numbers
+static void churn(uint8_t n, long steps) {
+  Adafruit_CPlay_MicRing ring;
+  ring.begin(storage, n, LEN);
+  std::deque<int16_t> queued;
+  int16_t stamp = 0;
+  long dropped = 0;
+  const int16_t *held = NULL; // block the consumer has from readBlock()
+  // lean towards the producer or the consumer for a while at a time
+  int bias = 50;
+  for (long i = 0; i < steps; i++) {
+    if (i % 1000 == 0)
+      bias = 10 + rand() % 80;
+    if (rand() % 100 < bias) {
+      int16_t *w = ring.writeBlock();
+      if (held && w == held)
+        fail("producer given the block the consumer holds", i);
+      for (int k = 0; k < LEN; k++)
+        w[k] = stamp;
+      if (queued.size() + 1 < n) {
+        queued.push_back(stamp);
+        if (!ring.commit())
+          fail("commit() failed with room", i);
+      } else {
+        dropped++;
+        if (ring.commit())
+          fail("commit() to a full ring queued it", i);
+      }
+      stamp++;
+    } else {
+      const int16_t *r = ring.readBlock();
+      if (!r != queued.empty()) {
+        fail("readBlock() and the model disagree", i);
+        return;
+      }
+      if (!r)
+        continue;
+      if (r[0] != queued.front() || r[LEN - 1] != queued.front())
+        fail("block out of order or overwritten", i);
+      if (rand() % 2) { // sometimes hold it over the next steps
+        held = r;
+        continue;
+      }
+      ring.release();
+      queued.pop_front();
+      held = NULL;
+    }
+    if (ring.available() != queued.size())
+      fail("available() differs from the model", i);
+  }
+  if (ring.overruns() != (uint16_t)dropped)
+    fail("overruns() differs from the drops", n);
+}
+
+static void stream(void) {
+  const uint16_t blockLen = 64, words = blockLen * 4;
+  static int16_t blocks[4 * blockLen];
+  static uint32_t raw[words];
+  std::deque<std::vector<int16_t>> want;
+  Adafruit_CPlay_Mic mic;
+  long drops = 0;
+
+  if (!mic.startStream(blocks, 4, blockLen) || !hostDma)
+    fail("startStream() failed", 0);
+  if (hostDma->blockWords() != words)
+    fail("DMA block not four words a sample", hostDma->blockWords());
+  for (int i = 0; i < 2000; i++) {
+    if (rand() % 3) {
+      for (uint16_t k = 0; k < words; k++)
+        raw[k] = (uint32_t)rand() << 16 ^ rand();
+      std::vector<int16_t> pcm(blockLen);
+      Adafruit_CPlay_Mic::decimate(raw, pcm.data(), blockLen);
+      if (want.size() < 3)
+        want.push_back(pcm);
+      else
+        drops++;
+      hostDma->hostDmaBlock(raw);
+    } else if (const int16_t *b = mic.readBlock()) {
+      if (want.empty() || memcmp(b, want.front().data(), blockLen * 2))
+        fail("streamed block is not decimate() of its words", i);
+      if (rand() % 4) {
+        mic.releaseBlock();
+        if (!want.empty())
+          want.pop_front();
+      }
+    } else if (!want.empty()) {
+      fail("no block with one queued", i);
+    }
+  }
+  if (mic.overruns() != drops)
+    fail("overruns() differs from the blocks dropped", mic.overruns());
+  mic.stopStream();
+  if (hostDma)
+    fail("stopStream() left DMA running", 0);
+}
+
+int main(void) {
+  srand(1);
+  sizes();
+  emptyAndFull();
+  for (int n = 2; n <= 128; n *= 2)
+    churn(n, 200000);
+  stream();
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
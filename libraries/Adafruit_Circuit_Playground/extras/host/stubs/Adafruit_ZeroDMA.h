@@ -0,0 +1,78 @@
+// Adafruit_ZeroDMA with a simulated engine behind it.  addDescriptor()
+// keeps where each descriptor writes and how many words, startJob() makes
+// the channel the one hostDmaBlock() fills, and hostDmaBlock() completes
+// the next block of a looped chain with words from the test and calls the
+// callback, as the block interrupt would.
+#ifndef _ADAFRUIT_ZERODMA_H_
+#define _ADAFRUIT_ZERODMA_H_
+#include "Arduino.h"
+
+typedef struct {
+  union {
+    struct {
+      uint16_t VALID : 1;
+      uint16_t EVOSEL : 2;
+      uint16_t BLOCKACT : 2;
+    } bit;
+    uint16_t reg;
+  } BTCTRL;
+} DmacDescriptor;
+
+typedef enum { DMA_STATUS_OK = 0, DMA_STATUS_ERR_NOT_FOUND } ZeroDMAstatus;
+#define DMA_BEAT_SIZE_WORD 2
+#define DMA_TRIGGER_ACTON_BEAT 2
+#define DMA_BLOCK_ACTION_INT 1
+#define DMA_MAX_DESC 4
+
+class Adafruit_ZeroDMA;
+extern Adafruit_ZeroDMA *hostDma; // the channel started last
+
+class Adafruit_ZeroDMA {
+public:
+  ZeroDMAstatus allocate(void) { return DMA_STATUS_OK; }
+  void setTrigger(int) {}
+  void setAction(int) {}
+  void loop(bool) {}
+  void setCallback(void (*cb)(Adafruit_ZeroDMA *)) { callback = cb; }
+  DmacDescriptor *addDescriptor(void *, void *dst, uint32_t count, int, bool,
+                                bool) {
+    if (descs == DMA_MAX_DESC)
+      return NULL;
+    changeDescriptor(&desc[descs], NULL, dst, count);
+    return &desc[descs++];
+  }
+  void changeDescriptor(DmacDescriptor *d, void *, void *dst,
+                        uint32_t count) {
+    block[d - desc].dst = (uint32_t *)dst;
+    block[d - desc].count = count;
+  }
+  ZeroDMAstatus startJob(void) {
+    next = 0;
+    hostDma = this;
+    return DMA_STATUS_OK;
+  }
+  void abort(void) {
+    if (hostDma == this)
+      hostDma = NULL;
+  }
+  /// Fills the next block from words, which must hold a block's worth,
+  /// then calls the callback
+  void hostDmaBlock(const uint32_t *words) {
+    memcpy(block[next].dst, words, block[next].count * sizeof(uint32_t));
+    next = (next + 1) % descs;
+    if (callback)
+      callback(this);
+  }
+  /// Words in the block hostDmaBlock() fills next
+  uint32_t blockWords(void) const { return block[next].count; }
+
+private:
+  DmacDescriptor desc[DMA_MAX_DESC];
+  struct {
+    uint32_t *dst;
+    uint32_t count;
+  } block[DMA_MAX_DESC];
+  uint8_t descs = 0, next = 0;
+  void (*callback)(Adafruit_ZeroDMA *) = NULL;
+};
+#endif // _ADAFRUIT_ZERODMA_H_
@@ -0,0 +1,37 @@
+// Just enough of the Arduino core and SAMD21 headers to build the Circuit
+// Playground microphone code on a PC
+#ifndef Arduino_h
+#define Arduino_h
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+typedef bool boolean;
+typedef uint8_t byte;
+
+static inline long map(long x, long inMin, long inMax, long outMin,
+                       long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void yield(void);
+
+// The I2S receive data registers, read by the microphone DMA
+typedef struct {
+  volatile uint32_t DATA[2];
+} I2s;
+extern I2s hostI2S;
+#define I2S (&hostI2S)
+#define I2S_DMAC_ID_RX_0 0x29
+#define I2S_DMAC_ID_RX_1 0x2A
+#endif // Arduino_h
@@ -0,0 +1 @@
+// Nothing from here is used by the microphone code
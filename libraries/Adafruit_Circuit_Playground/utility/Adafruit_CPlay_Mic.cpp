@@ -17,8 +17,186 @@ Adafruit_ZeroPDM Adafruit_CPlay_Mic::pdm = Adafruit_ZeroPDM(34, 35);
 uint16_t sincfilter[DECIMATION] = {0, 2, 9, 21, 39, 63, 94, 132, 179, 236, 302, 379, 467, 565, 674, 792, 920, 1055, 1196, 1341, 1487, 1633, 1776, 1913, 2042, 2159, 2263, 2352, 2422, 
                                   2474, 2506, 2516, 2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913, 1776, 1633, 1487, 1341, 1196, 1055, 920, 792, 674, 565, 467, 379, 302, 236, 179, 132, 94, 63, 39, 21, 9, 2, 0, 0};
 
-// a manual loop-unroller!
-#define ADAPDM_REPEAT_LOOP_16(X) X X X X X X X X X X X X X X X X
+// Byte-at-a-time form of sincfilter: sincLUT[p][b] is the sum of
+// sincfilter[8 * p + i] for every bit i set in b (LSB = earliest bit).
+// Generated from sincfilter above; regenerate if the filter changes.
+static const uint16_t sincLUT[DECIMATION / 8][256] = {
+    {0, 0, 2, 2, 9, 9, 11, 11, 21, 21, 23, 23,
+     30, 30, 32, 32, 39, 39, 41, 41, 48, 48, 50, 50,
+     60, 60, 62, 62, 69, 69, 71, 71, 63, 63, 65, 65,
+     72, 72, 74, 74, 84, 84, 86, 86, 93, 93, 95, 95,
+     102, 102, 104, 104, 111, 111, 113, 113, 123, 123, 125, 125,
+     132, 132, 134, 134, 94, 94, 96, 96, 103, 103, 105, 105,
+     115, 115, 117, 117, 124, 124, 126, 126, 133, 133, 135, 135,
+     142, 142, 144, 144, 154, 154, 156, 156, 163, 163, 165, 165,
+     157, 157, 159, 159, 166, 166, 168, 168, 178, 178, 180, 180,
+     187, 187, 189, 189, 196, 196, 198, 198, 205, 205, 207, 207,
+     217, 217, 219, 219, 226, 226, 228, 228, 132, 132, 134, 134,
+     141, 141, 143, 143, 153, 153, 155, 155, 162, 162, 164, 164,
+     171, 171, 173, 173, 180, 180, 182, 182, 192, 192, 194, 194,
+     201, 201, 203, 203, 195, 195, 197, 197, 204, 204, 206, 206,
+     216, 216, 218, 218, 225, 225, 227, 227, 234, 234, 236, 236,
+     243, 243, 245, 245, 255, 255, 257, 257, 264, 264, 266, 266,
+     226, 226, 228, 228, 235, 235, 237, 237, 247, 247, 249, 249,
+     256, 256, 258, 258, 265, 265, 267, 267, 274, 274, 276, 276,
+     286, 286, 288, 288, 295, 295, 297, 297, 289, 289, 291, 291,
+     298, 298, 300, 300, 310, 310, 312, 312, 319, 319, 321, 321,
+     328, 328, 330, 330, 337, 337, 339, 339, 349, 349, 351, 351,
+     358, 358, 360, 360},
+    {0, 179, 236, 415, 302, 481, 538, 717, 379, 558, 615, 794,
+     681, 860, 917, 1096, 467, 646, 703, 882, 769, 948, 1005, 1184,
+     846, 1025, 1082, 1261, 1148, 1327, 1384, 1563, 565, 744, 801, 980,
+     867, 1046, 1103, 1282, 944, 1123, 1180, 1359, 1246, 1425, 1482, 1661,
+     1032, 1211, 1268, 1447, 1334, 1513, 1570, 1749, 1411, 1590, 1647, 1826,
+     1713, 1892, 1949, 2128, 674, 853, 910, 1089, 976, 1155, 1212, 1391,
+     1053, 1232, 1289, 1468, 1355, 1534, 1591, 1770, 1141, 1320, 1377, 1556,
+     1443, 1622, 1679, 1858, 1520, 1699, 1756, 1935, 1822, 2001, 2058, 2237,
+     1239, 1418, 1475, 1654, 1541, 1720, 1777, 1956, 1618, 1797, 1854, 2033,
+     1920, 2099, 2156, 2335, 1706, 1885, 1942, 2121, 2008, 2187, 2244, 2423,
+     2085, 2264, 2321, 2500, 2387, 2566, 2623, 2802, 792, 971, 1028, 1207,
+     1094, 1273, 1330, 1509, 1171, 1350, 1407, 1586, 1473, 1652, 1709, 1888,
+     1259, 1438, 1495, 1674, 1561, 1740, 1797, 1976, 1638, 1817, 1874, 2053,
+     1940, 2119, 2176, 2355, 1357, 1536, 1593, 1772, 1659, 1838, 1895, 2074,
+     1736, 1915, 1972, 2151, 2038, 2217, 2274, 2453, 1824, 2003, 2060, 2239,
+     2126, 2305, 2362, 2541, 2203, 2382, 2439, 2618, 2505, 2684, 2741, 2920,
+     1466, 1645, 1702, 1881, 1768, 1947, 2004, 2183, 1845, 2024, 2081, 2260,
+     2147, 2326, 2383, 2562, 1933, 2112, 2169, 2348, 2235, 2414, 2471, 2650,
+     2312, 2491, 2548, 2727, 2614, 2793, 2850, 3029, 2031, 2210, 2267, 2446,
+     2333, 2512, 2569, 2748, 2410, 2589, 2646, 2825, 2712, 2891, 2948, 3127,
+     2498, 2677, 2734, 2913, 2800, 2979, 3036, 3215, 2877, 3056, 3113, 3292,
+     3179, 3358, 3415, 3594},
+    {0, 920, 1055, 1975, 1196, 2116, 2251, 3171, 1341, 2261, 2396, 3316,
+     2537, 3457, 3592, 4512, 1487, 2407, 2542, 3462, 2683, 3603, 3738, 4658,
+     2828, 3748, 3883, 4803, 4024, 4944, 5079, 5999, 1633, 2553, 2688, 3608,
+     2829, 3749, 3884, 4804, 2974, 3894, 4029, 4949, 4170, 5090, 5225, 6145,
+     3120, 4040, 4175, 5095, 4316, 5236, 5371, 6291, 4461, 5381, 5516, 6436,
+     5657, 6577, 6712, 7632, 1776, 2696, 2831, 3751, 2972, 3892, 4027, 4947,
+     3117, 4037, 4172, 5092, 4313, 5233, 5368, 6288, 3263, 4183, 4318, 5238,
+     4459, 5379, 5514, 6434, 4604, 5524, 5659, 6579, 5800, 6720, 6855, 7775,
+     3409, 4329, 4464, 5384, 4605, 5525, 5660, 6580, 4750, 5670, 5805, 6725,
+     5946, 6866, 7001, 7921, 4896, 5816, 5951, 6871, 6092, 7012, 7147, 8067,
+     6237, 7157, 7292, 8212, 7433, 8353, 8488, 9408, 1913, 2833, 2968, 3888,
+     3109, 4029, 4164, 5084, 3254, 4174, 4309, 5229, 4450, 5370, 5505, 6425,
+     3400, 4320, 4455, 5375, 4596, 5516, 5651, 6571, 4741, 5661, 5796, 6716,
+     5937, 6857, 6992, 7912, 3546, 4466, 4601, 5521, 4742, 5662, 5797, 6717,
+     4887, 5807, 5942, 6862, 6083, 7003, 7138, 8058, 5033, 5953, 6088, 7008,
+     6229, 7149, 7284, 8204, 6374, 7294, 7429, 8349, 7570, 8490, 8625, 9545,
+     3689, 4609, 4744, 5664, 4885, 5805, 5940, 6860, 5030, 5950, 6085, 7005,
+     6226, 7146, 7281, 8201, 5176, 6096, 6231, 7151, 6372, 7292, 7427, 8347,
+     6517, 7437, 7572, 8492, 7713, 8633, 8768, 9688, 5322, 6242, 6377, 7297,
+     6518, 7438, 7573, 8493, 6663, 7583, 7718, 8638, 7859, 8779, 8914, 9834,
+     6809, 7729, 7864, 8784, 8005, 8925, 9060, 9980, 8150, 9070, 9205, 10125,
+     9346, 10266, 10401, 11321},
+    {0, 2042, 2159, 4201, 2263, 4305, 4422, 6464, 2352, 4394, 4511, 6553,
+     4615, 6657, 6774, 8816, 2422, 4464, 4581, 6623, 4685, 6727, 6844, 8886,
+     4774, 6816, 6933, 8975, 7037, 9079, 9196, 11238, 2474, 4516, 4633, 6675,
+     4737, 6779, 6896, 8938, 4826, 6868, 6985, 9027, 7089, 9131, 9248, 11290,
+     4896, 6938, 7055, 9097, 7159, 9201, 9318, 11360, 7248, 9290, 9407, 11449,
+     9511, 11553, 11670, 13712, 2506, 4548, 4665, 6707, 4769, 6811, 6928, 8970,
+     4858, 6900, 7017, 9059, 7121, 9163, 9280, 11322, 4928, 6970, 7087, 9129,
+     7191, 9233, 9350, 11392, 7280, 9322, 9439, 11481, 9543, 11585, 11702, 13744,
+     4980, 7022, 7139, 9181, 7243, 9285, 9402, 11444, 7332, 9374, 9491, 11533,
+     9595, 11637, 11754, 13796, 7402, 9444, 9561, 11603, 9665, 11707, 11824, 13866,
+     9754, 11796, 11913, 13955, 12017, 14059, 14176, 16218, 2516, 4558, 4675, 6717,
+     4779, 6821, 6938, 8980, 4868, 6910, 7027, 9069, 7131, 9173, 9290, 11332,
+     4938, 6980, 7097, 9139, 7201, 9243, 9360, 11402, 7290, 9332, 9449, 11491,
+     9553, 11595, 11712, 13754, 4990, 7032, 7149, 9191, 7253, 9295, 9412, 11454,
+     7342, 9384, 9501, 11543, 9605, 11647, 11764, 13806, 7412, 9454, 9571, 11613,
+     9675, 11717, 11834, 13876, 9764, 11806, 11923, 13965, 12027, 14069, 14186, 16228,
+     5022, 7064, 7181, 9223, 7285, 9327, 9444, 11486, 7374, 9416, 9533, 11575,
+     9637, 11679, 11796, 13838, 7444, 9486, 9603, 11645, 9707, 11749, 11866, 13908,
+     9796, 11838, 11955, 13997, 12059, 14101, 14218, 16260, 7496, 9538, 9655, 11697,
+     9759, 11801, 11918, 13960, 9848, 11890, 12007, 14049, 12111, 14153, 14270, 16312,
+     9918, 11960, 12077, 14119, 12181, 14223, 14340, 16382, 12270, 14312, 14429, 16471,
+     14533, 16575, 16692, 18734},
+    {0, 2506, 2474, 4980, 2422, 4928, 4896, 7402, 2352, 4858, 4826, 7332,
+     4774, 7280, 7248, 9754, 2263, 4769, 4737, 7243, 4685, 7191, 7159, 9665,
+     4615, 7121, 7089, 9595, 7037, 9543, 9511, 12017, 2159, 4665, 4633, 7139,
+     4581, 7087, 7055, 9561, 4511, 7017, 6985, 9491, 6933, 9439, 9407, 11913,
+     4422, 6928, 6896, 9402, 6844, 9350, 9318, 11824, 6774, 9280, 9248, 11754,
+     9196, 11702, 11670, 14176, 2042, 4548, 4516, 7022, 4464, 6970, 6938, 9444,
+     4394, 6900, 6868, 9374, 6816, 9322, 9290, 11796, 4305, 6811, 6779, 9285,
+     6727, 9233, 9201, 11707, 6657, 9163, 9131, 11637, 9079, 11585, 11553, 14059,
+     4201, 6707, 6675, 9181, 6623, 9129, 9097, 11603, 6553, 9059, 9027, 11533,
+     8975, 11481, 11449, 13955, 6464, 8970, 8938, 11444, 8886, 11392, 11360, 13866,
+     8816, 11322, 11290, 13796, 11238, 13744, 13712, 16218, 1913, 4419, 4387, 6893,
+     4335, 6841, 6809, 9315, 4265, 6771, 6739, 9245, 6687, 9193, 9161, 11667,
+     4176, 6682, 6650, 9156, 6598, 9104, 9072, 11578, 6528, 9034, 9002, 11508,
+     8950, 11456, 11424, 13930, 4072, 6578, 6546, 9052, 6494, 9000, 8968, 11474,
+     6424, 8930, 8898, 11404, 8846, 11352, 11320, 13826, 6335, 8841, 8809, 11315,
+     8757, 11263, 11231, 13737, 8687, 11193, 11161, 13667, 11109, 13615, 13583, 16089,
+     3955, 6461, 6429, 8935, 6377, 8883, 8851, 11357, 6307, 8813, 8781, 11287,
+     8729, 11235, 11203, 13709, 6218, 8724, 8692, 11198, 8640, 11146, 11114, 13620,
+     8570, 11076, 11044, 13550, 10992, 13498, 13466, 15972, 6114, 8620, 8588, 11094,
+     8536, 11042, 11010, 13516, 8466, 10972, 10940, 13446, 10888, 13394, 13362, 15868,
+     8377, 10883, 10851, 13357, 10799, 13305, 13273, 15779, 10729, 13235, 13203, 15709,
+     13151, 15657, 15625, 18131},
+    {0, 1776, 1633, 3409, 1487, 3263, 3120, 4896, 1341, 3117, 2974, 4750,
+     2828, 4604, 4461, 6237, 1196, 2972, 2829, 4605, 2683, 4459, 4316, 6092,
+     2537, 4313, 4170, 5946, 4024, 5800, 5657, 7433, 1055, 2831, 2688, 4464,
+     2542, 4318, 4175, 5951, 2396, 4172, 4029, 5805, 3883, 5659, 5516, 7292,
+     2251, 4027, 3884, 5660, 3738, 5514, 5371, 7147, 3592, 5368, 5225, 7001,
+     5079, 6855, 6712, 8488, 920, 2696, 2553, 4329, 2407, 4183, 4040, 5816,
+     2261, 4037, 3894, 5670, 3748, 5524, 5381, 7157, 2116, 3892, 3749, 5525,
+     3603, 5379, 5236, 7012, 3457, 5233, 5090, 6866, 4944, 6720, 6577, 8353,
+     1975, 3751, 3608, 5384, 3462, 5238, 5095, 6871, 3316, 5092, 4949, 6725,
+     4803, 6579, 6436, 8212, 3171, 4947, 4804, 6580, 4658, 6434, 6291, 8067,
+     4512, 6288, 6145, 7921, 5999, 7775, 7632, 9408, 792, 2568, 2425, 4201,
+     2279, 4055, 3912, 5688, 2133, 3909, 3766, 5542, 3620, 5396, 5253, 7029,
+     1988, 3764, 3621, 5397, 3475, 5251, 5108, 6884, 3329, 5105, 4962, 6738,
+     4816, 6592, 6449, 8225, 1847, 3623, 3480, 5256, 3334, 5110, 4967, 6743,
+     3188, 4964, 4821, 6597, 4675, 6451, 6308, 8084, 3043, 4819, 4676, 6452,
+     4530, 6306, 6163, 7939, 4384, 6160, 6017, 7793, 5871, 7647, 7504, 9280,
+     1712, 3488, 3345, 5121, 3199, 4975, 4832, 6608, 3053, 4829, 4686, 6462,
+     4540, 6316, 6173, 7949, 2908, 4684, 4541, 6317, 4395, 6171, 6028, 7804,
+     4249, 6025, 5882, 7658, 5736, 7512, 7369, 9145, 2767, 4543, 4400, 6176,
+     4254, 6030, 5887, 7663, 4108, 5884, 5741, 7517, 5595, 7371, 7228, 9004,
+     3963, 5739, 5596, 7372, 5450, 7226, 7083, 8859, 5304, 7080, 6937, 8713,
+     6791, 8567, 8424, 10200},
+    {0, 674, 565, 1239, 467, 1141, 1032, 1706, 379, 1053, 944, 1618,
+     846, 1520, 1411, 2085, 302, 976, 867, 1541, 769, 1443, 1334, 2008,
+     681, 1355, 1246, 1920, 1148, 1822, 1713, 2387, 236, 910, 801, 1475,
+     703, 1377, 1268, 1942, 615, 1289, 1180, 1854, 1082, 1756, 1647, 2321,
+     538, 1212, 1103, 1777, 1005, 1679, 1570, 2244, 917, 1591, 1482, 2156,
+     1384, 2058, 1949, 2623, 179, 853, 744, 1418, 646, 1320, 1211, 1885,
+     558, 1232, 1123, 1797, 1025, 1699, 1590, 2264, 481, 1155, 1046, 1720,
+     948, 1622, 1513, 2187, 860, 1534, 1425, 2099, 1327, 2001, 1892, 2566,
+     415, 1089, 980, 1654, 882, 1556, 1447, 2121, 794, 1468, 1359, 2033,
+     1261, 1935, 1826, 2500, 717, 1391, 1282, 1956, 1184, 1858, 1749, 2423,
+     1096, 1770, 1661, 2335, 1563, 2237, 2128, 2802, 132, 806, 697, 1371,
+     599, 1273, 1164, 1838, 511, 1185, 1076, 1750, 978, 1652, 1543, 2217,
+     434, 1108, 999, 1673, 901, 1575, 1466, 2140, 813, 1487, 1378, 2052,
+     1280, 1954, 1845, 2519, 368, 1042, 933, 1607, 835, 1509, 1400, 2074,
+     747, 1421, 1312, 1986, 1214, 1888, 1779, 2453, 670, 1344, 1235, 1909,
+     1137, 1811, 1702, 2376, 1049, 1723, 1614, 2288, 1516, 2190, 2081, 2755,
+     311, 985, 876, 1550, 778, 1452, 1343, 2017, 690, 1364, 1255, 1929,
+     1157, 1831, 1722, 2396, 613, 1287, 1178, 1852, 1080, 1754, 1645, 2319,
+     992, 1666, 1557, 2231, 1459, 2133, 2024, 2698, 547, 1221, 1112, 1786,
+     1014, 1688, 1579, 2253, 926, 1600, 1491, 2165, 1393, 2067, 1958, 2632,
+     849, 1523, 1414, 2088, 1316, 1990, 1881, 2555, 1228, 1902, 1793, 2467,
+     1695, 2369, 2260, 2934},
+    {0, 94, 63, 157, 39, 133, 102, 196, 21, 115, 84, 178,
+     60, 154, 123, 217, 9, 103, 72, 166, 48, 142, 111, 205,
+     30, 124, 93, 187, 69, 163, 132, 226, 2, 96, 65, 159,
+     41, 135, 104, 198, 23, 117, 86, 180, 62, 156, 125, 219,
+     11, 105, 74, 168, 50, 144, 113, 207, 32, 126, 95, 189,
+     71, 165, 134, 228, 0, 94, 63, 157, 39, 133, 102, 196,
+     21, 115, 84, 178, 60, 154, 123, 217, 9, 103, 72, 166,
+     48, 142, 111, 205, 30, 124, 93, 187, 69, 163, 132, 226,
+     2, 96, 65, 159, 41, 135, 104, 198, 23, 117, 86, 180,
+     62, 156, 125, 219, 11, 105, 74, 168, 50, 144, 113, 207,
+     32, 126, 95, 189, 71, 165, 134, 228, 0, 94, 63, 157,
+     39, 133, 102, 196, 21, 115, 84, 178, 60, 154, 123, 217,
+     9, 103, 72, 166, 48, 142, 111, 205, 30, 124, 93, 187,
+     69, 163, 132, 226, 2, 96, 65, 159, 41, 135, 104, 198,
+     23, 117, 86, 180, 62, 156, 125, 219, 11, 105, 74, 168,
+     50, 144, 113, 207, 32, 126, 95, 189, 71, 165, 134, 228,
+     0, 94, 63, 157, 39, 133, 102, 196, 21, 115, 84, 178,
+     60, 154, 123, 217, 9, 103, 72, 166, 48, 142, 111, 205,
+     30, 124, 93, 187, 69, 163, 132, 226, 2, 96, 65, 159,
+     41, 135, 104, 198, 23, 117, 86, 180, 62, 156, 125, 219,
+     11, 105, 74, 168, 50, 144, 113, 207, 32, 126, 95, 189,
+     71, 165, 134, 228}};
 
 static bool pdmConfigured = false;
 
@@ -50,6 +228,57 @@ static bool pdmConfigured = false;
 #define DC_OFFSET       (1023 / 3)
 #define NOISE_THRESHOLD 3
 
+static Adafruit_CPlay_MicRing micRing; // Blocks for startStream()
+static bool streaming = false;
+
+#ifdef __AVR__
+// FFT requires signed inputs; ADC output is unsigned.  DC offset is
+// NOT 512 on Circuit Playground because it uses a 1.1V OpAmp input
+// as the midpoint, and may swing asymmetrically on the high side.
+// Sign-convert and then clip range to +/- DC_OFFSET.
+static inline int16_t adcToSample(int16_t adc) {
+  if(adc <= (DC_OFFSET - NOISE_THRESHOLD)) {
+    adc  -= DC_OFFSET;
+  } else if(adc >= (DC_OFFSET + NOISE_THRESHOLD)) {
+    adc  -= DC_OFFSET;
+    if(adc > (DC_OFFSET * 2)) adc = DC_OFFSET * 2;
+  } else {
+    adc   = 0; // Below noise threshold
+  }
+  return adc;
+}
+
+static uint8_t  admux_stream, adcsra_stream, adcsrb_stream;
+static uint16_t streamIdx; // Next sample within micRing.writeBlock()
+
+// Only enabled by startStream().  Weak, so a sketch or other library that
+// defines its own ADC interrupt still links (streaming then won't work).
+ISR(ADC_vect, __attribute__((weak))) {
+  int16_t *block = micRing.writeBlock();
+  block[streamIdx] = adcToSample(ADC);
+  if(++streamIdx >= micRing.blockLength()) {
+    streamIdx = 0;
+    micRing.commit(); // On overrun, block is refilled in place
+  }
+}
+#elif defined(ARDUINO_ARCH_SAMD)
+#include <Adafruit_ZeroDMA.h>
+
+static Adafruit_ZeroDMA micDMA;
+static DmacDescriptor  *micDesc[2];
+static uint32_t        *rawWords  = NULL; // Two halves, DMA ping-pongs
+static uint16_t         rawLen    = 0;    // Words per half
+static uint8_t          rawHalf   = 0;    // Half DMA finished next
+
+static void micDMAcallback(Adafruit_ZeroDMA *dma) {
+  (void)dma;
+  Adafruit_CPlay_Mic::decimate(rawWords + rawHalf * rawLen,
+    micRing.writeBlock(), micRing.blockLength());
+  micRing.commit();   // On overrun, block is refilled next time
+  rawHalf ^= 1;
+}
+#endif
+
 /**************************************************************************/
 /*! 
     @brief  Reads ADC for given interval (in milliseconds, 1-65535). Uses ADC free-run mode w/polling on AVR.
@@ -112,19 +341,7 @@ void Adafruit_CPlay_Mic::capture(int16_t *buf, uint16_t nSamples) {
     while(!(ADCSRA & _BV(ADIF)));      // Wait for ADC result
     adc     = ADC;
     ADCSRA |= _BV(ADIF);               // Clear bit
-    // FFT requires signed inputs; ADC output is unsigned.  DC offset is
-    // NOT 512 on Circuit Playground because it uses a 1.1V OpAmp input
-    // as the midpoint, and may swing asymmetrically on the high side.
-    // Sign-convert and then clip range to +/- DC_OFFSET.
-    if(adc <= (DC_OFFSET - NOISE_THRESHOLD)) {
-      adc  -= DC_OFFSET;
-    } else if(adc >= (DC_OFFSET + NOISE_THRESHOLD)) {
-      adc  -= DC_OFFSET;
-      if(adc > (DC_OFFSET * 2)) adc = DC_OFFSET * 2;
-    } else {
-      adc   = 0; // Below noise threshold
-    }
-    buf[i]  = adc;
+    buf[i]  = adcToSample(adc);
   }
 
   ADMUX  = admux_save;                 // Restore ADC config
@@ -138,35 +355,15 @@ void Adafruit_CPlay_Mic::capture(int16_t *buf, uint16_t nSamples) {
     pdmConfigured = true;
   }
 
-  int16_t *ptr = buf;
-  while(ptr < (buf + nSamples)){
-    uint16_t runningsum = 0;
-    uint16_t *sinc_ptr = sincfilter;
-
-    for (uint8_t samplenum=0; samplenum < (DECIMATION/16) ; samplenum++) {
-       uint16_t sample = pdm.read() & 0xFFFF;    // we read 16 bits at a time, by default the low half
-
-       ADAPDM_REPEAT_LOOP_16(      // manually unroll loop: for (int8_t b=0; b<16; b++) 
-         {
-           // start at the LSB which is the 'first' bit to come down the line, chronologically 
-           // (Note we had to set I2S_SERCTRL_BITREV to get this to work, but saves us time!)
-           if (sample & 0x1) {
-             runningsum += *sinc_ptr;     // do the convolution
-           }
-           sinc_ptr++;
-           sample >>= 1;
-        }
-      )
-    }
-
+  // Polled reads have no FIFO behind them, so filter each sample as soon
+  // as its words arrive rather than reading ahead and overrunning I2S.
+  // DMA-filled buffers can go through decimate() in one call.
+  uint32_t words[DECIMATION/16];
+  while(nSamples--) {
+    for (uint8_t w=0; w < (DECIMATION/16); w++) words[w] = pdm.read();
     // since we wait for the samples from I2S peripheral, we dont need to delay, we will 'naturally'
     // wait the right amount of time between analog writes
-    //Serial.println(runningsum);
-    
-    runningsum /= 64 ; // convert 16 bit -> 10 bit
-    runningsum -= 512;  // make it close to 0-offset signed
-
-    *ptr++ = runningsum;
+    decimate(words, buf++, 1);
   }
 #elif defined(ARDUINO_NRF52840_CIRCUITPLAY)
   if(!pdmConfigured){
@@ -193,6 +390,36 @@ void Adafruit_CPlay_Mic::capture(int16_t *buf, uint16_t nSamples) {
 #endif
 }
 
+#if defined(ARDUINO_ARCH_SAMD)
+/**************************************************************************/
+/*! 
+    @brief  SAMD ONLY: convert raw PDM words, as read from the I2S data
+      register by pdm.read() or by DMA, to PCM samples.  Each output sample
+      consumes DECIMATION/16 words, of which only the low 16 bits are used
+      (LSB is the earliest bit).  Output matches what capture() has always
+      produced, but the sinc filter is applied a byte at a time through a
+      lookup table: 8 table reads per sample instead of 64 bit tests.
+    @param pdmWords PDM input, nSamples * DECIMATION/16 words
+    @param pcm the buffer to store the samples in
+    @param nSamples the number of samples to produce
+*/
+/**************************************************************************/
+void Adafruit_CPlay_Mic::decimate(const uint32_t *pdmWords, int16_t *pcm,
+                                  uint16_t nSamples) {
+  while(nSamples--) {
+    uint16_t runningsum = 0;
+    for (uint8_t w=0; w < (DECIMATION/16); w++) {
+      uint32_t sample = *pdmWords++;
+      runningsum += sincLUT[2 * w    ][ sample       & 0xFF];
+      runningsum += sincLUT[2 * w + 1][(sample >> 8) & 0xFF];
+    }
+    runningsum /= 64 ; // convert 16 bit -> 10 bit
+    runningsum -= 512;  // make it close to 0-offset signed
+    *pcm++ = runningsum;
+  }
+}
+#endif
+
 /**************************************************************************/
 /*! 
     @brief Returns somewhat-calibrated sound pressure level.
@@ -201,47 +428,64 @@ void Adafruit_CPlay_Mic::capture(int16_t *buf, uint16_t nSamples) {
 */
 /**************************************************************************/
 float Adafruit_CPlay_Mic::soundPressureLevel(uint16_t ms){
-  double gain;
-  int16_t *ptr;
   uint16_t len;
+#ifdef __AVR__
+  len = 9.615 * ms;
+#elif defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_NRF52840_CIRCUITPLAY)
+  len = (float)(SAMPLERATE_HZ/1000) * ms;
+#else
+  #error "no compatible architecture defined."
+#endif
+  int16_t data[len];
+  capture(data, len);
+
+  return soundPressureLevel(data, len);
+}
+
+/**************************************************************************/
+/*! 
+    @brief Returns somewhat-calibrated sound pressure level of samples
+      already captured, e.g. a block from readBlock().  The samples are not
+      modified.
+    @param data the samples, as produced by capture()
+    @param len the number of samples
+    @returns Floating point Sound Pressure Level, tends to range from 40-120 db SPL
+*/
+/**************************************************************************/
+float Adafruit_CPlay_Mic::soundPressureLevel(const int16_t *data, uint16_t len){
+  double gain;
+  const int16_t *ptr;
   int16_t minVal = 52;
 #ifdef __AVR__
   gain = 1.3;
-  len = 9.615 * ms;
 #elif defined(ARDUINO_ARCH_SAMD)
   gain = 9;
-  len = (float)(SAMPLERATE_HZ/1000) * ms;
 #elif defined(ARDUINO_NRF52840_CIRCUITPLAY)
   gain = 2;
-  len = (float)(SAMPLERATE_HZ/1000) * ms;
 #else
   #error "no compatible architecture defined."
 #endif
-  int16_t data[len];
-  capture(data, len);
+  if(!len) return minVal;
 
-  int16_t *end = data + len;
+  const int16_t *end = data + len;
   double pref = 0.00002;
 
   /*******************************
-   *   REMOVE DC OFFSET
+   *   FIND DC OFFSET
    ******************************/
   int32_t avg = 0;
   ptr = data;
   while(ptr < end) avg += *ptr++;
   avg = avg/len;
 
-  ptr = data;
-  while(ptr < end) *ptr++ -= avg;
-  
    /*******************************
-   *   GET MAX VALUE
+   *   GET MAX VALUE, LESS DC OFFSET
    ******************************/
 
    int16_t maxVal = 0;
    ptr = data;
    while(ptr < end){
-     int32_t v = abs(*ptr++);
+     int32_t v = abs(*ptr++ - avg);
      if(v > maxVal) maxVal = v;
    }
    
@@ -287,11 +531,166 @@ void Adafruit_CPlay_Mic::fft(
  uint16_t *spectrum) {               // Spectrum output buffer, uint16_t[32]
   if(spectrum) {
     int16_t   capBuf[64];            // Audio capture buffer
-    complex_t butterfly[64];         // FFT "butterfly" buffer
 
     capture(capBuf, 64);             // Collect mic data into capBuf
-    fft_input(capBuf, butterfly);    // Samples -> complex #s
+    fft(capBuf, spectrum);
+  }
+}
+
+/**************************************************************************/
+/*! 
+    @brief  AVR ONLY: Performs one cycle of fast Fourier transform (FFT) on
+      audio that was already captured, e.g. a block from readBlock().  Output
+      is the same as fft(spectrum).  Needs about 260 bytes free RAM to operate.
+    @param block 64 samples, as produced by capture(). Not modified.
+    @param spectrum the buffer to store the results in. Must be 32 bytes in length.
+*/
+/**************************************************************************/
+void Adafruit_CPlay_Mic::fft(
+ const int16_t *block,               // Audio samples, int16_t[64]
+ uint16_t      *spectrum) {          // Spectrum output buffer, uint16_t[32]
+  if(block && spectrum) {
+    complex_t butterfly[64];         // FFT "butterfly" buffer
+
+    fft_input(block, butterfly);     // Samples -> complex #s
     fft_execute(butterfly);          // Process complex data
     fft_output(butterfly, spectrum); // Complex -> spectrum (32 bins)
   }
 }
+
+/**************************************************************************/
+/*! 
+    @brief  Start capturing audio continuously in the background into a ring
+      of blocks, to be collected with readBlock() / releaseBlock().  Samples
+      are the same as capture() produces.
+    @param storage nBlocks * blockLen samples, must stay valid until
+      stopStream()
+    @param nBlocks number of blocks: a power of 2 from 2 to 128.  Up to
+      nBlocks-1 filled blocks can wait for the sketch before blocks are dropped.
+    @param blockLen samples per block; 64 matches fft(block, spectrum)
+    @returns true if streaming started
+    @note ON AVR: runs the ADC free-running with its interrupt at 9615 Hz,
+      so analogRead() and capture() must not be used until stopStream().  If the sketch
+      defines its own ISR(ADC_vect), that takes precedence and no blocks
+      will arrive.
+    @note ON SAMD: PDM words are moved by DMA into two buffers of
+      blockLen * 4 words and converted one block at a time in the DMA
+      interrupt.  capture() must not be used until stopStream().
+    @note Not supported on nRF52840 (returns false).
+*/
+/**************************************************************************/
+bool Adafruit_CPlay_Mic::startStream(int16_t *storage, uint8_t nBlocks,
+                                     uint16_t blockLen) {
+  if(streaming) stopStream();
+  if(!micRing.begin(storage, nBlocks, blockLen)) return false;
+
+#ifdef __AVR__
+  uint8_t channel = analogPinToChannel(4); // Pin A4 to ADC channel
+  admux_stream  = ADMUX;                   // Save ADC config registers
+  adcsra_stream = ADCSRA;
+  adcsrb_stream = ADCSRB;
+  streamIdx     = 0;
+
+  // Same free-run setup as capture(), but with the interrupt enabled
+  ADCSRA = 0;                          // Stop ADC interrupt, if any
+  ADMUX  = _BV(REFS0) | channel;       // Aref=AVcc, channel sel, right-adj
+  ADCSRB = 0;                          // Free run mode, no high MUX bit
+  ADCSRA = _BV(ADEN)  |                // ADC enable
+           _BV(ADSC)  |                // ADC start
+           _BV(ADATE) |                // Auto trigger
+           _BV(ADIF)  |                // Reset interrupt flag
+           _BV(ADIE)  |                // Interrupt per sample
+           _BV(ADPS2) | _BV(ADPS1);    // 64:1 / 13 = 9615 Hz
+#elif defined(ARDUINO_ARCH_SAMD)
+  if(!pdmConfigured){
+    pdm.begin();
+    pdm.configure(SAMPLERATE_HZ * DECIMATION / 16, true);
+    pdmConfigured = true;
+  }
+
+  uint16_t words = blockLen * (DECIMATION / 16);
+  if(words > rawLen) {
+    uint32_t *w = (uint32_t *)realloc(rawWords, 2 * words * sizeof(uint32_t));
+    if(!w) return false;
+    rawWords = w;
+  }
+  rawLen  = words;
+  rawHalf = 0;
+
+  void *i2s_data_reg = (void *)&I2S->DATA[pdm.getSerializer()];
+  if(!micDesc[0]) {
+    if(micDMA.allocate() != DMA_STATUS_OK) return false;
+    // I2S RX 0 or 1 trigger (see DS Table 19-8. Peripheral Trigger Source)
+    micDMA.setTrigger((pdm.getSerializer() == I2S_SERIALIZER_0) ?
+      I2S_DMAC_ID_RX_0 : I2S_DMAC_ID_RX_1);
+    micDMA.setAction(DMA_TRIGGER_ACTON_BEAT);
+    for(uint8_t i=0; i<2; i++) {
+      micDesc[i] = micDMA.addDescriptor(i2s_data_reg, rawWords + i * words,
+        words, DMA_BEAT_SIZE_WORD, false, true);
+      if(!micDesc[i]) return false;
+      micDesc[i]->BTCTRL.bit.BLOCKACT = DMA_BLOCK_ACTION_INT;
+    }
+    micDMA.loop(true);
+    micDMA.setCallback(micDMAcallback);
+  } else {
+    for(uint8_t i=0; i<2; i++)
+      micDMA.changeDescriptor(micDesc[i], i2s_data_reg, rawWords + i * words, words);
+  }
+  if(micDMA.startJob() != DMA_STATUS_OK) return false;
+#else
+  return false;
+#endif
+
+  streaming = true;
+  return true;
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Stop background capture started with startStream().  Blocks
+      already queued are discarded.
+*/
+/**************************************************************************/
+void Adafruit_CPlay_Mic::stopStream(void) {
+  if(!streaming) return;
+#ifdef __AVR__
+  ADMUX  = admux_stream;               // Restore ADC config
+  ADCSRB = adcsrb_stream;
+  ADCSRA = adcsra_stream;
+  (void)analogRead(A4);                // Purge residue from ADC register
+#elif defined(ARDUINO_ARCH_SAMD)
+  micDMA.abort();
+#endif
+  streaming = false;
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Get the oldest block captured by startStream(), without copying.
+      The same block is returned until releaseBlock() is called.
+    @returns pointer to blockLen samples, or NULL if no block is ready yet
+*/
+/**************************************************************************/
+const int16_t *Adafruit_CPlay_Mic::readBlock(void) {
+  return micRing.readBlock();
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Done with the block from readBlock(); it may now be refilled.
+*/
+/**************************************************************************/
+void Adafruit_CPlay_Mic::releaseBlock(void) {
+  micRing.release();
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Number of blocks dropped since startStream() because the sketch
+      didn't release blocks fast enough.
+    @returns block count
+*/
+/**************************************************************************/
+uint16_t Adafruit_CPlay_Mic::overruns(void) {
+  return micRing.overruns();
+}
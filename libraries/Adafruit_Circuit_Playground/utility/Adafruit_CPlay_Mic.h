@@ -16,6 +16,8 @@
 #endif
 
 #include "Adafruit_ZeroPDM.h"
+#include "Adafruit_CPlay_MicRing.h"
+#include "Adafruit_CPlay_MicLevel.h"
 
 
 /**************************************************************************/
@@ -28,9 +30,23 @@ class Adafruit_CPlay_Mic {
   Adafruit_CPlay_Mic(void) {}; // Empty constructor
   int  peak(uint16_t ms)  __attribute__ ((deprecated));
   void capture(int16_t *buf, uint16_t nSamples),
-       fft(uint16_t *spectrum);
+       fft(uint16_t *spectrum),
+       fft(const int16_t *block, uint16_t *spectrum);
 
-  float soundPressureLevel(uint16_t ms);
+  float soundPressureLevel(uint16_t ms),
+        soundPressureLevel(const int16_t *data, uint16_t len);
+
+  bool           startStream(int16_t *storage, uint8_t nBlocks,
+                             uint16_t blockLen);
+  void           stopStream(void);
+  const int16_t *readBlock(void);
+  void           releaseBlock(void);
+  uint16_t       overruns(void);
+
+#if defined(ARDUINO_ARCH_SAMD)
+  static void decimate(const uint32_t *pdmWords, int16_t *pcm,
+                       uint16_t nSamples);
+#endif
 
 private:
 #if defined(ARDUINO_ARCH_SAMD)
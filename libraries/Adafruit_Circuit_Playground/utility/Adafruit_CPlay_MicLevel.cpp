@@ -0,0 +1,176 @@
+// Adafruit Circuit Playground microphone level meter.
+
+#include <Arduino.h>
+#include "Adafruit_CPlay_MicLevel.h"
+
+// Board defaults, matching capture() and soundPressureLevel()
+#ifdef __AVR__
+#define LEVEL_RATE_HZ 9615
+#define LEVEL_GAIN    1.3
+#elif defined(ARDUINO_ARCH_SAMD)
+#define LEVEL_RATE_HZ 22000
+#define LEVEL_GAIN    9
+#else
+#define LEVEL_RATE_HZ 16000
+#define LEVEL_GAIN    2
+#endif
+
+#define LEVEL_MIN_Q8  (52 * 256) // Same floor as soundPressureLevel()
+
+// log2(1 + i/32) in Q15, i = 0..32
+static const uint16_t PROGMEM log2Table[33] = {
+  0, 1455, 2866, 4236, 5568, 6863, 8124, 9352, 10549, 11716, 12855, 13968,
+  15055, 16117, 17156, 18173, 19168, 20143, 21098, 22034, 22952, 23852,
+  24736, 25604, 26455, 27292, 28114, 28922, 29717, 30498, 31267, 32024,
+  32768 };
+
+// Power-of-2 sample count nearest to ms at rate, as a shift (0-15)
+static uint8_t msToShift(uint16_t ms, uint16_t rate) {
+  uint32_t n = (uint32_t)ms * rate / 1000;
+  uint8_t  s = 0;
+  // Round up where n is past the geometric midpoint (x1.414) of 2^s..2^s+1
+  while((s < 15) && ((n * 181) >> 7) >= (2UL << s)) s++;
+  return s;
+}
+
+/**************************************************************************/
+/*!
+    @brief  create a level meter, with time constants of 50 ms DC tracking,
+      125 ms RMS ("fast" meter), 500 ms peak hold and 250 ms peak decay
+    @param sampleRateHz rate of the samples given to update(), 0 for the
+      board's capture() rate
+    @param gain calibration gain, 0 for the board's soundPressureLevel() gain
+*/
+/**************************************************************************/
+Adafruit_CPlay_MicLevel::Adafruit_CPlay_MicLevel(uint16_t sampleRateHz,
+                                                 float gain) {
+  rate = sampleRateHz ? sampleRateHz : LEVEL_RATE_HZ;
+  if(gain <= 0) gain = LEVEL_GAIN;
+  offsetQ8 = 256 * 20 * log10(gain / (1023 * 0.00002)) + 0.5;
+  setTimeConstants(50, 125, 500, 250);
+  reset();
+}
+
+/**************************************************************************/
+/*!
+    @brief  set the meter time constants.  Each is rounded to the nearest
+      power of 2 samples (max 32768).
+    @param dcMs how fast the DC offset is tracked
+    @param rmsMs RMS averaging time
+    @param holdMs how long a new peak is held before decaying
+    @param decayMs time constant of peak decay after the hold
+*/
+/**************************************************************************/
+void Adafruit_CPlay_MicLevel::setTimeConstants(uint16_t dcMs, uint16_t rmsMs,
+                                               uint16_t holdMs, uint16_t decayMs) {
+  dcShift     = msToShift(dcMs, rate);
+  rmsShift    = msToShift(rmsMs, rate);
+  decayShift  = msToShift(decayMs, rate);
+  uint32_t n  = (uint32_t)holdMs * rate / 1000;
+  holdSamples = (n > 0xFFFF) ? 0xFFFF : n;
+}
+
+/**************************************************************************/
+/*!
+    @brief  forget all history, as if no samples had been seen
+*/
+/**************************************************************************/
+void Adafruit_CPlay_MicLevel::reset(void) {
+  dc        = 0;
+  meanSq    = 0;
+  meanSqRem = 0;
+  peak      = 0;
+  holdLeft  = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  feed samples to the meter.  Constant work per sample; blocks may
+      be any length.
+    @param samples the samples, as produced by capture() or readBlock()
+    @param len the number of samples
+*/
+/**************************************************************************/
+void Adafruit_CPlay_MicLevel::update(const int16_t *samples, uint16_t len) {
+  int32_t  d    = dc,
+           ms   = meanSq;
+  uint16_t rem  = meanSqRem;
+  uint32_t pk   = peak;
+  uint16_t hold = holdLeft;
+
+  // Round the DC steps; truncating would bias it low.  The mean of squares
+  // instead carries each step's remainder to the next, as rounding alone
+  // leaves it stuck anywhere within 2^rmsShift of the true mean, which at
+  // quiet levels is most of the signal.
+  int32_t  dcRound = (1L << dcShift) >> 1;
+  uint16_t msMask  = (1U << rmsShift) - 1;
+
+  while(len--) {
+    int32_t x = *samples++ * 65536L;            // Q16
+    d += (x - d + dcRound) >> dcShift;
+    int32_t  v  = (x - d + 2048) >> 12;         // Sample less DC, Q4
+    uint32_t sq = v * v;                        // Q8, <= 2^30
+    int32_t  step = (int32_t)sq - ms + rem;
+    ms  += step >> rmsShift;
+    rem  = step & msMask;
+
+    uint32_t a = (uint32_t)(v < 0 ? -v : v) << 12; // Q16
+    if(a >= pk) {
+      pk   = a;
+      hold = holdSamples;
+    } else if(hold) {
+      hold--;
+    } else {
+      pk  -= pk >> decayShift;
+    }
+  }
+
+  dc        = d;
+  meanSq    = ms;
+  meanSqRem = rem;
+  peak      = pk;
+  holdLeft  = hold;
+}
+
+/**************************************************************************/
+/*!
+    @brief  fixed-point log2 using a 33-entry table with linear
+      interpolation; error is under 0.001 (0.003 dB of power).
+    @param v value, must be nonzero
+    @returns log2(v) in Q8
+*/
+/**************************************************************************/
+int16_t Adafruit_CPlay_MicLevel::log2Q8(uint32_t v) {
+  uint8_t e = (sizeof(long) * 8 - 1) - __builtin_clzl(v);
+  v <<= (31 - e);                        // Normalize, MSB at bit 31
+  uint8_t  i    = (v >> 26) & 31;        // Next 5 bits index the table
+  uint16_t frac = (v >> 18) & 255;       // Following 8 interpolate
+  uint16_t lo   = pgm_read_word(&log2Table[i]),
+           hi   = pgm_read_word(&log2Table[i + 1]);
+  uint16_t m    = lo + (((uint32_t)(hi - lo) * frac) >> 8);
+  return ((int16_t)e << 8) + ((m + 64) >> 7);
+}
+
+/**************************************************************************/
+/*!
+    @brief  RMS sound pressure level over the rmsMs time constant
+    @returns dB SPL in 1/256 dB units
+*/
+/**************************************************************************/
+int16_t Adafruit_CPlay_MicLevel::rmsSPLQ8(void) const {
+  if(meanSq <= 0) return LEVEL_MIN_Q8;
+  // 10*log10(meanSq / 2^8) = 3.0103 * (log2(meanSq) - 8)
+  return (((int32_t)log2Q8(meanSq) - (8 << 8)) * 771 >> 8) + offsetQ8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  held peak sound pressure level
+    @returns dB SPL in 1/256 dB units
+*/
+/**************************************************************************/
+int16_t Adafruit_CPlay_MicLevel::peakSPLQ8(void) const {
+  if(!peak) return LEVEL_MIN_Q8;
+  // 20*log10(peak / 2^16) = 6.0206 * (log2(peak) - 16)
+  return (((int32_t)log2Q8(peak) - (16 << 8)) * 1541 >> 8) + offsetQ8;
+}
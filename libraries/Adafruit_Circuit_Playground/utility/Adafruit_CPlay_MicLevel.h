@@ -0,0 +1,63 @@
+// Adafruit Circuit Playground microphone level meter.
+// Streaming sound pressure level: DC removal, RMS and peak-hold are all
+// tracked per sample in integer math, so any block length works and
+// nothing is buffered.
+
+#ifndef ADAFRUIT_CPLAY_MICLEVEL_H
+#define ADAFRUIT_CPLAY_MICLEVEL_H
+
+#include <stdint.h>
+
+/**************************************************************************/
+/*!
+    @brief  Incremental sound level meter for samples from
+      Adafruit_CPlay_Mic::capture() or readBlock().  Averages are
+      exponential with power-of-2 sample counts, so the time constants
+      actually used are the requested ones rounded to the nearest power of
+      2 samples.
+*/
+/**************************************************************************/
+class Adafruit_CPlay_MicLevel {
+ public:
+  Adafruit_CPlay_MicLevel(uint16_t sampleRateHz = 0, float gain = 0);
+
+  void setTimeConstants(uint16_t dcMs, uint16_t rmsMs, uint16_t holdMs,
+                        uint16_t decayMs),
+       update(const int16_t *samples, uint16_t len),
+       reset(void);
+
+  int16_t rmsSPLQ8(void) const,
+          peakSPLQ8(void) const;
+
+  /**************************************************************************/
+  /*!
+      @brief  RMS sound pressure level over the rmsMs time constant
+      @returns dB SPL, same calibration as soundPressureLevel()
+  */
+  /**************************************************************************/
+  float rmsSPL(void) const { return rmsSPLQ8() / 256.0; };
+
+  /**************************************************************************/
+  /*!
+      @brief  held peak sound pressure level
+      @returns dB SPL, same calibration as soundPressureLevel()
+  */
+  /**************************************************************************/
+  float peakSPL(void) const { return peakSPLQ8() / 256.0; };
+
+  static int16_t log2Q8(uint32_t v);
+
+ private:
+  uint16_t rate;
+  int16_t  offsetQ8;  // 20*log10(gain / (1023 * 20 uPa)) in 1/256 dB
+  uint8_t  dcShift, rmsShift, decayShift;
+  uint16_t holdSamples;
+
+  int32_t  dc;        // DC level, Q16
+  int32_t  meanSq;    // Mean square of (sample - DC), Q8
+  uint16_t meanSqRem; // Remainder of the last meanSq step, carried over
+  uint32_t peak;      // Held peak |sample - DC|, Q16
+  uint16_t holdLeft;  // Samples until held peak starts decaying
+};
+
+#endif // ADAFRUIT_CPLAY_MICLEVEL_H
@@ -0,0 +1,135 @@
+// Adafruit Circuit Playground microphone block ring.
+// Single-producer (interrupt), single-consumer (sketch) ring of fixed-size
+// PCM blocks, handed out by pointer so no samples are copied.  Has no
+// hardware dependencies.
+
+#ifndef ADAFRUIT_CPLAY_MICRING_H
+#define ADAFRUIT_CPLAY_MICRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Keep the compiler from moving sample stores past the index update that
+// publishes them (single core, so no hardware barrier is needed).
+#define CPLAY_MICRING_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+/**************************************************************************/
+/*!
+    @brief  Lock-free ring of PCM blocks shared between an interrupt that
+      fills them and the sketch that reads them.  One block is always kept
+      for the producer to write into, so nBlocks-1 blocks can be queued.
+*/
+/**************************************************************************/
+class Adafruit_CPlay_MicRing {
+ public:
+  Adafruit_CPlay_MicRing(void) : blocks(NULL), len(0), mask(0), head(0),
+    tail(0), overrunCount(0) {};
+
+  /**************************************************************************/
+  /*!
+      @brief  set up the ring over caller-supplied storage. Must not be
+        called while a producer is running.
+      @param storage nBlocks * blockLen samples
+      @param nBlocks number of blocks: a power of 2 from 2 to 128
+      @param blockLen samples per block
+      @returns true on success, false if nBlocks or blockLen is invalid
+  */
+  /**************************************************************************/
+  bool begin(int16_t *storage, uint8_t nBlocks, uint16_t blockLen) {
+    if((nBlocks < 2) || (nBlocks > 128) || (nBlocks & (nBlocks - 1)) ||
+       !blockLen || !storage) return false;
+    blocks       = storage;
+    len          = blockLen;
+    mask         = nBlocks - 1;
+    head         = 0;
+    tail         = 0;
+    overrunCount = 0;
+    return true;
+  };
+
+  /**************************************************************************/
+  /*!
+      @brief  PRODUCER: the block to fill next.  Stays the same until
+        commit() succeeds.
+      @returns pointer to blockLength() samples
+  */
+  /**************************************************************************/
+  int16_t *writeBlock(void) { return blocks + (uint16_t)(head & mask) * len; };
+
+  /**************************************************************************/
+  /*!
+      @brief  PRODUCER: hand the filled writeBlock() to the consumer.  If the
+        consumer is too far behind the block is dropped (and will be
+        overwritten) and the overrun count goes up.
+      @returns true if the block was queued, false if dropped
+  */
+  /**************************************************************************/
+  bool commit(void) {
+    if((uint8_t)(head + 1 - tail) > mask) {
+      overrunCount++;
+      return false;
+    }
+    CPLAY_MICRING_BARRIER();
+    head++;
+    return true;
+  };
+
+  /**************************************************************************/
+  /*!
+      @brief  CONSUMER: oldest queued block.  Returns the same block until
+        release() is called.
+      @returns pointer to blockLength() samples, or NULL if none is queued
+  */
+  /**************************************************************************/
+  const int16_t *readBlock(void) {
+    if(head == tail) return NULL;
+    CPLAY_MICRING_BARRIER();
+    return blocks + (uint16_t)(tail & mask) * len;
+  };
+
+  /**************************************************************************/
+  /*!
+      @brief  CONSUMER: done with the block from readBlock(), let the
+        producer reuse it.
+  */
+  /**************************************************************************/
+  void release(void) {
+    if(head != tail) {
+      CPLAY_MICRING_BARRIER();
+      tail++;
+    }
+  };
+
+  /**************************************************************************/
+  /*!
+      @brief  number of blocks queued for the consumer
+      @returns block count
+  */
+  /**************************************************************************/
+  uint8_t available(void) const { return head - tail; };
+
+  /**************************************************************************/
+  /*!
+      @brief  samples per block
+      @returns sample count
+  */
+  /**************************************************************************/
+  uint16_t blockLength(void) const { return len; };
+
+  /**************************************************************************/
+  /*!
+      @brief  number of blocks dropped because the consumer fell behind
+      @returns block count since begin()
+  */
+  /**************************************************************************/
+  uint16_t overruns(void) const { return overrunCount; };
+
+ private:
+  int16_t           *blocks;
+  uint16_t           len;
+  uint8_t            mask;
+  volatile uint8_t   head, tail;   // Free-running, wrap at 256
+  volatile uint16_t  overrunCount;
+};
+
+#endif // ADAFRUIT_CPLAY_MICRING_H
@@ -86,10 +86,72 @@ inline uint8_t *pgm_read_bitmap_ptr(const GFXfont *gfxFont) {
 #endif //__AVR__
 }
 
+/**************************************************************************/
+/*!
+   @brief    Read the data pointer of an RLE bitmap, which is in PROGMEM
+   @param    bitmap  The GFXrleBitmap struct
+   @returns  Pointer to the RLE packets
+*/
+/**************************************************************************/
+uint8_t *Adafruit_GFX::pgm_read_rle_data_ptr(const GFXrleBitmap *bitmap) {
+#ifdef __AVR__
+  return (uint8_t *)pgm_read_pointer(&bitmap->data);
+#else
+  return bitmap->data;
+#endif //__AVR__
+}
+
+/**************************************************************************/
+/*!
+   @brief    Read the palette pointer of an RLE bitmap, which is in PROGMEM
+   @param    bitmap  The GFXrleBitmap struct
+   @returns  Pointer to the RGB565 palette
+*/
+/**************************************************************************/
+uint16_t *Adafruit_GFX::pgm_read_rle_palette_ptr(const GFXrleBitmap *bitmap) {
+#ifdef __AVR__
+  return (uint16_t *)pgm_read_pointer(&bitmap->palette);
+#else
+  return bitmap->palette;
+#endif //__AVR__
+}
+
 #ifndef min
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
 
+// Collects spans from the filled-shape rasterizer and passes them to
+// writeSpans() GFX_SPAN_BATCH at a time. Each batch carries one color and
+// orientation; a primitive emitting spans along several fronts (e.g. both
+// sides of a circle) uses one batch per front so that neighboring spans
+// stay adjacent in the list, which lets subclasses merge them.
+class GFXspanBatch {
+public:
+  GFXspanBatch(Adafruit_GFX *gfx, bool vertical, uint16_t color)
+      : gfx(gfx), color(color), count(0), vertical(vertical) {}
+  ~GFXspanBatch() { flush(); }
+  void add(int16_t x, int16_t y, int16_t len) {
+    spans[count].x = x;
+    spans[count].y = y;
+    spans[count].len = len;
+    if (++count == GFX_SPAN_BATCH)
+      flush();
+  }
+  void flush(void) {
+    if (count) {
+      gfx->writeSpans(spans, count, vertical, color);
+      count = 0;
+    }
+  }
+
+private:
+  Adafruit_GFX *gfx;
+  GFXspan spans[GFX_SPAN_BATCH];
+  uint16_t color;
+  uint8_t count;
+  bool vertical;
+};
+
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b)                                                    \
   {                                                                            \
@@ -117,6 +179,7 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   wrap = true;
   _cp437 = false;
   gfxFont = NULL;
+  glyphCache = NULL;
 }
 
 /**************************************************************************/
@@ -244,6 +307,33 @@ void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   fillRect(x, y, w, h, color);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write a batch of same-colored horizontal or vertical spans, as
+   produced by the filled-shape primitives. Overwrite in subclasses if
+   there's a cheaper way than one line per span (e.g. merging adjacent
+   spans into a single rectangle fill).
+    @param    spans     Array of spans (see GFXspan)
+    @param    count     Number of spans in array
+    @param    vertical  true if spans are vertical, false if horizontal
+    @param    color     16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeSpans(const GFXspan *spans, uint8_t count,
+                              bool vertical, uint16_t color) {
+  if (vertical) {
+    while (count--) {
+      writeFastVLine(spans->x, spans->y, spans->len, color);
+      spans++;
+    }
+  } else {
+    while (count--) {
+      writeFastHLine(spans->x, spans->y, spans->len, color);
+      spans++;
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    End a display-writing routine, overwrite in subclasses if
@@ -472,41 +562,42 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                     uint8_t corners, int16_t delta,
                                     uint16_t color) {
 
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t px = x;
-  int16_t py = y;
-
   delta++; // Avoid some +1's in the loop
 
-  while (x < y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-    // These checks avoid double-drawing certain lines, important
-    // for the SSD1306 library which has an INVERT drawing mode.
-    if (x < (y + 1)) {
-      if (corners & 1)
-        writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
-      if (corners & 2)
-        writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
-    }
-    if (y != py) {
-      if (corners & 1)
-        writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
-      if (corners & 2)
-        writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
-      py = y;
+  // Inner columns move outward from the center and outer columns move
+  // inward from the edge, so each gets its own batch. The two sides are
+  // drawn one after the other, so only two batches are on the stack.
+  for (int8_t side = 1; side >= -1; side -= 2) {
+    if (!(corners & (side > 0 ? 1 : 2)))
+      continue;
+    GFXspanBatch inner(this, true, color), outer(this, true, color);
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+      // These checks avoid double-drawing certain lines, important
+      // for the SSD1306 library which has an INVERT drawing mode.
+      if (x < (y + 1))
+        inner.add(x0 + side * x, y0 - y, 2 * y + delta);
+      if (y != py) {
+        outer.add(x0 + side * py, y0 - px, 2 * px + delta);
+        py = y;
+      }
+      px = x;
     }
-    px = x;
   }
 }
 
@@ -654,6 +745,7 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
           dx12 = x2 - x1, dy12 = y2 - y1;
   int32_t sa = 0, sb = 0;
+  GFXspanBatch spans(this, false, color);
 
   // For upper part of triangle, find scanline crossings for segments
   // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
@@ -677,7 +769,7 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     */
     if (a > b)
       _swap_int16_t(a, b);
-    writeFastHLine(a, y, b - a + 1, color);
+    spans.add(a, y, b - a + 1);
   }
 
   // For lower part of triangle, find scanline crossings for segments
@@ -695,8 +787,9 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     */
     if (a > b)
       _swap_int16_t(a, b);
-    writeFastHLine(a, y, b - a + 1, color);
+    spans.add(a, y, b - a + 1);
   }
+  spans.flush();
   endWrite();
 }
 
@@ -1097,6 +1190,43 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+   @brief   Draw a PROGMEM-resident palette + RLE compressed image (see
+   gfxrlebitmap.h) at the specified (x,y) position. Runs of a single color
+   are issued as horizontal lines rather than pixel by pixel, so besides
+   the flash savings this is usually faster than drawRGBBitmap() for images
+   with large flat areas.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  Pointer to GFXrleBitmap struct
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRLEBitmap(int16_t x, int16_t y,
+                                 const GFXrleBitmap *bitmap) {
+  const uint8_t *data = pgm_read_rle_data_ptr(bitmap);
+  const uint16_t *palette = pgm_read_rle_palette_ptr(bitmap);
+  int16_t w = pgm_read_word(&bitmap->width), h = pgm_read_word(&bitmap->height);
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w;) {
+      uint8_t hdr = pgm_read_byte(data++), n = (hdr & 0x7F) + 1;
+      if (hdr & GFX_RLE_RUN) {
+        writeFastHLine(x + i, y, n,
+                       pgm_read_word(&palette[pgm_read_byte(data++)]));
+        i += n;
+      } else {
+        while (n--) {
+          writePixel(x + i++, y,
+                     pgm_read_word(&palette[pgm_read_byte(data++)]));
+        }
+      }
+    }
+  }
+  endWrite();
+}
+
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
 // Draw a character
@@ -1180,6 +1310,26 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
     c -= (uint8_t)pgm_read_byte(&gfxFont->first);
     GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c);
+
+    const GFXglyphRun *run;
+    uint8_t runs;
+    if (glyphCache && (run = glyphCache->get(gfxFont, c, &runs))) {
+      int16_t gx = x + (int8_t)pgm_read_byte(&glyph->xOffset) * size_x,
+              gy = y + (int8_t)pgm_read_byte(&glyph->yOffset) * size_y;
+      startWrite();
+      if (size_x == 1 && size_y == 1) {
+        GFXspanBatch spans(this, false, color);
+        for (; runs--; run++)
+          spans.add(gx + run->x, gy + run->y, run->len);
+        spans.flush();
+      } else {
+        for (; runs--; run++)
+          writeFillRect(gx + run->x * size_x, gy + run->y * size_y,
+                        run->len * size_x, size_y, color);
+      }
+      endWrite();
+      return;
+    }
     uint8_t *bitmap = pgm_read_bitmap_ptr(gfxFont);
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
@@ -2662,8 +2812,161 @@ void GFXcanvas16::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas16::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                    uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
-  uint32_t buffer_index = y * WIDTH + x;
-  for (uint32_t i = buffer_index; i < buffer_index + w; i++) {
-    buffer[i] = color;
+  uint16_t *ptr = buffer + (uint32_t)y * WIDTH + x;
+  // Fill two pixels per 32-bit store where possible. The canvas buffer is
+  // malloc()ed (word aligned), so only the first pixel may need to be
+  // written on its own to reach a word boundary. memcpy() keeps the pixels
+  // uint16_t as far as aliasing goes, and knowing the alignment lets the
+  // compiler make each one a single 32-bit store.
+  if (((uintptr_t)ptr & 2) && w) {
+    *ptr++ = color;
+    w--;
+  }
+  ptr = (uint16_t *)__builtin_assume_aligned(ptr, 4);
+  uint32_t color32 = (uint32_t)color * 0x00010001UL;
+  for (int16_t i = w / 2; i > 0; i--) {
+    memcpy(ptr, &color32, sizeof(color32));
+    ptr += 2;
+  }
+  if (w & 1) {
+    *ptr = color;
+  }
+}
+
+// Slot run count marking a glyph with more than maxRuns runs
+#define GLYPH_UNCACHEABLE 255
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a custom font glyph cache
+   @param    bytes    RAM budget for the cache, in bytes. This is allocated
+                      once here and never grows; the number of glyph slots
+                      is however many fit (see slots()).
+   @param    maxRuns  Max horizontal runs per cached glyph. Glyphs needing
+                      more are drawn from PROGMEM as usual. 32 covers most
+                      glyphs in the 9 and 12 point fonts; larger or more
+                      ornate fonts may want more.
+*/
+/**************************************************************************/
+GFXglyphCache::GFXglyphCache(uint16_t bytes, uint8_t maxRuns)
+    : hitCount(0), missCount(0), clock(0), numSlots(0), maxRuns(maxRuns) {
+  if (maxRuns >= GLYPH_UNCACHEABLE) // Reserved as a run count
+    this->maxRuns = GLYPH_UNCACHEABLE - 1;
+  // Round slot size up so each Slot header stays pointer-aligned
+  slotBytes = sizeof(Slot) + this->maxRuns * sizeof(GFXglyphRun);
+  slotBytes = (slotBytes + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+  uint16_t n = bytes / slotBytes;
+  if (n > 255)
+    n = 255;
+  if (n && (pool = (uint8_t *)malloc(n * slotBytes))) {
+    numSlots = n;
+    clear();
+  } else {
+    pool = NULL;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the glyph cache and free its RAM. Detach it from any
+             displays (setGlyphCache(NULL)) first!
+*/
+/**************************************************************************/
+GFXglyphCache::~GFXglyphCache(void) {
+  if (pool)
+    free(pool);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Discard all cached glyphs. Hit/miss counts are not changed.
+*/
+/**************************************************************************/
+void GFXglyphCache::clear(void) {
+  for (uint8_t i = 0; i < numSlots; i++)
+    slot(i)->font = NULL;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Reset hit and miss counts to zero
+*/
+/**************************************************************************/
+void GFXglyphCache::resetStats(void) { hitCount = missCount = 0; }
+
+/**************************************************************************/
+/*!
+   @brief    Find a glyph in the cache, decoding it from the font's PROGMEM
+             bitmap into the least-recently-used slot if not present.
+   @param    font   Custom font
+   @param    glyph  Glyph index within font (character minus font's first)
+   @param    count  Returns number of runs in glyph (may be 0, e.g. space)
+   @returns  Pointer to glyph's runs, valid until the next get() call, or
+             NULL if glyph has more than maxRuns runs (draw uncached).
+*/
+/**************************************************************************/
+const GFXglyphRun *GFXglyphCache::get(const GFXfont *font, uint8_t glyph,
+                                      uint8_t *count) {
+  if (!numSlots)
+    return NULL;
+
+  Slot *lru = slot(0);
+  clock++;
+  for (uint8_t i = 0; i < numSlots; i++) {
+    Slot *s = slot(i);
+    if ((s->font == font) && (s->glyph == glyph)) {
+      s->lastUse = clock;
+      if (s->count == GLYPH_UNCACHEABLE) {
+        missCount++; // Known too complex, caller draws it from PROGMEM
+        return NULL;
+      }
+      hitCount++;
+      *count = s->count;
+      return (GFXglyphRun *)(s + 1);
+    }
+    // Free slots are preferred, then the one unused for longest (the
+    // subtraction handles 'clock' wrapping around)
+    if (lru->font && (!s->font || (uint16_t)(clock - s->lastUse) >
+                                      (uint16_t)(clock - lru->lastUse)))
+      lru = s;
+  }
+
+  missCount++;
+  GFXglyph *g = pgm_read_glyph_ptr(font, glyph);
+  uint8_t *bitmap = pgm_read_bitmap_ptr(font);
+  uint16_t bo = pgm_read_word(&g->bitmapOffset);
+  uint8_t w = pgm_read_byte(&g->width), h = pgm_read_byte(&g->height);
+  uint8_t bits = 0, bit = 0, n = 0;
+  GFXglyphRun *runs = (GFXglyphRun *)(lru + 1);
+
+  for (uint8_t yy = 0; (yy < h) && (n != GLYPH_UNCACHEABLE); yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      // Same bit order as drawChar(): rows are NOT byte-padded
+      if (!(bit++ & 7))
+        bits = pgm_read_byte(&bitmap[bo++]);
+      if (bits & 0x80) {
+        if (n && (runs[n - 1].y == yy) &&
+            (runs[n - 1].x + runs[n - 1].len == xx)) {
+          runs[n - 1].len++;
+        } else if (n < maxRuns) {
+          runs[n].x = xx;
+          runs[n].y = yy;
+          runs[n].len = 1;
+          n++;
+        } else {
+          // Too complex to cache. Remember that, so later draws of this
+          // glyph don't repeat the decode only to fail again.
+          n = GLYPH_UNCACHEABLE;
+          break;
+        }
+      }
+      bits <<= 1;
+    }
   }
+  lru->font = font;
+  lru->glyph = glyph;
+  lru->count = n;
+  lru->lastUse = clock;
+  *count = n;
+  return (n == GLYPH_UNCACHEABLE) ? NULL : runs;
 }
@@ -8,10 +8,24 @@
 #include "WProgram.h"
 #endif
 #include "gfxfont.h"
+#include "gfxrlebitmap.h"
 
 #include <Adafruit_I2CDevice.h>
 #include <Adafruit_SPIDevice.h>
 
+/// One run of same-colored pixels, as collected by the filled-shape
+/// rasterizer (fillTriangle(), fillCircle(), fillRoundRect()) and handed to
+/// writeSpans() in batches. Horizontal or vertical per batch.
+typedef struct {
+  int16_t x;   ///< Leftmost (horizontal) or only (vertical) column
+  int16_t y;   ///< Only (horizontal) or topmost (vertical) row
+  int16_t len; ///< Run length in pixels, always > 0
+} GFXspan;
+
+#define GFX_SPAN_BATCH 8 ///< Max spans passed in one writeSpans() call
+
+class GFXglyphCache;
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -42,6 +56,8 @@ public:
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                          uint16_t color);
+  virtual void writeSpans(const GFXspan *spans, uint8_t count, bool vertical,
+                          uint16_t color);
   virtual void endWrite(void);
 
   // CONTROL API
@@ -107,6 +123,7 @@ public:
                      const uint8_t mask[], int16_t w, int16_t h);
   void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint8_t *mask,
                      int16_t w, int16_t h);
+  void drawRLEBitmap(int16_t x, int16_t y, const GFXrleBitmap *bitmap);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
                 uint16_t bg, uint8_t size);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
@@ -180,6 +197,17 @@ public:
   /**********************************************************************/
   void cp437(bool x = true) { _cp437 = x; }
 
+  /**********************************************************************/
+  /*!
+    @brief  Attach (or detach) a RAM cache for custom font glyphs. With a
+            cache attached, drawChar() draws custom-font glyphs from runs
+            decoded once from PROGMEM rather than walking the bitmap bit
+            by bit on every draw. A cache may be shared by several displays.
+    @param  cache  Pointer to GFXglyphCache object, or NULL to disable.
+  */
+  /**********************************************************************/
+  void setGlyphCache(GFXglyphCache *cache = NULL) { glyphCache = cache; }
+
   using Print::write;
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
@@ -230,6 +258,8 @@ public:
   int16_t getCursorY(void) const { return cursor_y; };
 
 protected:
+  static uint8_t *pgm_read_rle_data_ptr(const GFXrleBitmap *bitmap);
+  static uint16_t *pgm_read_rle_palette_ptr(const GFXrleBitmap *bitmap);
   void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
                   int16_t *miny, int16_t *maxx, int16_t *maxy);
   int16_t WIDTH;        ///< This is the 'raw' display width - never changes
@@ -246,6 +276,65 @@ protected:
   bool wrap;            ///< If set, 'wrap' text at right edge of display
   bool _cp437;          ///< If set, use correct CP437 charset (default is off)
   GFXfont *gfxFont;     ///< Pointer to special font
+
+  GFXglyphCache *glyphCache; ///< Optional custom font glyph cache, or NULL
+};
+
+/// One horizontal run of set pixels within a cached glyph, relative to the
+/// glyph's top-left corner (before text size scaling)
+typedef struct {
+  uint8_t x;   ///< Leftmost column of run
+  uint8_t y;   ///< Row of run
+  uint8_t len; ///< Run length in pixels
+} GFXglyphRun;
+
+/// A fixed-size, least-recently-used RAM cache of custom font glyphs,
+/// each decoded from its PROGMEM bitmap into a list of horizontal runs.
+/// Runs don't depend on text size or color, so one entry serves any size
+/// or color of the same glyph. See Adafruit_GFX::setGlyphCache().
+class GFXglyphCache {
+public:
+  GFXglyphCache(uint16_t bytes, uint8_t maxRuns = 32);
+  ~GFXglyphCache(void);
+  const GFXglyphRun *get(const GFXfont *font, uint8_t glyph, uint8_t *count);
+  void clear(void);
+  void resetStats(void);
+  /**********************************************************************/
+  /*!
+    @brief    Get number of glyphs the cache can hold at once
+    @returns  Number of cache slots (0 if allocation failed)
+  */
+  /**********************************************************************/
+  uint8_t slots(void) const { return numSlots; }
+  /**********************************************************************/
+  /*!
+    @brief    Get number of get() calls served from the cache
+    @returns  Hit count since construction or last resetStats()
+  */
+  /**********************************************************************/
+  uint32_t hits(void) const { return hitCount; }
+  /**********************************************************************/
+  /*!
+    @brief    Get number of get() calls that had to decode from PROGMEM,
+              including those for glyphs too complex to cache
+    @returns  Miss count since construction or last resetStats()
+  */
+  /**********************************************************************/
+  uint32_t misses(void) const { return missCount; }
+
+private:
+  /// Per-slot header, followed in the pool by maxRuns GFXglyphRuns
+  typedef struct {
+    const GFXfont *font; ///< Font of cached glyph, NULL if slot is free
+    uint16_t lastUse;    ///< Value of 'clock' when slot was last used
+    uint8_t glyph;       ///< Glyph index within font (char - first)
+    uint8_t count;       ///< Number of runs
+  } Slot;
+  Slot *slot(uint8_t i) const { return (Slot *)&pool[i * slotBytes]; }
+  uint8_t *pool;
+  uint32_t hitCount, missCount;
+  uint16_t slotBytes, clock;
+  uint8_t numSlots, maxRuns;
 };
 
 /// A simple drawn button UI element
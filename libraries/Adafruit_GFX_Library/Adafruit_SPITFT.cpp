@@ -44,6 +44,17 @@
 #endif
 #endif
 
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+
+// Size of on-stack pixel span used by drawRLEBitmap(); runs at least this
+// long are issued with writeColor() instead of being copied into the span.
+#define RLE_SPAN_PIXELS 32
+
 #if defined(PORT_IOBUS)
 // On SAMD21, redefine digitalPinToPort() to use the slightly-faster
 // PORT_IOBUS rather than PORT (not needed on SAMD51).
@@ -1041,7 +1052,9 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
     (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
   if ((connection == TFT_HARD_SPI) || (connection == TFT_PARALLEL)) {
     int maxSpan = maxFillLen / 2; // One scanline max
-    uint8_t pixelBufIdx = 0;      // Active pixel buffer number
+    // pixelBufIdx (active pixel buffer number) persists across calls, so
+    // back-to-back non-blocking writes (e.g. from streamScanlines()) can
+    // fill one working buffer while the other is still being transferred.
 #if defined(__SAMD51__)
     if (connection == TFT_PARALLEL) {
       // Switch WR pin to PWM or CCL
@@ -1150,6 +1163,64 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
   }
 }
 
+/*!
+    @brief  Stream a rectangle of pixels to the display one scanline at a
+            time, calling a user function to render each line. Two line
+            buffers are used in alternation: while one line is being
+            issued to the display (non-blocking DMA where available), the
+            next is rendered into the other buffer, so the time per line
+            approaches the greater of the render and transfer times rather
+            than their sum. No full-frame buffer is required. Not self-
+            contained; should follow startWrite(). The last line is left
+            in flight on return, so the caller can get on with the next
+            frame while it goes out: another streamScanlines() call renders
+            its first line before waiting for it, and anything else must
+            call dmaWait() first, as with a non-blocking writePixels().
+            Where DMA is not enabled each line is simply rendered, then
+            written.
+    @param  x          Leftmost pixel of area to be drawn (MUST be within
+                       display bounds at current rotation setting).
+    @param  y          Topmost pixel of area to be drawn (MUST be within
+                       display bounds at current rotation setting).
+    @param  w          Width of area to be drawn, in pixels (MUST be >0 and,
+                       added to x, within display bounds).
+    @param  h          Height of area to be drawn, in pixels (MUST be >0
+                       and, added to y, within display bounds).
+    @param  lineBuf    Pointer to caller-allocated storage for TWO
+                       scanlines, i.e. at least w * 2 uint16_t elements.
+    @param  render     Function called once per row, in order from top to
+                       bottom, to fill a line buffer with 'w' pixels.
+    @param  userData   Opaque pointer passed through to render().
+    @param  bigEndian  If true, render() produces pixels already in the
+                       display's byte order. See writePixels() notes; with
+                       DMA this avoids a per-line byte-swap copy and lets
+                       the transfer read directly from lineBuf.
+*/
+void Adafruit_SPITFT::streamScanlines(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, uint16_t *lineBuf,
+                                      GFXscanlineCallback render,
+                                      void *userData, bool bigEndian) {
+  if ((w <= 0) || (h <= 0) || !lineBuf || !render)
+    return;
+
+  uint16_t *buf[2] = {lineBuf, &lineBuf[w]};
+  uint8_t bufIdx = streamBufIdx; // Not the one a prior call may still send
+
+  render(0, buf[bufIdx], w, userData); // Prime the pipeline with first line
+  dmaWait(); // Prior call's last line must finish before the window moves
+  setAddrWindow(x, y, w, h);
+  for (int16_t row = 0; row < h; row++) {
+    // Start this line's transfer without waiting for it to complete.
+    // writePixels() itself waits for the PRIOR line's transfer before
+    // starting this one, which is what protects the other buffer.
+    writePixels(buf[bufIdx], w, false, bigEndian);
+    bufIdx = 1 - bufIdx;
+    if ((row + 1) < h) // Render next line while this one is in flight
+      render(row + 1, buf[bufIdx], w, userData);
+  }
+  streamBufIdx = bufIdx; // Last line is still in flight from the other
+}
+
 /*!
     @brief  Wait for the last DMA transfer in a prior non-blocking
             writePixels() call to complete. This does nothing if DMA
@@ -1625,6 +1696,82 @@ inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
   writeColor(color, (uint32_t)w * h);
 }
 
+/*!
+    @brief  Draw a batch of same-colored spans from the filled-shape
+            rasterizer (fillTriangle(), fillCircle(), fillRoundRect()).
+            Not self-contained; should follow startWrite(). Each span is
+            clipped, then runs of spans that together form a rectangle
+            (same extent, on neighboring rows or columns) are merged and
+            issued as ONE address window and fill, instead of one window
+            per span. Where each span would otherwise be only a few pixels
+            long, the address window setup is most of the bus traffic, so
+            this can save a good deal on small or flat-sided shapes.
+    @param  spans     Array of spans (see GFXspan).
+    @param  count     Number of spans in array.
+    @param  vertical  true if spans are vertical, false if horizontal.
+    @param  color     16-bit fill color in '565' RGB format.
+*/
+void Adafruit_SPITFT::writeSpans(const GFXspan *spans, uint8_t count,
+                                 bool vertical, uint16_t color) {
+  int16_t rx = 0, ry = 0, rw = 0, rh = 0; // Pending merged rect (rw=0: none)
+
+  for (; count--; spans++) {
+    int16_t x = spans->x, y = spans->y, w, h;
+    if (vertical) {
+      w = 1;
+      h = spans->len;
+    } else {
+      w = spans->len;
+      h = 1;
+    }
+    // Clip (spans always have positive length, so this is simpler
+    // than in writeFillRect())
+    if ((x >= _width) || (y >= _height) || (x + w <= 0) || (y + h <= 0))
+      continue;
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    if (x + w > _width)
+      w = _width - x;
+    if (y + h > _height)
+      h = _height - y;
+
+    if (rw) { // Try to grow pending rect by this span
+      if ((y == ry) && (h == rh)) {
+        if (x == rx + rw) {
+          rw += w;
+          continue;
+        } else if (x + w == rx) {
+          rx = x;
+          rw += w;
+          continue;
+        }
+      } else if ((x == rx) && (w == rw)) {
+        if (y == ry + rh) {
+          rh += h;
+          continue;
+        } else if (y + h == ry) {
+          ry = y;
+          rh += h;
+          continue;
+        }
+      }
+      writeFillRectPreclipped(rx, ry, rw, rh, color);
+    }
+    rx = x;
+    ry = y;
+    rw = w;
+    rh = h;
+  }
+  if (rw)
+    writeFillRectPreclipped(rx, ry, rw, rh, color);
+}
+
 // -------------------------------------------------------------------------
 // Ever-so-slightly higher-level graphics operations. Similar to the 'write'
 // functions above, but these contain their own chip-select and SPI
@@ -1863,6 +2010,111 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors,
   endWrite();
 }
 
+/*!
+    @brief  Draw a PROGMEM-resident palette + RLE compressed image (see
+            gfxrlebitmap.h). Self-contained, handles its own transaction
+            and edge clipping. The image is decoded straight into a small
+            span buffer that is issued with writePixels(), while long runs
+            of a single color go out as writeColor() fills; a single
+            address window covers the whole (clipped) image, so there's no
+            per-pixel or per-run window setup and no full-size RGB565 copy
+            of the image is needed in flash or RAM.
+    @param  x       Horizontal position of first (top-left) pixel.
+    @param  y       Vertical position of first pixel.
+    @param  bitmap  Pointer to GFXrleBitmap struct.
+*/
+void Adafruit_SPITFT::drawRLEBitmap(int16_t x, int16_t y,
+                                    const GFXrleBitmap *bitmap) {
+  const uint8_t *data = pgm_read_rle_data_ptr(bitmap);
+  const uint16_t *palette = pgm_read_rle_palette_ptr(bitmap);
+  int16_t w = pgm_read_word(&bitmap->width), h = pgm_read_word(&bitmap->height);
+
+  int16_t x2, y2;                 // Lower-right coord
+  if ((x >= _width) ||            // Off-edge right
+      (y >= _height) ||           // " top
+      ((x2 = (x + w - 1)) < 0) || // " left
+      ((y2 = (y + h - 1)) < 0))
+    return; // " bottom
+
+  int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
+      saveW = w;            // Save original bitmap width value
+  if (x < 0) {              // Clip left
+    w += x;
+    bx1 = -x;
+    x = 0;
+  }
+  if (y < 0) { // Clip top
+    h += y;
+    by1 = -y;
+    y = 0;
+  }
+  if (x2 >= _width)
+    w = _width - x; // Clip right
+  if (y2 >= _height)
+    h = _height - y; // Clip bottom
+
+  // Rows above the clipped area must still be parsed to find where the
+  // first visible row starts; packets never span rows, so this is simply
+  // walking each row's packet headers without reading any colors.
+  for (int16_t j = 0; j < by1; j++) {
+    for (int16_t i = 0; i < saveW;) {
+      uint8_t hdr = pgm_read_byte(data++), n = (hdr & 0x7F) + 1;
+      data += (hdr & GFX_RLE_RUN) ? 1 : n;
+      i += n;
+    }
+  }
+
+  uint16_t span[RLE_SPAN_PIXELS];
+  uint8_t spanLen = 0;
+  int16_t bx2 = bx1 + w; // Right edge (exclusive) within bitmap
+
+  startWrite();
+  setAddrWindow(x, y, w, h); // Clipped area
+  while (h--) {              // For each (clipped) scanline...
+    for (int16_t i = 0; i < saveW;) {
+      uint8_t hdr = pgm_read_byte(data++), n = (hdr & 0x7F) + 1;
+      // Visible portion of this packet, in bitmap columns
+      int16_t c1 = (i > bx1) ? i : bx1, c2 = (i + n < bx2) ? i + n : bx2;
+      if (hdr & GFX_RLE_RUN) {
+        uint8_t idx = pgm_read_byte(data++);
+        if (c1 < c2) {
+          uint16_t color = pgm_read_word(&palette[idx]), count = c2 - c1;
+          if (count >= RLE_SPAN_PIXELS) {
+            if (spanLen) {
+              writePixels(span, spanLen);
+              spanLen = 0;
+            }
+            writeColor(color, count);
+          } else {
+            while (count--) {
+              span[spanLen++] = color;
+              if (spanLen == RLE_SPAN_PIXELS) {
+                writePixels(span, spanLen);
+                spanLen = 0;
+              }
+            }
+          }
+        }
+      } else {
+        for (int16_t c = i; c < i + n; c++) {
+          uint8_t idx = pgm_read_byte(data++);
+          if ((c >= c1) && (c < c2)) {
+            span[spanLen++] = pgm_read_word(&palette[idx]);
+            if (spanLen == RLE_SPAN_PIXELS) {
+              writePixels(span, spanLen);
+              spanLen = 0;
+            }
+          }
+        }
+      }
+      i += n;
+    }
+  }
+  if (spanLen)
+    writePixels(span, spanLen);
+  endWrite();
+}
+
 // -------------------------------------------------------------------------
 // Miscellaneous class member functions that don't draw anything.
 
@@ -102,6 +102,18 @@ typedef volatile ADAGFX_PORT_t *PORTreg_t; ///< PORT register type
 /*! For first arg to parallel constructor */
 enum tftBusWidth { tft8bitbus, tft16bitbus };
 
+/*!
+  @brief  Scanline render callback used by Adafruit_SPITFT::streamScanlines().
+  @param  row       Row number being requested, relative to the top of the
+                    streamed rectangle (0 to height-1).
+  @param  buf       Line buffer to fill, in '565' RGB format (byte order as
+                    requested in the streamScanlines() call).
+  @param  w         Number of pixels to fill in 'buf'.
+  @param  userData  Opaque pointer passed through from streamScanlines().
+*/
+typedef void (*GFXscanlineCallback)(int16_t row, uint16_t *buf, uint16_t w,
+                                    void *userData);
+
 // CLASS DEFINITION --------------------------------------------------------
 
 /*!
@@ -222,6 +234,8 @@ public:
                      uint16_t color);
   void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void writeSpans(const GFXspan *spans, uint8_t count, bool vertical,
+                  uint16_t color);
   // This is a new function, similar to writeFillRect() except that
   // all arguments MUST be onscreen, sorted and clipped. If higher-level
   // primitives can handle their own sorting/clipping, it avoids repeating
@@ -236,6 +250,15 @@ public:
   // user code, so it's public...
   bool dmaBusy(void) const; // true if DMA is used and busy, false otherwise
   void swapBytes(uint16_t *src, uint32_t len, uint16_t *dest = NULL);
+  // Scanline streaming: a callback renders each row of a rectangle into
+  // one of two caller-supplied line buffers while the other is being
+  // issued to the display (via DMA where available), so no full-frame
+  // buffer is needed and rendering overlaps the transfer. Like a
+  // non-blocking writePixels(), it follows startWrite() and returns with
+  // the last line in flight; call dmaWait() before endWrite().
+  void streamScanlines(int16_t x, int16_t y, int16_t w, int16_t h,
+                       uint16_t *lineBuf, GFXscanlineCallback render,
+                       void *userData = NULL, bool bigEndian = false);
 
   // These functions are similar to the 'write' functions above, but with
   // a chip-select and/or SPI transaction built-in. They're typically used
@@ -253,6 +276,7 @@ public:
   using Adafruit_GFX::drawRGBBitmap; // Check base class first
   void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w,
                      int16_t h);
+  void drawRLEBitmap(int16_t x, int16_t y, const GFXrleBitmap *bitmap);
 
   void invertDisplay(bool i);
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
@@ -495,6 +519,7 @@ protected:
   DmacDescriptor *dptr = NULL;       ///< 1st descriptor
   DmacDescriptor *descriptor = NULL; ///< Allocated descriptor list
   uint16_t *pixelBuf[2];             ///< Working buffers
+  uint8_t pixelBufIdx = 0;           ///< Next working buffer to fill
   uint16_t maxFillLen;               ///< Max pixels per DMA xfer
   uint16_t lastFillColor = 0;        ///< Last color used w/fill
   uint32_t lastFillLen = 0;          ///< # of pixels w/last fill
@@ -524,6 +549,8 @@ protected:
   uint8_t invertOffCommand = 0; ///< Command to disable invert mode
 
   uint32_t _freq = 0; ///< Dummy var to keep subclasses happy
+
+  uint8_t streamBufIdx = 0; ///< streamScanlines() line buffer to render next
 };
 
 #endif // end __AVR_ATtiny85__
@@ -0,0 +1,102 @@
+/***
+This example counts display bus transactions for the filled-shape
+primitives (fillCircle(), fillTriangle(), fillRoundRect()) drawn two ways:
+
+  * per-line: every span from the rasterizer is drawn as its own
+    writeFastHLine()/writeFastVLine(), each with its own address window.
+    This is the generic Adafruit_GFX::writeSpans() behavior.
+  * batched: Adafruit_SPITFT::writeSpans() merges neighboring spans that
+    form a rectangle and issues one address window per merged rectangle.
+
+An address window is the main fixed cost per span on SPI TFTs (around 11
+bytes of commands and arguments on ILI9341, before any pixels), so the
+window count per primitive is printed along with elapsed time.
+
+Uses an ILI9341 on hardware SPI but any Adafruit_SPITFT subclass works.
+***/
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_ILI9341.h>
+
+#define TFT_DC 9
+#define TFT_CS 10
+
+#define REPS 50 // Draws per measurement
+
+// Subclass that counts address windows and can fall back to the generic
+// per-span drawing for comparison.
+class CountingILI9341 : public Adafruit_ILI9341 {
+public:
+  CountingILI9341(int8_t cs, int8_t dc) : Adafruit_ILI9341(cs, dc) {}
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    windows++;
+    Adafruit_ILI9341::setAddrWindow(x, y, w, h);
+  }
+  void writeSpans(const GFXspan *spans, uint8_t count, bool vertical,
+                  uint16_t color) {
+    if (perLine)
+      Adafruit_GFX::writeSpans(spans, count, vertical, color);
+    else
+      Adafruit_SPITFT::writeSpans(spans, count, vertical, color);
+  }
+  uint32_t windows = 0;
+  bool perLine = false;
+};
+
+CountingILI9341 tft(TFT_CS, TFT_DC);
+
+uint32_t elapsed;
+
+uint32_t measure(uint8_t shape, bool perLine) {
+  tft.perLine = perLine;
+  tft.windows = 0;
+  uint32_t start = micros();
+  for (uint8_t i = 0; i < REPS; i++) {
+    uint16_t color = (i & 1) ? ILI9341_YELLOW : ILI9341_BLUE;
+    switch (shape) {
+    case 0:
+      tft.fillCircle(60, 60, 8, color);
+      break;
+    case 1:
+      tft.fillCircle(120, 160, 50, color);
+      break;
+    case 2:
+      tft.fillTriangle(20, 200, 110, 250, 40, 310, color);
+      break;
+    case 3:
+      tft.fillRoundRect(130, 20, 100, 60, 10, color);
+      break;
+    }
+  }
+  elapsed = micros() - start;
+  return tft.windows / REPS;
+}
+
+void report(const __FlashStringHelper *name, uint8_t shape) {
+  Serial.print(name);
+  Serial.print(measure(shape, true));
+  Serial.print(F("\t"));
+  Serial.print(elapsed / REPS);
+  Serial.print(F("\t"));
+  Serial.print(measure(shape, false));
+  Serial.print(F("\t"));
+  Serial.println(elapsed / REPS);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+
+  tft.begin();
+  tft.fillScreen(ILI9341_BLACK);
+
+  Serial.println(F("                      per-line        batched"));
+  Serial.println(F("Primitive             windows us      windows us"));
+  report(F("fillCircle r=8        "), 0);
+  report(F("fillCircle r=50       "), 1);
+  report(F("fillTriangle          "), 2);
+  report(F("fillRoundRect r=10    "), 3);
+}
+
+void loop() {}
@@ -0,0 +1,62 @@
+/***
+This example times redrawing HUD-style text (a score and a timer) in a
+custom GFXfont, with and without a GFXglyphCache attached.
+
+Without a cache, drawChar() walks every bit of the glyph bitmap out of
+PROGMEM on every draw. With a cache, the first draw of each glyph decodes
+it into horizontal runs and later draws replay those runs directly, which
+is the common case for text that is redrawn every frame.
+
+Text is drawn into a GFXcanvas16 so only the text rendering is measured,
+not the display bus. One cache serves every text size and color.
+***/
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+
+#define REPS 20 // Frames per measurement
+
+GFXcanvas16 canvas(160, 64);
+GFXglyphCache cache(2048); // Budget in bytes for cached glyphs
+
+uint32_t drawFrames(void) {
+  char text[12];
+  uint32_t start = micros();
+  for (uint8_t i = 0; i < REPS; i++) {
+    canvas.fillScreen(0);
+    canvas.setCursor(2, 24);
+    canvas.setTextColor(0xFFE0);
+    snprintf(text, sizeof(text), "%lu", 1234567UL + i * 25);
+    canvas.print(text);
+    canvas.setCursor(2, 56);
+    canvas.setTextColor(0x07FF);
+    snprintf(text, sizeof(text), "%02d:%02d", i / 60, i % 60);
+    canvas.print(text);
+  }
+  return (micros() - start) / REPS;
+}
+
+void setup(void) {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+
+  canvas.setFont(&FreeSansBold12pt7b);
+
+  Serial.print(F("Slots in cache: "));
+  Serial.println(cache.slots());
+
+  canvas.setGlyphCache(NULL);
+  Serial.print(F("Uncached us/frame: "));
+  Serial.println(drawFrames());
+
+  canvas.setGlyphCache(&cache);
+  Serial.print(F("Cached us/frame:   "));
+  Serial.println(drawFrames());
+  Serial.print(F("Hits: "));
+  Serial.print(cache.hits());
+  Serial.print(F(" Misses: "));
+  Serial.println(cache.misses());
+}
+
+void loop(void) {}
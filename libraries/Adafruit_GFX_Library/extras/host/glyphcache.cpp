@@ -0,0 +1,120 @@
+// Draws text in custom fonts on two GFXcanvas16s, one with a GFXglyphCache
+// attached and one without, and checks they match pixel for pixel: every
+// printable character, text sizes 1 to 3, and partly off the edges.  Then
+// checks the cache's hit and miss counts for repeated glyphs, for glyphs
+// with too many runs to cache, and for least-recently-used eviction.
+// Prints the number of failures and exits non-zero if there were any.
+//
+// Usage: glyphcache
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeMono24pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSerifBoldItalic12pt7b.h>
+
+#define WIDTH 240
+#define HEIGHT 160
+
+static int bad = 0;
+
+static void fail(const char *what, const char *text) {
+  if (bad++ < 20)
+    printf("%s: \"%s\"\n", what, text);
+}
+
+static GFXcanvas16 cached(WIDTH, HEIGHT), plain(WIDTH, HEIGHT);
+
+static void draw(GFXcanvas16 &c, const GFXfont *font, uint8_t size, int16_t x,
+                 int16_t y, const char *text) {
+  c.setFont(font);
+  c.setTextSize(size);
+  c.setTextColor(0xF81F);
+  c.setCursor(x, y);
+  c.print(text);
+}
+
+static void compare(const GFXfont *font, uint8_t size, int16_t x, int16_t y,
+                    const char *text) {
+  cached.fillScreen(0);
+  plain.fillScreen(0);
+  draw(cached, font, size, x, y, text);
+  draw(plain, font, size, x, y, text);
+  if (memcmp(cached.getBuffer(), plain.getBuffer(), WIDTH * HEIGHT * 2))
+    fail("cached text differs", text);
+}
+
+// draws text with the cache and checks the counts it adds
+static void counts(GFXglyphCache &cache, const char *text, uint32_t hits,
+                   uint32_t misses) {
+  cache.resetStats();
+  cached.setGlyphCache(&cache);
+  cached.fillScreen(0);
+  draw(cached, &FreeSans9pt7b, 1, 10, 30, text);
+  if (cache.hits() != hits || cache.misses() != misses) {
+    if (bad++ < 20)
+      printf("\"%s\": %u hits and %u misses, expected %u and %u\n", text,
+             (unsigned)cache.hits(), (unsigned)cache.misses(),
+             (unsigned)hits, (unsigned)misses);
+  }
+}
+
+int main(void) {
+  static const GFXfont *fonts[] = {&FreeSans9pt7b, &FreeSerifBoldItalic12pt7b,
+                                   &FreeMono24pt7b};
+  char all[96], *p = all;
+  for (char c = ' '; c <= '~'; c++)
+    *p++ = c;
+  *p = 0;
+
+  // small enough that glyphs are evicted and some too complex to cache
+  GFXglyphCache cache(2000);
+  cached.setGlyphCache(&cache);
+  for (const GFXfont *font : fonts)
+    for (uint8_t size = 1; size <= 3; size++) {
+      for (const char *s = all; *s; s += 8) {
+        char text[9];
+        snprintf(text, sizeof(text), "%.8s", s);
+        compare(font, size, 5, 60, text);
+        compare(font, size, 5, 60, text); // again, now from the cache
+      }
+      compare(font, size, -7, 10, "Wg"); // over the top and left edges
+      compare(font, size, WIDTH - 20, HEIGHT - 2, "Qj"); // bottom and right
+    }
+  if (!cache.hits() || !cache.misses())
+    fail("cache not used", all);
+
+  // every glyph fits in a cache this size
+  GFXglyphCache big(8000, 254);
+  counts(big, "Hello", 1, 4);
+  counts(big, "Hello", 5, 0);
+  counts(big, "olleH", 5, 0);
+
+  // runs are per row, so a glyph taller than one row never fits one run
+  GFXglyphCache narrow(2000, 1);
+  counts(narrow, "HH", 0, 2);
+
+  // maxRuns over the limit is clamped, and the slots sized to match
+  for (uint16_t bytes = 500; bytes < 8000; bytes += 97) {
+    GFXglyphCache a(bytes, 255), b(bytes, 254);
+    if (a.slots() != b.slots())
+      fail("slots differ for 255 and 254 runs", "");
+  }
+
+  // a cache of two slots keeps the two most recently used glyphs
+  uint16_t bytes = 1;
+  for (;; bytes++) {
+    GFXglyphCache probe(bytes);
+    if (probe.slots() == 2)
+      break;
+  }
+  GFXglyphCache two(bytes);
+  counts(two, "abab", 2, 2);
+  counts(two, "c", 0, 1); // evicts a
+  counts(two, "b", 1, 0);
+  counts(two, "a", 0, 1); // evicts c
+  counts(two, "b", 1, 0);
+  two.clear();
+  counts(two, "b", 0, 1);
+
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
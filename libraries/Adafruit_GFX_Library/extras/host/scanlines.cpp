@@ -0,0 +1,346 @@
+// Runs Adafruit_SPITFT::streamScanlines() against a simulated SAMD DMA
+// engine.  The engine runs in its own thread: startJob() hands it the
+// descriptor chain, it takes a random time to "send" the bytes into a
+// frame buffer, then calls the DMA callback as the real interrupt would.
+//
+// Checks that render() is never given a buffer the engine is reading,
+// that no buffer changes while it is being sent, that the address window
+// never moves with a line in flight, and that every pixel lands where it
+// should.  Then, holding the engine, checks that streamScanlines() returns
+// with its last line still in flight and that the next call renders its
+// first line into the other buffer before waiting for it.
+//
+// Last, it times a frame on a simulated clock, where each render() and each
+// DMA job take a set time, and prints the time per line, which is the
+// greater of the two rather than their sum if they overlap.  Exits non-zero
+// on a failure.
+//
+// Usage: scanlines [frames]
+#include <atomic>
+#include <chrono> // before Arduino.h defines min and max
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Adafruit_SPITFT.h>
+
+#define WIDTH 320
+#define HEIGHT 240
+
+SPIClass SPI;
+SERCOM sercom0;
+HostSercom hostSercom0;
+unsigned long millis(void) { return 0; }
+unsigned long micros(void) { return 0; }
+void delay(unsigned long) {}
+void yield(void) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return 0; }
+
+static std::atomic<int> bad(0);
+
+static void fail(const char *what) {
+  if (bad++ < 20)
+    printf("%s\n", what);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+// wait without sleeping, so short delays are close to what was asked
+static void spin(unsigned us) {
+  Clock::time_point end = Clock::now() + std::chrono::microseconds(us);
+  while (Clock::now() < end)
+    ;
+}
+
+//------------------------------------------------------------------------------
+// the display: an address window and a frame buffer the engine writes to
+static uint16_t frame[HEIGHT][WIDTH];
+static struct {
+  int x, y, w, h, col, row;
+} window;
+
+static void displayPixel(uint16_t p) {
+  if (window.row >= window.h) {
+    fail("more pixels than the window holds");
+    return;
+  }
+  frame[window.y + window.row][window.x + window.col] = p;
+  if (++window.col == window.w) {
+    window.col = 0;
+    window.row++;
+  }
+}
+
+//------------------------------------------------------------------------------
+// the DMA engine
+struct Region {
+  const uint8_t *p;
+  size_t n;
+};
+
+static struct {
+  std::mutex m;
+  std::condition_variable cv;
+  Adafruit_ZeroDMA *dma = NULL;
+  bool pending = false; // a job is started and not done
+  bool hold = false;    // don't finish jobs until this is cleared
+  bool quit = false;
+  std::vector<Region> regions;  // what the job reads
+  std::vector<uint8_t> initial; // and what it held when the job started
+  unsigned maxUs = 0;           // longest real time a job takes
+  unsigned seed = 1;            // for the engine's own rand_r()
+  unsigned long jobs = 0;
+} engine;
+
+// the simulated clock, only used from the main thread
+static struct {
+  double now = 0;     // time the CPU has got to
+  double done = 0;    // time the last job finishes
+  double jobUs = 0;   // time a job takes
+  double renderUs = 0; // time render() takes
+} sim;
+
+void hostDmaStart(Adafruit_ZeroDMA *dma) {
+  std::lock_guard<std::mutex> lock(engine.m);
+  if (engine.pending)
+    fail("job started with another in flight");
+  engine.dma = dma;
+  engine.regions.clear();
+  engine.initial.clear();
+  for (DmacDescriptor *d = &dma->first; d;
+       d = (DmacDescriptor *)(uintptr_t)d->DESCADDR.reg) {
+    // SRCADDR is the end of the block when the source increments
+    Region r = {(const uint8_t *)(uintptr_t)(d->SRCADDR.reg - d->BTCNT.reg),
+                d->BTCNT.reg};
+    engine.regions.push_back(r);
+    engine.initial.insert(engine.initial.end(), r.p, r.p + r.n);
+  }
+  engine.pending = true;
+  engine.jobs++;
+  // the job can't start before the last one is done, which the library
+  // waited for before starting this one
+  if (sim.now < sim.done)
+    sim.now = sim.done;
+  sim.done = sim.now + sim.jobUs;
+  engine.cv.notify_all();
+}
+
+static void engineRun(void) {
+  std::unique_lock<std::mutex> lock(engine.m);
+  for (;;) {
+    // a held job is let go after a second, so a library that waits for
+    // it fails rather than hangs
+    if (!engine.cv.wait_for(lock, std::chrono::seconds(1), [] {
+          return engine.quit || (engine.pending && !engine.hold);
+        }) &&
+        engine.pending) {
+      fail("waited for a line that should have been left in flight");
+      engine.hold = false;
+    }
+    if (engine.quit)
+      return;
+    if (!engine.pending || engine.hold)
+      continue;
+    unsigned us = engine.maxUs ? rand_r(&engine.seed) % engine.maxUs : 0;
+    lock.unlock();
+    spin(us);
+    lock.lock();
+    size_t i = 0;
+    bool changed = false;
+    for (const Region &r : engine.regions)
+      for (size_t k = 0; k < r.n; k++)
+        changed |= r.p[k] != engine.initial[i++];
+    if (changed)
+      fail("buffer changed while it was being sent");
+    for (const Region &r : engine.regions)
+      for (size_t k = 0; k + 1 < r.n; k += 2)
+        displayPixel(r.p[k] << 8 | r.p[k + 1]); // big-endian on the wire
+    engine.pending = false;
+    lock.unlock();
+    engine.dma->complete(); // clears dma_busy
+    lock.lock();
+  }
+}
+
+static bool inFlight(const void *p, size_t n) {
+  std::lock_guard<std::mutex> lock(engine.m);
+  if (!engine.pending)
+    return false;
+  const uint8_t *a = (const uint8_t *)p;
+  for (const Region &r : engine.regions)
+    if (a < r.p + r.n && r.p < a + n)
+      return true;
+  return false;
+}
+
+static bool engineBusy(void) {
+  std::lock_guard<std::mutex> lock(engine.m);
+  return engine.pending;
+}
+
+static void engineHold(bool hold) {
+  std::lock_guard<std::mutex> lock(engine.m);
+  engine.hold = hold;
+  engine.cv.notify_all();
+}
+
+//------------------------------------------------------------------------------
+class HostTFT : public Adafruit_SPITFT {
+public:
+  HostTFT(void) : Adafruit_SPITFT(WIDTH, HEIGHT, 10, 9) {}
+  void begin(uint32_t freq) { initSPI(freq); }
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (engineBusy())
+      fail("address window moved with a line in flight");
+    window.x = x;
+    window.y = y;
+    window.w = w;
+    window.h = h;
+    window.col = window.row = 0;
+  }
+};
+
+// static, so it is below 4 GB like the heap with -no-pie
+static uint16_t lineBuf[2 * WIDTH];
+
+static uint16_t pixel(int f, int row, int col) {
+  return (f * 7919 + row * 331 + col * 17) ^ (row << 9);
+}
+
+struct Job {
+  int frame;
+  bool bigEndian;
+  unsigned maxRenderUs;
+  uint16_t *firstBuf; // where row 0 was rendered
+  bool firstInFlight; // the engine was busy when row 0 was rendered
+  void (*onFirst)(void);
+};
+
+static void render(int16_t row, uint16_t *buf, uint16_t w, void *userData) {
+  Job *job = (Job *)userData;
+  if (buf != lineBuf && buf != lineBuf + w)
+    fail("render() given a buffer that is not one of the two lines");
+  if (inFlight(buf, w * 2))
+    fail("render() given the buffer in flight");
+  if (row == 0) {
+    job->firstBuf = buf;
+    job->firstInFlight = engineBusy();
+    if (job->onFirst)
+      job->onFirst();
+  }
+  for (uint16_t i = 0; i < w; i++) {
+    uint16_t p = pixel(job->frame, row, i);
+    buf[i] = job->bigEndian ? __builtin_bswap16(p) : p;
+  }
+  if (job->maxRenderUs)
+    spin(rand() % job->maxRenderUs);
+  sim.now += sim.renderUs;
+}
+
+static void checkRect(int f, int x, int y, int w, int h) {
+  for (int row = 0; row < h; row++)
+    for (int i = 0; i < w; i++)
+      if (frame[y + row][x + i] != pixel(f, row, i)) {
+        fail("wrong pixel on the display");
+        return;
+      }
+}
+
+static void releaseEngine(void) { engineHold(false); }
+
+int main(int argc, char **argv) {
+  int frames = argc > 1 ? atoi(argv[1]) : 500;
+  void *heap = malloc(16);
+  if ((uintptr_t)heap >> 32 || (uintptr_t)lineBuf >> 32) {
+    printf("buffers above 4 GB, build with -no-pie\n");
+    return 1;
+  }
+  free(heap);
+  std::thread worker(engineRun);
+  HostTFT tft;
+  tft.begin(0);
+  srand(1);
+
+  // random rectangles, byte orders and timings, sometimes two calls back
+  // to back without a dmaWait() between them
+  unsigned long lines = 0;
+  engine.maxUs = 20;
+  for (int f = 0; f < frames; f++) {
+    int w = 1 + rand() % WIDTH, h = 1 + rand() % HEIGHT;
+    int x = rand() % (WIDTH - w + 1), y = rand() % (HEIGHT - h + 1);
+    Job job = {f, rand() % 2 == 0, (unsigned)(rand() % 2 ? 20 : 0)};
+    tft.startWrite();
+    tft.streamScanlines(x, y, w, h, lineBuf, render, &job, job.bigEndian);
+    lines += h;
+    if (rand() % 2) {
+      int y2 = (y + h) % HEIGHT, h2 = 1 + rand() % (HEIGHT - y2);
+      Job next = {f + frames, rand() % 2 == 0, 0};
+      tft.streamScanlines(x, y2, w, h2, lineBuf, render, &next,
+                          next.bigEndian);
+      lines += h2;
+      tft.dmaWait();
+      if (y2 >= y + h || y2 + h2 <= y) // the second didn't draw over the first
+        checkRect(f, x, y, w, h);
+      checkRect(f + frames, x, y2, w, h2);
+    } else {
+      tft.dmaWait();
+      checkRect(f, x, y, w, h);
+    }
+    tft.endWrite();
+  }
+  if (engine.jobs != lines)
+    fail("not one DMA job per line");
+
+  // with the engine held, the last line must still be in flight on return,
+  // and the next call must render into the other buffer before waiting
+  engine.maxUs = 0;
+  for (int bigEndian = 0; bigEndian < 2; bigEndian++) {
+    Job first = {1000000 + bigEndian, bigEndian != 0, 0};
+    Job second = {2000000 + bigEndian, bigEndian != 0, 0, NULL, false,
+                  releaseEngine};
+    engineHold(true);
+    tft.startWrite();
+    tft.streamScanlines(10, 20, 100, 1, lineBuf, render, &first, bigEndian);
+    if (!engineBusy())
+      fail("last line not left in flight");
+    if (bigEndian && !inFlight(first.firstBuf, 200))
+      fail("line in flight is not the one just rendered");
+    if (frame[20][10] == pixel(first.frame, 0, 0))
+      fail("last line reached the display with the engine held");
+    tft.streamScanlines(10, 30, 100, 5, lineBuf, render, &second, bigEndian);
+    if (!second.firstInFlight)
+      fail("next call waited before rendering its first line");
+    if (second.firstBuf == first.firstBuf)
+      fail("next call rendered into the buffer in flight");
+    tft.dmaWait();
+    tft.endWrite();
+    checkRect(first.frame, 10, 20, 100, 1);
+    checkRect(second.frame, 10, 30, 100, 5);
+  }
+
+  // how long a line takes on the simulated clock
+  sim.jobUs = 100;
+  sim.renderUs = 100;
+  sim.now = sim.done = 0;
+  Job timed = {3000000, true, 0};
+  tft.startWrite();
+  tft.streamScanlines(0, 0, WIDTH, 100, lineBuf, render, &timed, true);
+  tft.dmaWait();
+  tft.endWrite();
+  checkRect(timed.frame, 0, 0, WIDTH, 100);
+  printf("%d frames, %lu lines; with 100 us render() and 100 us DMA a line "
+         "takes %.0f us\n",
+         frames, lines, (sim.now > sim.done ? sim.now : sim.done) / 100);
+
+  {
+    std::lock_guard<std::mutex> lock(engine.m);
+    engine.quit = true;
+    engine.cv.notify_all();
+  }
+  worker.join();
+  printf("%d bad\n", bad.load());
+  return bad != 0;
+}
@@ -0,0 +1,119 @@
+// Counts the bus traffic of the filled shapes on an Adafruit_SPITFT, with
+// writeSpans() merging adjacent spans into one address window and fill
+// ("after") and with the base class drawing one line per span ("before").
+// Every address window is also marked in a coverage map, which must match
+// the same shape drawn on a GFXcanvas16 with each pixel drawn once.
+//
+// Bytes are counted as an ILI9341 would take them: 11 for an address window
+// (three commands and eight bytes of coordinates) and 2 per pixel.  Prints
+// a line per shape and exits non-zero if any coverage differs.
+//
+// Usage: spans
+#include <Adafruit_SPITFT.h>
+
+#define WIDTH 320
+#define HEIGHT 240
+#define WINDOW_BYTES 11
+
+SPIClass SPI;
+unsigned long millis(void) { return 0; }
+unsigned long micros(void) { return 0; }
+void delay(unsigned long) {}
+void yield(void) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return 0; }
+
+static int bad = 0;
+static uint8_t drawn[HEIGHT][WIDTH]; // times each pixel was in a window
+
+class HostTFT : public Adafruit_SPITFT {
+public:
+  HostTFT(void) : Adafruit_SPITFT(WIDTH, HEIGHT, 10, 9) {}
+  void begin(uint32_t freq) { initSPI(freq); }
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    windows++;
+    pixels += (unsigned long)w * h;
+    for (int r = y; r < y + h; r++)
+      for (int c = x; c < x + w; c++)
+        drawn[r][c]++;
+  }
+  void writeSpans(const GFXspan *spans, uint8_t count, bool vertical,
+                  uint16_t color) {
+    if (merge)
+      Adafruit_SPITFT::writeSpans(spans, count, vertical, color);
+    else
+      Adafruit_GFX::writeSpans(spans, count, vertical, color);
+  }
+  bool merge = true;
+  unsigned long windows = 0, pixels = 0;
+};
+
+struct Shape {
+  const char *name;
+  void (*draw)(Adafruit_GFX &gfx, int i);
+};
+
+static void circle(Adafruit_GFX &gfx, int i) {
+  gfx.fillCircle(160, 120, 2 + i % 100, 0xFFFF);
+}
+
+static void roundRect(Adafruit_GFX &gfx, int i) {
+  gfx.fillRoundRect(10 + i % 50, 5 + i % 30, 60 + i % 200, 40 + i % 150,
+                    2 + i % 20, 0xFFFF);
+}
+
+static void triangle(Adafruit_GFX &gfx, int i) {
+  srand(i);
+  gfx.fillTriangle(rand() % WIDTH, rand() % HEIGHT, rand() % WIDTH,
+                   rand() % HEIGHT, rand() % WIDTH, rand() % HEIGHT, 0xFFFF);
+}
+
+// what the shape drew on the display against a canvas
+static void compare(const char *name, Shape &shape, int i) {
+  static GFXcanvas16 canvas(WIDTH, HEIGHT);
+  canvas.fillScreen(0);
+  shape.draw(canvas, i);
+  uint16_t *buf = canvas.getBuffer();
+  for (int r = 0; r < HEIGHT; r++)
+    for (int c = 0; c < WIDTH; c++)
+      if (drawn[r][c] != (buf[r * WIDTH + c] ? 1 : 0)) {
+        if (bad++ < 20)
+          printf("%s %s %d: pixel %d,%d drawn %d times\n", name, shape.name,
+                 i, c, r, drawn[r][c]);
+        return;
+      }
+}
+
+int main(void) {
+  static Shape shapes[] = {
+      {"fillCircle", circle},
+      {"fillRoundRect", roundRect},
+      {"fillTriangle", triangle},
+  };
+  const int count = 200;
+  HostTFT tft;
+  tft.begin(0);
+
+  printf("%-14s %10s %10s %12s %12s\n", "", "windows", "", "bytes", "");
+  printf("%-14s %10s %10s %12s %12s\n", "", "before", "after", "before",
+         "after");
+  for (Shape &shape : shapes) {
+    unsigned long windows[2], bytes[2];
+    for (int merge = 0; merge < 2; merge++) {
+      tft.merge = merge;
+      tft.windows = tft.pixels = 0;
+      for (int i = 0; i < count; i++) {
+        memset(drawn, 0, sizeof(drawn));
+        shape.draw(tft, i);
+        compare(merge ? "after" : "before", shape, i);
+      }
+      windows[merge] = tft.windows;
+      bytes[merge] = tft.windows * WINDOW_BYTES + tft.pixels * 2;
+    }
+    printf("%-14s %10lu %10lu %12lu %12lu\n", shape.name, windows[0],
+           windows[1], bytes[0], bytes[1]);
+  }
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
@@ -0,0 +1,4 @@
+// The GFX core includes this but only Adafruit_GrayOLED uses it
+#ifndef Adafruit_I2CDevice_h
+#define Adafruit_I2CDevice_h
+#endif // Adafruit_I2CDevice_h
@@ -0,0 +1,5 @@
+// The GFX core includes this but only Adafruit_GrayOLED uses it
+#ifndef Adafruit_SPIDevice_h
+#define Adafruit_SPIDevice_h
+#include <SPI.h>
+#endif // Adafruit_SPIDevice_h
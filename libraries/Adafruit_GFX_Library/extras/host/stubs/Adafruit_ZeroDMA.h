@@ -0,0 +1,80 @@
+// Adafruit_ZeroDMA with a simulated DMA engine behind it.  startJob()
+// hands the descriptor chain to the test's hostDmaStart(), which copies the
+// bytes to the display at some later time and then calls complete().
+// Addresses in descriptors are 32 bits, as on the SAMD, so the buffers must
+// be in the lower 4 GB: build with -no-pie and keep them in the heap or
+// in static storage.
+#ifndef _ADAFRUIT_ZERODMA_H_
+#define _ADAFRUIT_ZERODMA_H_
+#include "Arduino.h"
+
+typedef struct {
+  union {
+    struct {
+      uint16_t VALID : 1;
+      uint16_t EVOSEL : 2;
+      uint16_t BLOCKACT : 2;
+      uint16_t : 3;
+      uint16_t BEATSIZE : 2;
+      uint16_t SRCINC : 1;
+      uint16_t DSTINC : 1;
+      uint16_t STEPSEL : 1;
+      uint16_t STEPSIZE : 3;
+    } bit;
+    uint16_t reg;
+  } BTCTRL;
+  struct {
+    uint16_t reg;
+  } BTCNT;
+  struct {
+    uint32_t reg;
+  } SRCADDR;
+  struct {
+    uint32_t reg;
+  } DSTADDR;
+  struct {
+    uint32_t reg;
+  } DESCADDR;
+} DmacDescriptor;
+
+typedef enum { DMA_STATUS_OK = 0, DMA_STATUS_ERR_NOT_FOUND } ZeroDMAstatus;
+#define DMA_BEAT_SIZE_BYTE 0
+#define DMA_BEAT_SIZE_HWORD 1
+#define DMA_PRIORITY_3 3
+#define DMA_TRIGGER_ACTON_BEAT 2
+#define DMA_EVENT_OUTPUT_DISABLE 0
+#define DMA_BLOCK_ACTION_NOACT 0
+#define DMA_STEPSEL_SRC 1
+#define DMA_ADDRESS_INCREMENT_STEP_SIZE_1 0
+
+class Adafruit_ZeroDMA;
+void hostDmaStart(Adafruit_ZeroDMA *dma); // in the test
+
+class Adafruit_ZeroDMA {
+public:
+  ZeroDMAstatus allocate(void) { return DMA_STATUS_OK; }
+  ZeroDMAstatus free(void) { return DMA_STATUS_OK; }
+  DmacDescriptor *addDescriptor(void *, void *, uint32_t, int, bool, bool) {
+    return &first;
+  }
+  void setPriority(int) {}
+  void setTrigger(int) {}
+  void setAction(int) {}
+  void setCallback(void (*cb)(Adafruit_ZeroDMA *)) { callback = cb; }
+  int getChannel(void) { return 0; }
+  ZeroDMAstatus startJob(void) {
+    hostDmaStart(this);
+    return DMA_STATUS_OK;
+  }
+  void trigger(void) {}
+  /// Called by the simulated engine when a job is done
+  void complete(void) {
+    if (callback)
+      callback(this);
+  }
+  DmacDescriptor first; ///< the one descriptor the job starts from
+
+private:
+  void (*callback)(Adafruit_ZeroDMA *) = NULL;
+};
+#endif // _ADAFRUIT_ZERODMA_H_
@@ -0,0 +1,55 @@
+// SPI that counts transactions and bytes instead of sending them.  With
+// ARDUINO_SAMD_ZERO there is also just enough of a SERCOM for the DMA set
+// up in Adafruit_SPITFT::initSPI() to find its data register.
+#ifndef SPI_h
+#define SPI_h
+#include "Arduino.h"
+#define SPI_HAS_TRANSACTION
+#define SPI_MODE0 0x02
+#define SPI_MODE1 0x00
+#define SPI_MODE2 0x03
+#define SPI_MODE3 0x01
+#define SPI_CLOCK_DIV2 2
+
+#if defined(ARDUINO_SAMD_ZERO)
+struct HostSercom {
+  struct {
+    struct {
+      uint32_t reg;
+    } DATA;
+  } SPI;
+};
+class SERCOM {};
+extern SERCOM sercom0;
+extern HostSercom hostSercom0;
+#define SERCOM0 (&hostSercom0)
+#define SERCOM0_DMAC_ID_TX 2
+#endif
+
+class SPISettings {
+public:
+  SPISettings(void) {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+#if defined(ARDUINO_SAMD_ZERO)
+  SERCOM *sercom = &sercom0; // initSPI() reads this first word
+#endif
+  void begin(void) {}
+  void beginTransaction(SPISettings) { transactions++; }
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t) {
+    bytes++;
+    return 0;
+  }
+  void transfer(void *, size_t n) { bytes += n; }
+  void setBitOrder(uint8_t) {}
+  void setDataMode(uint8_t) {}
+  void setClockDivider(uint8_t) {}
+  unsigned long transactions = 0; ///< beginTransaction() calls
+  unsigned long bytes = 0;        ///< bytes sent with transfer()
+};
+extern SPIClass SPI;
+#endif // SPI_h
@@ -0,0 +1,9 @@
+// memalign() without the host's malloc.h, which the stubs dir would hide
+#ifndef host_malloc_h
+#define host_malloc_h
+#include <stdlib.h>
+inline void *memalign(size_t align, size_t size) {
+  void *p = NULL;
+  return posix_memalign(&p, align, size) ? NULL : p;
+}
+#endif // host_malloc_h
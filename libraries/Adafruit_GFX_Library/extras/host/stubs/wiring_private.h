@@ -0,0 +1,7 @@
+#ifndef wiring_private_h
+#define wiring_private_h
+#include "Arduino.h"
+#define PIO_OUTPUT 1
+#define PIO_CCL 2
+inline void pinPeripheral(uint8_t, uint8_t) {}
+#endif // wiring_private_h
@@ -0,0 +1,28 @@
+// Compressed image structure for Adafruit_GFX drawRLEBitmap().
+// Images are palette-indexed (up to 256 RGB565 colors) and run-length
+// encoded row by row; see 'rleconvert' folder for a tool to generate
+// these from PNG/BMP files or existing RGB565 .h arrays. To use an image
+// in your Arduino sketch, #include the generated .h file and pass the
+// address of its GFXrleBitmap struct to drawRLEBitmap().
+//
+// Encoded data is a sequence of packets, each starting with a header
+// byte. If bit 7 is set, the packet is a RUN: (header & 0x7F) + 1 pixels
+// of the single palette index in the following byte. If bit 7 is clear,
+// it is a LITERAL: (header + 1) palette index bytes follow, one per pixel.
+// Packets never span rows, so each row begins on a packet boundary.
+
+#ifndef _GFXRLEBITMAP_H_
+#define _GFXRLEBITMAP_H_
+
+#define GFX_RLE_RUN 0x80     ///< Packet header flag for a run of one color
+#define GFX_RLE_MAXPACKET 128 ///< Max pixels in one run or literal packet
+
+/// Data stored for a palette + RLE compressed image
+typedef struct {
+  uint8_t *data;     ///< RLE packets, all rows concatenated
+  uint16_t *palette; ///< RGB565 color table (up to 256 entries)
+  uint16_t width;    ///< Image dimensions in pixels
+  uint16_t height;   ///< Image dimensions in pixels
+} GFXrleBitmap;
+
+#endif // _GFXRLEBITMAP_H_
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+
+# Converts an image to the palette + RLE compressed format used by
+# Adafruit_GFX drawRLEBitmap() (see gfxrlebitmap.h for a description of
+# the encoding), writing a .h file to stdout.
+#
+# Input may be any image file Pillow can open (PNG, BMP, GIF, ...), or an
+# existing .h file containing a raw RGB565 array such as those made with
+# GIMP or the pictureEmbed example. For .h input the width is taken from a
+# '#define SOMETHING_WIDTH' line if present, else use --width.
+#
+# Usage: rleconvert.py [--name NAME] [--width W] <image-or-header> > out.h
+#
+# Images with more than 256 distinct colors are reduced to 256 (Pillow
+# required). The encoded data is decoded again and compared against the
+# source pixels before anything is written, so a .h produced by this
+# script always round-trips exactly.
+
+import argparse
+import os
+import re
+import sys
+
+RUN = 0x80
+MAXPACKET = 128
+
+
+def load_header(path, width):
+    text = open(path).read()
+    if width is None:
+        m = re.search(r"#define\s+\w*WIDTH\s+(\d+)", text)
+        if not m:
+            sys.exit("rleconvert: can't find width in %s, use --width" % path)
+        width = int(m.group(1))
+    body = text[text.index("{") + 1 : text.rindex("}")]
+    pixels = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]+", body)]
+    if len(pixels) % width:
+        sys.exit("rleconvert: %d pixels is not a multiple of width %d" %
+                 (len(pixels), width))
+    return width, len(pixels) // width, pixels
+
+
+def load_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("rleconvert: Pillow is required for image input")
+    img = Image.open(path).convert("RGB")
+    if len(img.getcolors(1 << 24)) > 256:
+        img = img.quantize(256).convert("RGB")
+    pixels = [((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+              for (r, g, b) in img.getdata()]
+    return img.width, img.height, pixels
+
+
+def encode_row(row):
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAXPACKET]
+            del literal[:MAXPACKET]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(row):
+        n = 1
+        while (i + n < len(row) and row[i + n] == row[i] and
+               n < MAXPACKET):
+            n += 1
+        # A 2-pixel run only pays off if it doesn't split a literal
+        if n >= 3 or (n == 2 and not literal):
+            flush_literal()
+            out.extend((RUN | (n - 1), row[i]))
+        else:
+            literal.extend(row[i:i + n])
+        i += n
+    flush_literal()
+    return out
+
+
+def decode(data, width, height):
+    indices, pos = [], 0
+    for _ in range(height):
+        col = 0
+        while col < width:
+            hdr = data[pos]
+            n = (hdr & 0x7F) + 1
+            if hdr & RUN:
+                indices.extend([data[pos + 1]] * n)
+                pos += 2
+            else:
+                indices.extend(data[pos + 1:pos + 1 + n])
+                pos += 1 + n
+            col += n
+        if col != width:
+            raise ValueError("packet crosses row boundary")
+    return indices
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v
+                                        for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("input")
+    parser.add_argument("--name", help="C identifier prefix")
+    parser.add_argument("--width", type=int,
+                        help="image width, for .h input only")
+    args = parser.parse_args()
+
+    base = os.path.splitext(os.path.basename(args.input))[0]
+    name = args.name or re.sub(r"\W", "_", base)
+    if args.input.lower().endswith(".h"):
+        width, height, pixels = load_header(args.input, args.width)
+    else:
+        width, height, pixels = load_image(args.input)
+
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        sys.exit("rleconvert: %d colors, max is 256" % len(palette))
+    lookup = {c: i for i, c in enumerate(palette)}
+    indices = [lookup[p] for p in pixels]
+
+    data = []
+    for y in range(height):
+        data.extend(encode_row(indices[y * width:(y + 1) * width]))
+    if decode(data, width, height) != indices:
+        sys.exit("rleconvert: internal error, encoding does not round-trip")
+
+    raw = width * height * 2
+    packed = len(data) + len(palette) * 2
+    print("// Generated by rleconvert.py from %s" % os.path.basename(args.input))
+    print("// %dx%d pixels, %d colors. %d bytes as raw RGB565, %d bytes RLE"
+          " (%.1f%%)" % (width, height, len(palette), raw, packed,
+                         100.0 * packed / raw))
+    print()
+    print("const uint8_t %sData[] PROGMEM = {" % name)
+    print(c_array(data, "0x%02X", 12) + "};")
+    print()
+    print("const uint16_t %sPalette[] PROGMEM = {" % name)
+    print(c_array(palette, "0x%04X", 9) + "};")
+    print()
+    print("const GFXrleBitmap %s PROGMEM = {" % name)
+    print("    (uint8_t *)%sData, (uint16_t *)%sPalette, %d, %d};"
+          % (name, name, width, height))
+
+
+if __name__ == "__main__":
+    main()
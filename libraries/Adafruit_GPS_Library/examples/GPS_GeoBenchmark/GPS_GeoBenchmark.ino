@@ -0,0 +1,114 @@
+// Benchmark for the fixed point distance, bearing and geofence checks, no
+// GPS needed.
+//
+// Times geoDistance() and geoBearing() against the usual floating point
+// haversine formula, then checks random positions against the fences in
+// fences.h, once with the grid and once by testing every polygon, and
+// prints the checks per second. With a GPS, pass GPS.latitude_fixed and
+// GPS.longitude_fixed to the same functions.
+//
+// fences.h was made from fences.txt by fencegrid/fencegrid.py in the
+// library folder. Make your own from a GeoJSON file or a list of points.
+
+#include <Adafruit_GPS.h>
+#include <NMEA_geo.h>
+
+#include "fences.h"
+
+#define CHECKS 200 // small enough for the RAM of an Uno
+
+// home, as a waypoint to measure from
+const int32_t homeLat = 407000000, homeLon = -740000000;
+
+float haversine(float lat1, float lon1, float lat2, float lon2) {
+  float dLat = (lat2 - lat1) * DEG_TO_RAD / 2;
+  float dLon = (lon2 - lon1) * DEG_TO_RAD / 2;
+  float a = sin(dLat) * sin(dLat) + cos(lat1 * DEG_TO_RAD) *
+                                        cos(lat2 * DEG_TO_RAD) * sin(dLon) *
+                                        sin(dLon);
+  return 2 * 6371008.8 * asin(sqrt(a));
+}
+
+int32_t randomLat() { return 405400000 + random(4500000); }
+int32_t randomLon() { return -741500000 + random(4000000); }
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+  Serial.println("Adafruit GPS geodesy benchmark");
+}
+
+void loop() {
+  // the same random positions for each test
+  static int32_t lats[CHECKS], lons[CHECKS];
+  for (uint16_t i = 0; i < CHECKS; i++) {
+    lats[i] = randomLat();
+    lons[i] = randomLon();
+  }
+
+  uint32_t sum = 0;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < CHECKS; i++)
+    sum += geoDistance(homeLat, homeLon, lats[i], lons[i]);
+  uint32_t fixedTime = micros() - start;
+
+  float fsum = 0;
+  start = micros();
+  for (uint16_t i = 0; i < CHECKS; i++)
+    fsum += haversine(homeLat / 1e7, homeLon / 1e7, lats[i] / 1e7,
+                      lons[i] / 1e7);
+  uint32_t floatTime = micros() - start;
+
+  uint32_t bearings = 0;
+  start = micros();
+  for (uint16_t i = 0; i < CHECKS; i++)
+    bearings += geoBearing(homeLat, homeLon, lats[i], lons[i]);
+  uint32_t bearingTime = micros() - start;
+
+  Serial.print("geoDistance() us: ");
+  Serial.println((float)fixedTime / CHECKS);
+  Serial.print("haversine us: ");
+  Serial.println((float)floatTime / CHECKS);
+  Serial.print("geoBearing() us: ");
+  Serial.println((float)bearingTime / CHECKS);
+  Serial.print("Average bearing degrees: ");
+  Serial.println(bearings / 100.0 / CHECKS);
+  Serial.print("Average distance m, fixed and float: ");
+  Serial.print(sum / CHECKS);
+  Serial.print(", ");
+  Serial.println(fsum / CHECKS);
+
+  uint16_t inside = 0;
+  start = micros();
+  for (uint16_t i = 0; i < CHECKS; i++)
+    inside += geoInFence(&harbour, lats[i], lons[i]) >= 0;
+  uint32_t gridTime = micros() - start;
+
+  uint16_t nPolygons = sizeof(harbour_polygons) / sizeof(harbour_polygons[0]);
+  uint16_t insideAll = 0;
+  start = micros();
+  for (uint16_t i = 0; i < CHECKS; i++) {
+    for (uint16_t p = 0; p < nPolygons; p++) {
+      nmea_geo_polygon_t poly;
+      memcpy_P(&poly, &harbour_polygons[p], sizeof(poly));
+      if (geoInPolygon(&harbour_points[poly.first], poly.n, lats[i],
+                       lons[i])) {
+        insideAll++;
+        break;
+      }
+    }
+  }
+  uint32_t allTime = micros() - start;
+
+  Serial.print("Fence checks per second with the grid: ");
+  Serial.println(CHECKS * 1e6 / gridTime);
+  Serial.print("Fence checks per second testing every polygon: ");
+  Serial.println(CHECKS * 1e6 / allTime);
+  Serial.print("Positions inside a fence, both ways: ");
+  Serial.print(inside);
+  Serial.print(", ");
+  Serial.println(insideAll);
+  Serial.println();
+  delay(10000);
+}
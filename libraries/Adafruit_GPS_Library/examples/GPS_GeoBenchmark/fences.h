@@ -0,0 +1,567 @@
+// Made by fencegrid.py from fences.txt: 24 polygons, 400 vertices, 34x30 grid
+// 231 cell entries, 14 of them for cells wholly inside a polygon
+
+#include <NMEA_geo.h>
+
+const nmea_geo_point_t harbour_points[] PROGMEM = {
+    {406633410, -740690290},
+    {406692670, -740789080},
+    {406764880, -740840290},
+    {406788700, -740963120},
+    {406698100, -741013970},
+    {406633410, -741028680},
+    {406559570, -741030590},
+    {406526860, -740942240},
+    {406504260, -740841280},
+    {406575740, -740791950},
+    {407479090, -737496080},
+    {407511280, -737537810},
+    {407535330, -737568750},
+    {407588070, -737547820},
+    {407557150, -737639080},
+    {407624520, -737637400},
+    {407591280, -737692220},
+    {407580500, -737726450},
+    {407572750, -737757090},
+    {407573260, -737796000},
+    {407580130, -737860750},
+    {407527830, -737832780},
+    {407511360, -737883020},
+    {407479090, -737893850},
+    {407450560, -737862980},
+    {407417600, -737864850},
+    {407415390, -737805110},
+    {407400230, -737782050},
+    {407379260, -737760170},
+    {407337890, -737732830},
+    {407356650, -737690580},
+    {407371700, -737656440},
+    {407367870, -737608870},
+    {407396030, -737586450},
+    {407426210, -737577220},
+    {407443010, -737516990},
+    {407946480, -740365510},
+    {407974720, -740384380},
+    {408004720, -740390380},
+    {408036730, -740404400},
+    {408024670, -740463980},
+    {408063230, -740482290},
+    {408043160, -740523610},
+    {408051790, -740560890},
+    {408076590, -740622840},
+    {408027500, -740630630},
+    {408022600, -740697760},
+    {407969930, -740639210},
+    {407946480, -740687520},
+    {407910200, -740702480},
+    {407875370, -740686310},
+    {407869480, -740625320},
+    {407851570, -740596000},
+    {407830760, -740564570},
+    {407805750, -740523610},
+    {407859570, -740492850},
+    {407867060, -740463040},
+    {407872940, -740426470},
+    {407879600, -740370590},
+    {407923260, -740409140},
+    {408059060, -740122190},
+    {408090780, -740118860},
+    {408130630, -740114430},
+    {408124920, -740186170},
+    {408166300, -740196870},
+    {408155410, -740243270},
+    {408151880, -740279200},
+    {408140650, -740310800},
+    {408164380, -740382140},
+    {408110220, -740366740},
+    {408088050, -740392020},
+    {408059060, -740410790},
+    {408017760, -740447390},
+    {408009740, -740362950},
+    {407970620, -740362810},
+    {407946220, -740329650},
+    {407913130, -740289290},
+    {407917580, -740234700},
+    {407926190, -740181410},
+    {407979650, -740170670},
+    {407997070, -740134150},
+    {408027870, -740121250},
+    {408594670, -737611720},
+    {408622280, -737599530},
+    {408626760, -737639800},
+    {408659050, -737658740},
+    {408636150, -737689870},
+    {408626180, -737716090},
+    {408605010, -737724540},
+    {408581400, -737740310},
+    {408556310, -737726340},
+    {408549170, -737691890},
+    {408552420, -737662290},
+    {408540570, -737619700},
+    {408562790, -737588750},
+    {407792380, -738414850},
+    {407816210, -738418310},
+    {407830130, -738450190},
+    {407867490, -738435240},
+    {407856480, -738487150},
+    {407864860, -738509760},
+    {407876780, -738533850},
+    {407872760, -738561110},
+    {407875920, -738592780},
+    {407850430, -738604280},
+    {407834850, -738618050},
+    {407822260, -738640530},
+    {407802190, -738643350},
+    {407780640, -738663650},
+    {407765240, -738631400},
+    {407719550, -738673240},
+    {407708770, -738632210},
+    {407719080, -738586410},
+    {407706790, -738562420},
+    {407699800, -738533170},
+    {407703220, -738502600},
+    {407725270, -738484610},
+    {407708590, -738423030},
+    {407729310, -738389350},
+    {407767570, -738413240},
+    {407193420, -741086040},
+    {407209240, -741099110},
+    {407226890, -741103840},
+    {407234370, -741125270},
+    {407231650, -741147570},
+    {407251660, -741170010},
+    {407230730, -741184880},
+    {407226850, -741209030},
+    {407213290, -741228500},
+    {407193420, -741227520},
+    {407179280, -741207730},
+    {407160820, -741207730},
+    {407162490, -741180020},
+    {407138040, -741169350},
+    {407146800, -741145620},
+    {407143240, -741118240},
+    {407165840, -741113090},
+    {407179980, -741107740},
+    {407395480, -739287150},
+    {407433800, -739275830},
+    {407465580, -739304990},
+    {407493630, -739334840},
+    {407518700, -739368140},
+    {407531110, -739412000},
+    {407502910, -739464210},
+    {407526240, -739499260},
+    {407509270, -739534170},
+    {407477060, -739551370},
+    {407463940, -739574450},
+    {407457600, -739613860},
+    {407433630, -739627520},
+    {407412220, -739678170},
+    {407376440, -739704220},
+    {407352500, -739645080},
+    {407306160, -739668450},
+    {407274460, -739639910},
+    {407253540, -739597370},
+    {407281050, -739534430},
+    {407287060, -739497550},
+    {407288060, -739464210},
+    {407297400, -739433370},
+    {407309340, -739404570},
+    {407306150, -739348690},
+    {407323770, -739300760},
+    {407359680, -739289800},
+    {407178160, -738643930},
+    {407249130, -738759200},
+    {407315980, -738829000},
+    {407343610, -738959020},
+    {407253330, -739024600},
+    {407178160, -739138700},
+    {407090580, -739047130},
+    {407019170, -738956240},
+    {407066160, -738840070},
+    {407063490, -738679850},
+    {408026390, -739428980},
+    {408095860, -739521030},
+    {408135330, -739600590},
+    {408137280, -739694960},
+    {408132540, -739840370},
+    {408026390, -739874900},
+    {407958100, -739771530},
+    {407860960, -739718370},
+    {407848540, -739571020},
+    {407932590, -739476810},
+    {406726430, -739225960},
+    {406767470, -739251240},
+    {406765900, -739305360},
+    {406767960, -739360120},
+    {406726430, -739358830},
+    {406679900, -739366700},
+    {406684220, -739305360},
+    {406682270, -739247150},
+    {405597980, -740520280},
+    {405624660, -740506410},
+    {405658280, -740497640},
+    {405651670, -740569110},
+    {405699880, -740556300},
+    {405723060, -740586440},
+    {405716040, -740630010},
+    {405725600, -740669280},
+    {405700580, -740700100},
+    {405704410, -740745580},
+    {405685870, -740779470},
+    {405637660, -740748390},
+    {405618730, -740759700},
+    {405597980, -740792810},
+    {405566340, -740817840},
+    {405539360, -740795880},
+    {405521370, -740762710},
+    {405494200, -740743170},
+    {405517020, -740689290},
+    {405512540, -740662540},
+    {405482630, -740630450},
+    {405518760, -740609340},
+    {405531300, -740588300},
+    {405518280, -740530470},
+    {405546570, -740519960},
+    {405572230, -740511400},
+    {408217720, -737921300},
+    {408237720, -737912200},
+    {408248980, -737934140},
+    {408257920, -737954960},
+    {408262380, -737980560},
+    {408256290, -738007740},
+    {408234420, -738012920},
+    {408217720, -738023130},
+    {408200390, -738014640},
+    {408186370, -738000120},
+    {408174560, -737980100},
+    {408179980, -737955710},
+    {408185990, -737933660},
+    {408200660, -737920300},
+    {408795250, -738428260},
+    {408873670, -738452740},
+    {408892870, -738574020},
+    {408944720, -738621250},
+    {408954040, -738703130},
+    {408939780, -738782310},
+    {408900640, -738842510},
+    {408865460, -738927290},
+    {408795250, -738914640},
+    {408742050, -738873010},
+    {408690780, -738841310},
+    {408674900, -738769060},
+    {408601560, -738703130},
+    {408601750, -738597120},
+    {408667440, -738534080},
+    {408736360, -738515080},
+    {406385880, -740822650},
+    {406441420, -740837090},
+    {406506800, -740878210},
+    {406508100, -740974140},
+    {406448720, -741022740},
+    {406413880, -741076650},
+    {406356450, -741083030},
+    {406314970, -741031960},
+    {406301530, -740966960},
+    {406301650, -740900290},
+    {406322700, -740821440},
+    {405568190, -739161910},
+    {405639100, -739190470},
+    {405655670, -739283800},
+    {405657170, -739400910},
+    {405568190, -739385090},
+    {405480940, -739398640},
+    {405484570, -739283800},
+    {405482650, -739171220},
+    {405794210, -740216710},
+    {405856740, -740255460},
+    {405928920, -740289900},
+    {406005030, -740378620},
+    {405984170, -740507170},
+    {405891950, -740557570},
+    {405826880, -740586840},
+    {405743210, -740684790},
+    {405675890, -740588180},
+    {405615290, -740501660},
+    {405664610, -740391600},
+    {405689390, -740317050},
+    {405705850, -740190640},
+    {406988610, -741033210},
+    {407022410, -741014990},
+    {407069970, -740987490},
+    {407080890, -741057720},
+    {407107690, -741085080},
+    {407112660, -741131550},
+    {407111840, -741173240},
+    {407215700, -741210340},
+    {407152420, -741259660},
+    {407185930, -741335680},
+    {407136310, -741365700},
+    {407069440, -741344040},
+    {407074480, -741445540},
+    {407037860, -741494960},
+    {406988610, -741506480},
+    {406954780, -741405870},
+    {406926230, -741381210},
+    {406850990, -741437970},
+    {406840350, -741366290},
+    {406826770, -741313140},
+    {406845970, -741253290},
+    {406817730, -741210340},
+    {406799390, -741153380},
+    {406850820, -741122820},
+    {406826340, -741039650},
+    {406847010, -740976140},
+    {406932640, -741057040},
+    {406960330, -741046890},
+    {407269790, -737404840},
+    {407304520, -737484850},
+    {407367290, -737471940},
+    {407370930, -737544430},
+    {407379570, -737603020},
+    {407384290, -737675030},
+    {407330820, -737698640},
+    {407292900, -737731240},
+    {407244260, -737746260},
+    {407186490, -737739080},
+    {407182670, -737654160},
+    {407138450, -737606010},
+    {407151860, -737537230},
+    {407181020, -737482330},
+    {407227250, -737461720},
+    {406716430, -741210130},
+    {406753110, -741215890},
+    {406763100, -741262450},
+    {406752500, -741297900},
+    {406749360, -741342210},
+    {406716430, -741345190},
+    {406686280, -741337160},
+    {406654520, -741308970},
+    {406665020, -741260420},
+    {406683020, -741221820},
+    {405658330, -740676050},
+    {405723520, -740672780},
+    {405750980, -740758590},
+    {405711140, -740828110},
+    {405658330, -740840090},
+    {405593020, -740844560},
+    {405593670, -740758590},
+    {405611200, -740696560},
+    {405503740, -739823400},
+    {405526850, -739860000},
+    {405564410, -739835190},
+    {405560120, -739899300},
+    {405610970, -739892020},
+    {405583860, -739945240},
+    {405613580, -739973490},
+    {405598530, -740006920},
+    {405583770, -740034300},
+    {405583250, -740078130},
+    {405543410, -740063920},
+    {405538000, -740141750},
+    {405503740, -740139340},
+    {405482090, -740079820},
+    {405439530, -740119860},
+    {405417600, -740086860},
+    {405408100, -740046160},
+    {405387230, -740014580},
+    {405385770, -739973490},
+    {405403080, -739937990},
+    {405424530, -739913310},
+    {405424700, -739869470},
+    {405462240, -739878890},
+    {405471570, -739815490},
+    {408002540, -739346220},
+    {408028130, -739321910},
+    {408051430, -739336210},
+    {408084920, -739339250},
+    {408101950, -739372260},
+    {408114600, -739408410},
+    {408104830, -739448080},
+    {408118240, -739489030},
+    {408095970, -739519340},
+    {408079250, -739549410},
+    {408043660, -739542160},
+    {408020910, -739538650},
+    {408002540, -739549470},
+    {407979340, -739562460},
+    {407964960, -739534060},
+    {407920120, -739556950},
+    {407915200, -739514690},
+    {407901340, -739483900},
+    {407897860, -739448080},
+    {407898450, -739411230},
+    {407918600, -739384050},
+    {407953460, -739383240},
+    {407945340, -739317210},
+    {407973660, -739305680},
+    {407260400, -739158370},
+    {407337500, -739219170},
+    {407409810, -739295140},
+    {407412530, -739424430},
+    {407326630, -739479490},
+    {407260400, -739561120},
+    {407194350, -739479160},
+    {407122700, -739418240},
+    {407136640, -739306140},
+    {407166400, -739188490}
+};
+
+const nmea_geo_polygon_t harbour_polygons[] PROGMEM = {
+    {406504260, -741030590, 406788700, -740690290, 0, 10},
+    {407337890, -737893850, 407624520, -737496080, 10, 26},
+    {407805750, -740702480, 408076590, -740365510, 36, 24},
+    {407913130, -740447390, 408166300, -740114430, 60, 22},
+    {408540570, -737740310, 408659050, -737588750, 82, 13},
+    {407699800, -738673240, 407876780, -738389350, 95, 25},
+    {407138040, -741228500, 407251660, -741086040, 120, 18},
+    {407253540, -739704220, 407531110, -739275830, 138, 27},
+    {407019170, -739138700, 407343610, -738643930, 165, 10},
+    {407848540, -739874900, 408137280, -739428980, 175, 10},
+    {406679900, -739366700, 406767960, -739225960, 185, 8},
+    {405482630, -740817840, 405725600, -740497640, 193, 26},
+    {408174560, -738023130, 408262380, -737912200, 219, 14},
+    {408601560, -738927290, 408954040, -738428260, 233, 16},
+    {406301530, -741083030, 406508100, -740821440, 249, 11},
+    {405480940, -739400910, 405657170, -739161910, 260, 8},
+    {405615290, -740684790, 406005030, -740190640, 268, 13},
+    {406799390, -741506480, 407215700, -740976140, 281, 28},
+    {407138450, -737746260, 407384290, -737404840, 309, 15},
+    {406654520, -741345190, 406763100, -741210130, 324, 10},
+    {405593020, -740844560, 405750980, -740672780, 334, 8},
+    {405385770, -740141750, 405613580, -739815490, 342, 24},
+    {407897860, -739562460, 408118240, -739305680, 366, 24},
+    {407122700, -739561120, 407412530, -739158370, 390, 10}
+};
+
+const uint16_t harbour_cellStart[] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 3, 4, 4, 4, 5, 6, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 8, 10, 11, 12, 12,
+    13, 14, 15, 16, 16, 16, 17, 18, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 20, 22, 25, 27, 28,
+    29, 30, 31, 31, 31, 31, 32, 33, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 35, 37, 40, 41, 42,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+    43, 43, 43, 43, 43, 43, 43, 44, 45, 46,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 48, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 50, 51, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 53, 54, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 57, 59, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 61, 62, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 64, 65, 66, 67, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 69, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 71, 73, 75, 77, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 79, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 81, 82, 83, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 85, 86, 87, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 89,
+    90, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 92, 93, 95, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 97, 98, 99, 100, 101,
+    102, 103, 103, 103, 103, 103, 103, 103, 103, 104,
+    105, 105, 106, 108, 109, 109, 109, 109, 109, 109,
+    109, 109, 109, 109, 110, 112, 113, 114, 116, 117,
+    118, 119, 119, 119, 119, 119, 119, 119, 120, 121,
+    122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+    122, 122, 122, 122, 123, 125, 127, 129, 130, 131,
+    132, 132, 132, 132, 132, 132, 132, 132, 134, 136,
+    137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+    137, 137, 137, 137, 138, 139, 141, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 144, 145, 147,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 148, 148, 148, 149, 150, 150, 150, 150,
+    150, 150, 150, 150, 150, 150, 150, 151, 152, 153,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 155, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 157, 158, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 160, 161, 162, 163,
+    163, 163, 163, 164, 165, 167, 168, 168, 168, 168,
+    168, 169, 170, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 172, 173, 174, 176,
+    177, 178, 178, 179, 180, 182, 184, 185, 185, 185,
+    185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+    185, 185, 185, 185, 185, 185, 186, 187, 189, 191,
+    192, 193, 194, 195, 196, 198, 200, 200, 200, 200,
+    200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    200, 200, 200, 200, 200, 200, 200, 200, 200, 201,
+    202, 203, 203, 204, 205, 207, 208, 208, 208, 208,
+    208, 208, 208, 208, 208, 208, 209, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 211, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 213, 214, 214, 214, 214, 214, 214, 215, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    217, 218, 219, 219, 219, 219, 219, 219, 220, 221,
+    221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+    221, 221, 221, 221, 221, 221, 221, 221, 221, 222,
+    223, 224, 225, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 226, 226, 226, 227,
+    228, 229, 230, 231, 231, 231, 231, 231, 231, 231,
+    231
+};
+
+const uint8_t harbour_cellList[] PROGMEM = {
+    0x0B, 0x15, 0x15, 0x15, 0x0F, 0x0F, 0x0F, 0x14, 0x0B, 0x14, 0x0B, 0x0B,
+    0x15, 0x15, 0x15, 0x15, 0x0F, 0x8F, 0x0F, 0x14, 0x0B, 0x14, 0x0B, 0x10,
+    0x14, 0x0B, 0x10, 0x10, 0x10, 0x15, 0x15, 0x0F, 0x0F, 0x0F, 0x14, 0x0B,
+    0x14, 0x0B, 0x10, 0x14, 0x90, 0x90, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x00, 0x80, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x11, 0x11,
+    0x13, 0x11, 0x13, 0x00, 0x11, 0x00, 0x0A, 0x0A, 0x11, 0x91, 0x91, 0x11,
+    0x11, 0x91, 0x91, 0x11, 0x08, 0x08, 0x08, 0x11, 0x11, 0x06, 0x11, 0x11,
+    0x17, 0x17, 0x17, 0x08, 0x08, 0x08, 0x08, 0x12, 0x12, 0x11, 0x06, 0x11,
+    0x06, 0x07, 0x07, 0x17, 0x97, 0x17, 0x08, 0x17, 0x08, 0x08, 0x08, 0x12,
+    0x12, 0x12, 0x07, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x17, 0x08, 0x08,
+    0x01, 0x12, 0x01, 0x12, 0x12, 0x07, 0x07, 0x07, 0x17, 0x07, 0x17, 0x01,
+    0x01, 0x01, 0x12, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x09, 0x09, 0x09, 0x16, 0x16,
+    0x05, 0x05, 0x05, 0x02, 0x02, 0x82, 0x02, 0x03, 0x03, 0x03, 0x09, 0x89,
+    0x09, 0x16, 0x09, 0x16, 0x16, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x83,
+    0x03, 0x09, 0x09, 0x89, 0x09, 0x16, 0x09, 0x16, 0x03, 0x03, 0x03, 0x09,
+    0x09, 0x09, 0x16, 0x16, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x04, 0x04,
+    0x0D, 0x0D, 0x0D, 0x04, 0x04, 0x0D, 0x0D, 0x8D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D
+};
+
+const nmea_geo_fence_t harbour = {
+    405385770, -741506480, 104950, 136722, 34, 30,
+    harbour_cellStart, harbour_cellList, harbour_polygons, harbour_points};
@@ -0,0 +1,105 @@
+// Benchmark for reading and parsing NMEA sentences, no GPS needed.
+//
+// Feeds one second of 10 Hz GPS output (GGA, GSA, 3 x GSV, RMC and VTG per
+// fix) through read() and parse() from a Stream in flash, then prints the
+// bytes per second the library keeps up with and the longest single read()
+// and parse() calls. The longest calls are the jitter the rest of loop() sees.
+// Then does the same with readAll(), which reads and parses everything waiting
+// in one call. 9600 baud is 960 bytes per second.
+
+#include <Adafruit_GPS.h>
+
+const char burst[] PROGMEM =
+    "$GPGGA,064951.000,2307.1256,N,12016.4438,E,1,8,0.95,39.9,M,17.8,M,,*63\r\n"
+    "$GPGSA,A,3,29,21,26,15,18,09,06,10,,,,,2.32,0.95,2.11*00\r\n"
+    "$GPGSV,3,1,09,29,36,029,42,21,46,314,43,26,44,020,43,15,21,321,39*7D\r\n"
+    "$GPGSV,3,2,09,18,26,314,40,09,57,170,44,06,20,229,37,10,26,084,37*77\r\n"
+    "$GPGSV,3,3,09,07,,,26*73\r\n"
+    "$GPRMC,064951.000,A,2307.1256,N,12016.4438,E,0.03,165.48,260406,3.05,W,A*"
+    "2C\r\n"
+    "$GPVTG,165.48,T,,M,0.03,N,0.06,K,A*36\r\n";
+
+// Stream that plays the burst from flash a number of times
+class BurstStream : public Stream {
+public:
+  uint16_t i = 0;
+  uint16_t left = 0;
+  int available() { return left ? sizeof(burst) - 1 - i : 0; }
+  int read() {
+    if (!left)
+      return -1;
+    char c = pgm_read_byte(&burst[i++]);
+    if (i == sizeof(burst) - 1) {
+      i = 0;
+      left--;
+    }
+    return c;
+  }
+  int peek() { return left ? pgm_read_byte(&burst[i]) : -1; }
+  size_t write(uint8_t) { return 1; }
+};
+
+BurstStream nmea;
+Adafruit_GPS GPS(&nmea);
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+  Serial.println("Adafruit GPS read() and parse() benchmark");
+}
+
+void loop() {
+  uint32_t maxRead = 0, maxParse = 0, sentences = 0, parsed = 0;
+  nmea.left = 10; // one second of output
+  uint32_t bytes = nmea.left * (sizeof(burst) - 1);
+
+  uint32_t start = micros();
+  while (nmea.available()) {
+    uint32_t m = micros();
+    GPS.read();
+    m = micros() - m;
+    if (m > maxRead)
+      maxRead = m;
+    if (GPS.newNMEAreceived()) {
+      m = micros();
+      if (GPS.parse(GPS.lastNMEA()))
+        parsed++;
+      m = micros() - m;
+      if (m > maxParse)
+        maxParse = m;
+      sentences++;
+    }
+  }
+  uint32_t t = micros() - start;
+
+  Serial.print(sentences);
+  Serial.print(" sentences, ");
+  Serial.print(parsed);
+  Serial.print(" parsed in ");
+  Serial.print(t);
+  Serial.println(" us");
+  Serial.print(bytes * 1000000.0 / t, 0);
+  Serial.println(" bytes/second including the timing");
+  Serial.print("longest read() ");
+  Serial.print(maxRead);
+  Serial.print(" us, longest parse() ");
+  Serial.print(maxParse);
+  Serial.println(" us");
+
+  nmea.left = 10;
+  sentences = 0;
+  start = micros();
+  while (nmea.available())
+    sentences += GPS.readAll(true, 100); // in bites of 100 characters
+  t = micros() - start;
+
+  Serial.print(sentences);
+  Serial.print(" sentences with readAll() in ");
+  Serial.print(t);
+  Serial.println(" us");
+  Serial.print(bytes * 1000000.0 / t, 0);
+  Serial.println(" bytes/second");
+  Serial.println();
+  delay(2000);
+}
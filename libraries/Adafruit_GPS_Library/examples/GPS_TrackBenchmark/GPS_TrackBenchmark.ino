@@ -0,0 +1,93 @@
+// Benchmark for recording a simplified track, no GPS needed.
+//
+// Makes up an hour of 1 Hz fixes for a drive with corners, bends, stops and
+// a few metres of GPS noise, adds them to an Adafruit_NMEA_Track recording
+// into RAM, then prints how many points were kept, how many bytes they took
+// compared to the 12 bytes of each raw fix, and the average and longest time
+// add() took. Try changing the tolerance to see the trade off.
+//
+// To record to an SD card instead, open a File for writing and pass it to
+// begin(), and call flush() before closing it. trackdecode/trackdecode.py
+// turns the file into CSV or GPX on a computer.
+
+#include <Adafruit_GPS.h>
+#include <NMEA_track.h>
+
+#define FIXES 3600     // one hour at 1 Hz
+#define TOLERANCE 5.0  // metres
+#define NOISE 2.0      // metres of GPS noise, roughly
+
+Adafruit_NMEA_Track track;
+uint8_t trackBuffer[512];
+
+// a sum of uniform random numbers is close enough to a normal one
+float noise() {
+  float s = 0;
+  for (uint8_t i = 0; i < 12; i++)
+    s += random(10000) / 10000.0;
+  return (s - 6) * NOISE;
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+  Serial.println("Adafruit GPS track recording benchmark");
+}
+
+void loop() {
+  randomSeed(42);
+  track.begin(trackBuffer, sizeof(trackBuffer), TOLERANCE);
+  float north = 0, east = 0, heading = 30, speed = 15; // metres, m/s
+  const float lat0 = 51.5, lon0 = -0.12, cosLat = cos(lat0 * DEG_TO_RAD);
+  uint32_t total = 0, longest = 0;
+
+  for (uint16_t i = 0; i < FIXES; i++) {
+    long r = random(1000);
+    if (r < 10)
+      heading += r < 5 ? 90 : -90; // a corner
+    else if (r < 60)
+      heading += noise(); // a bend
+    else if (r < 65)
+      speed = r < 62 ? 0 : 5 + random(25); // a stop, or a new speed
+    north += speed * cos(heading * DEG_TO_RAD);
+    east += speed * sin(heading * DEG_TO_RAD);
+    int32_t lat = (lat0 + (north + noise()) / 111320.0) * 1e7;
+    int32_t lon = (lon0 + (east + noise()) / (111320.0 * cosLat)) * 1e7;
+
+    uint32_t m = micros();
+    track.add(lat, lon, 700000000UL + i);
+    m = micros() - m;
+    total += m;
+    longest = max(longest, m);
+  }
+  track.flush();
+
+  Serial.print("Fixes added: ");
+  Serial.println(track.points);
+  Serial.print("Points kept: ");
+  Serial.println(track.kept);
+  Serial.print("Bytes written: ");
+  Serial.println(track.bytes);
+  Serial.print("Times smaller than raw fixes: ");
+  Serial.println(12.0 * track.points / track.bytes);
+  Serial.print("Average add() us: ");
+  Serial.println((float)total / FIXES);
+  Serial.print("Longest add() us: ");
+  Serial.println(longest);
+  Serial.print("Points still in the RAM buffer: ");
+  Serial.println(track.kept - track.overwritten);
+
+  nmea_track_point_t p;
+  track.rewind();
+  for (uint8_t i = 0; i < 3 && track.next(&p); i++) {
+    Serial.print("  ");
+    Serial.print(p.time);
+    Serial.print(": ");
+    Serial.print(p.lat / 1e7, 7);
+    Serial.print(", ");
+    Serial.println(p.lon / 1e7, 7);
+  }
+  Serial.println();
+  delay(10000);
+}
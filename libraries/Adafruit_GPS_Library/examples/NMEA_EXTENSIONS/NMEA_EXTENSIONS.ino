@@ -71,7 +71,7 @@ void loop() {
       } else { 
         Serial.print("Couldn't build and parse a ");
         Serial.print(senList[i]);
-        Serial.print(" sentence, maybe because sprintf() doesn't work with %f.");
+        Serial.print(" sentence.");
       }
     }
     
@@ -139,5 +139,9 @@ void addHistory(Adafruit_GPS *nmea) {
   // Record pressure every 10 minutes, in Pa relative to 1 bar
   nmea->initHistory(NMEA_BAROMETER, 1.0, -100000.0, 600);
   nmea->initHistory(NMEA_DEPTH, 10.0, 0.0, 3);
+  // Keep the min, mean and max depth for each minute of the last hour, and
+  // for each 10 minutes of the last day, as well as the detailed history
+  nmea->addHistoryTier(NMEA_DEPTH, 60, 60);
+  nmea->addHistoryTier(NMEA_DEPTH, 600, 144);
 }
 #endif              // NMEA_EXTENSIONS
@@ -0,0 +1,69 @@
+// Test code for the NMEA router, merging two NMEA sources onto one port
+// and sending only the position to another.
+//
+// Connect the GPS to Serial1 and another NMEA instrument, e.g. a compass or a
+// depth sounder, to Serial2. Everything from both comes out on Serial, and
+// the GGA and RMC sentences come out on Serial3 no more than once a second,
+// e.g. for an autopilot. The sentences are parsed as well, so the sketch can
+// use the merged data from both inputs.
+//
+// Needs a board with four hardware serial ports, such as a Mega or a Teensy.
+
+#include <Adafruit_GPS.h>
+#include <NMEA_router.h>
+
+Adafruit_GPS GPS;             // only used for parsing, so no Stream
+Adafruit_NMEA_Router router;
+const char *positionOnly[] = {"GGA", "RMC", "ZZ"};
+
+uint32_t timer = millis();
+
+void setup() {
+  Serial.begin(115200);
+  Serial1.begin(9600);
+  Serial2.begin(4800);
+  Serial3.begin(4800);
+
+  router.addInput(&Serial1);
+  router.addInput(&Serial2);
+  router.addOutput(&Serial);
+  router.addOutput(&Serial3, positionOnly, 1000);
+  router.setParser(&GPS);
+}
+
+void loop() {
+  router.service();
+
+  // every 10 seconds show what has been passed on and what was lost
+  if (millis() - timer > 10000) {
+    timer = millis();
+    for (uint8_t i = 0; i < router.nInputs; i++) {
+      Serial.print("# input ");
+      Serial.print(i);
+      Serial.print(" sentences ");
+      Serial.print(router.inputs[i].sentences);
+      Serial.print(" bad ");
+      Serial.print(router.inputs[i].bad);
+      Serial.print(" no buffer ");
+      Serial.println(router.inputs[i].noBuffer);
+    }
+    for (uint8_t i = 0; i < router.nOutputs; i++) {
+      Serial.print("# output ");
+      Serial.print(i);
+      Serial.print(" sent ");
+      Serial.print(router.outputs[i].sent);
+      Serial.print(" limited ");
+      Serial.print(router.outputs[i].limited);
+      Serial.print(" dropped ");
+      Serial.print(router.outputs[i].dropped);
+      Serial.print(" max queue ");
+      Serial.println(router.outputs[i].maxDepth);
+    }
+    Serial.print("# fix ");
+    Serial.print((int)GPS.fix);
+    Serial.print(" at ");
+    Serial.print(GPS.latitudeDegrees, 6);
+    Serial.print(", ");
+    Serial.println(GPS.longitudeDegrees, 6);
+  }
+}
@@ -0,0 +1,160 @@
+// libFuzzer target for the NMEA parsers.  Each input is fed through read()
+// a character at a time, every line received is parsed from lastNMEA(), and
+// the whole input is also passed to parse() and onList() from a buffer of
+// exactly its size, so that reads past the end are caught.  With
+// NMEA_EXTENSIONS every sentence is then built from whatever was parsed.
+//
+// Built with -DFUZZ_MAIN there is a main() instead, for compilers without
+// libFuzzer.  It runs each line of the files given, then as many randomly
+// changed copies of them, fixing the checksum of most so they get past
+// check().
+//
+// Usage: nmeafuzz [libFuzzer options] <seed directory>
+//        nmeafuzz_gcc <file>... [-n count] [-s seed]
+#include <string>
+#include <vector>
+
+#include <Adafruit_GPS.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+static unsigned long now = 1; // millis()
+unsigned long millis(void) { return now; }
+unsigned long micros(void) { return now * 1000; }
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+/** Stream that plays a buffer */
+class MemoryStream : public Stream {
+public:
+  MemoryStream(const uint8_t *data, size_t size)
+      : p(data), end(data + size) {}
+  int available(void) { return end - p; }
+  int read(void) { return p < end ? *p++ : -1; }
+  int peek(void) { return p < end ? *p : -1; }
+  size_t write(uint8_t) { return 1; }
+  using Print::write;
+
+private:
+  const uint8_t *p, *end;
+};
+
+static const char *list[] = {"GGA", "RMC", "ZZ"};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  MemoryStream s(data, size);
+  Adafruit_GPS gps(&s);
+  while (s.available()) {
+    now++;
+    gps.read();
+    if (gps.newNMEAreceived())
+      gps.parse(gps.lastNMEA());
+  }
+
+  // parse() expects a line no longer than MAXLINELENGTH
+  size_t n = size < MAXLINELENGTH - 1 ? size : MAXLINELENGTH - 1;
+  char *line = (char *)malloc(n + 1);
+  memcpy(line, data, n);
+  line[n] = 0;
+  gps.parse(line);
+  gps.onList(line, list);
+  free(line);
+
+#ifdef NMEA_EXTENSIONS
+  static const char *ids[] = {"GGA", "GLL", "RMC", "DBT", "HDM", "HDT", "MWV",
+                              "RMB", "TXT", "VHW", "VPW", "WCV", "XYZ"};
+  char out[MAXLINELENGTH];
+  for (const char *id : ids)
+    gps.build(out, "GP", id);
+#endif
+  return 0;
+}
+
+#ifdef FUZZ_MAIN
+// set the checksum to match, if the line has one
+static void fixChecksum(std::string &s) {
+  size_t star = s.rfind('*');
+  if (star == std::string::npos || s[0] != '$')
+    return;
+  uint8_t sum = 0;
+  for (size_t i = 1; i < star; i++)
+    sum ^= (uint8_t)s[i];
+  char hex[3];
+  snprintf(hex, sizeof(hex), "%02X", sum);
+  s = s.substr(0, star + 1) + hex + "\r\n";
+}
+
+static void run(const std::string &s) {
+  LLVMFuzzerTestOneInput((const uint8_t *)s.data(), s.size());
+}
+
+int main(int argc, char **argv) {
+  std::vector<std::string> lines;
+  long count = 100000;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      count = atol(argv[++i]);
+      continue;
+    }
+    if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      srand(atoi(argv[++i]));
+      continue;
+    }
+    FILE *f = fopen(argv[i], "rb");
+    if (!f) {
+      perror(argv[i]);
+      return 1;
+    }
+    char l[512];
+    while (fgets(l, sizeof(l), f))
+      lines.push_back(l);
+    fclose(f);
+  }
+  if (lines.empty()) {
+    fprintf(stderr, "usage: %s <file>... [-n count] [-s seed]\n", argv[0]);
+    return 1;
+  }
+
+  for (const std::string &s : lines)
+    run(s);
+  for (long i = 0; i < count; i++) {
+    std::string s = lines[rand() % lines.size()];
+    for (int k = 1 + rand() % 4; k > 0 && s.size() > 1; k--) {
+      size_t at = rand() % s.size();
+      switch (rand() % 7) {
+      case 0: // leave some out
+        s.erase(at, 1 + rand() % 8);
+        break;
+      case 1: // add a character the parsers look for
+        s.insert(at, 1, ",*$!.-0123456789NSEW"[rand() % 20]);
+        break;
+      case 2: // change one to anything
+        s[at] = rand() % 256;
+        break;
+      case 3: // cut it short
+        s = s.substr(0, at) + "*00";
+        break;
+      case 4: { // drop a field
+        size_t comma = s.find(',', at);
+        if (comma != std::string::npos)
+          s.erase(at, comma - at + 1);
+        break;
+      }
+      case 5: // a long run of digits or empty fields
+        s.insert(at, std::string(rand() % 40, "9,"[rand() % 2]));
+        break;
+      case 6: // part of another line
+        s.insert(at, lines[rand() % lines.size()].substr(0, 20));
+        break;
+      }
+    }
+    if (rand() % 4)
+      fixChecksum(s);
+    run(s);
+  }
+  printf("%zu lines and %ld changed copies\n", lines.size(), count);
+  return 0;
+}
+#endif
@@ -0,0 +1,265 @@
+// Checks geoDistance(), geoBearing(), geoInPolygon() and geoInFence()
+// against double precision references: the haversine distance and the
+// great circle's initial bearing for random pairs of points from 10 m to
+// 500 km apart below 70 degrees latitude, which must be within the bounds
+// their comments give, then a few exact cases, then the harbour fence of
+// the GPS_GeoBenchmark example and random polygons spanning up to most of
+// the globe against a crossing test in double.  Only points within a unit
+// or two of an edge may differ.  Prints the worst errors and the number of
+// failures, and exits non-zero if there were any.  With -b it times fence
+// checks with the grid and testing every polygon, and distance and bearing.
+//
+// Usage: geo [-b]
+#include <chrono> // before Arduino.h defines min and max
+#include <vector>
+
+#include <NMEA_geo.h>
+
+#include "../../examples/GPS_GeoBenchmark/fences.h"
+
+#define EARTH_RADIUS 6371008.8 // metres, the mean radius geoDistance() uses
+#define UNIT 1e-7              // degrees in a fixed point unit
+
+static int bad = 0;
+
+static void fail(const char *what, double a, double b) {
+  if (bad++ < 20)
+    printf("%s (%.7f, %.7f)\n", what, a, b);
+}
+
+// xorshift, so every run checks the same points
+static uint64_t seed = 88172645463325252ULL;
+static double random01(void) {
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return (seed >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double radians(double degrees) { return degrees * M_PI / 180; }
+
+static double haversine(double lat1, double lon1, double lat2, double lon2) {
+  double dLat = radians(lat2 - lat1), dLon = radians(lon2 - lon1);
+  double a = sin(dLat / 2) * sin(dLat / 2) +
+             cos(radians(lat1)) * cos(radians(lat2)) * sin(dLon / 2) *
+                 sin(dLon / 2);
+  return 2 * EARTH_RADIUS * asin(sqrt(a));
+}
+
+static double initialBearing(double lat1, double lon1, double lat2,
+                             double lon2) {
+  double dLon = radians(lon2 - lon1);
+  double b = atan2(sin(dLon) * cos(radians(lat2)),
+                   cos(radians(lat1)) * sin(radians(lat2)) -
+                       sin(radians(lat1)) * cos(radians(lat2)) * cos(dLon));
+  return fmod(b * 180 / M_PI + 360, 360);
+}
+
+/** Bounds from the geoDistance() and geoBearing() comments */
+static const struct {
+  double metres;   // farthest apart
+  double relative; // distance error as a fraction, or 1 m if more
+  double degrees;  // bearing error, 0 for no check
+} bands[] = {{1000, 0.0006, 0.15},
+             {10000, 0.0006, 0.15},
+             {100000, 0.0006, 1.3},
+             {500000, 0.0025, 0}};
+
+static void distanceAndBearing(void) {
+  for (auto &band : bands) {
+    double worstMetres = 0, worstRelative = 0, worstBearing = 0;
+    for (long i = 0; i < 100000; i++) {
+      double lat1 = (random01() * 2 - 1) * 70;
+      double lon1 = (random01() * 2 - 1) * 180;
+      double d = band.metres * (0.01 + 0.99 * random01());
+      double heading = radians(random01() * 360);
+      double lat2 = lat1 + d * cos(heading) / 111195.0;
+      double lon2 =
+          lon1 + d * sin(heading) / (111195.0 * cos(radians(lat1)));
+      if (fabs(lat2) > 70)
+        continue;
+      if (lon2 > 180)
+        lon2 -= 360;
+      if (lon2 < -180)
+        lon2 += 360;
+      int32_t a1 = lround(lat1 / UNIT), o1 = lround(lon1 / UNIT);
+      int32_t a2 = lround(lat2 / UNIT), o2 = lround(lon2 / UNIT);
+      lat1 = a1 * UNIT, lon1 = o1 * UNIT, lat2 = a2 * UNIT, lon2 = o2 * UNIT;
+
+      double want = haversine(lat1, lon1, lat2, lon2);
+      double e = fabs(geoDistance(a1, o1, a2, o2) - want);
+      if (e > 1 && e > want * band.relative)
+        fail("geoDistance() differs from haversine", lat1, lon1);
+      worstMetres = max(worstMetres, e);
+      if (want >= 1000)
+        worstRelative = max(worstRelative, e / want);
+      if (!band.degrees || want < 10)
+        continue;
+      e = fabs(geoBearing(a1, o1, a2, o2) / 100.0 -
+               initialBearing(lat1, lon1, lat2, lon2));
+      e = min(e, 360 - e);
+      if (e > band.degrees)
+        fail("geoBearing() differs from the great circle", lat1, lon1);
+      worstBearing = max(worstBearing, e);
+    }
+    printf("up to %6.0f m: distance %.2f m", band.metres, worstMetres);
+    if (worstRelative)
+      printf(" or %.4f%%", worstRelative * 100);
+    if (band.degrees)
+      printf(", bearing %.3f degrees", worstBearing);
+    printf("\n");
+  }
+}
+
+static void exact(void) {
+  if (geoDistance(1, 2, 1, 2) || geoBearing(1, 2, 1, 2))
+    fail("the same point isn't 0 m away at 0 degrees", 1, 2);
+  static const struct {
+    int32_t lat, lon;
+    uint16_t bearing;
+  } compass[] = {{100, 0, 0},     {0, 100, 9000},   {-100, 0, 18000},
+                 {0, -100, 27000}, {100, 100, 4500}, {-100, -100, 22500}};
+  for (auto &c : compass)
+    if (geoBearing(0, 0, c.lat, c.lon) != c.bearing)
+      fail("geoBearing() of a compass point", c.lat, c.lon);
+  // across the 180 degree meridian, the short way
+  double want = haversine(0, 179.999, 0, -179.999);
+  if (fabs(geoDistance(0, 1799990000, 0, -1799990000) - want) > 1)
+    fail("geoDistance() across 180 degrees", 0, 179.999);
+  if (geoBearing(0, 1799990000, 0, -1799990000) != 9000 ||
+      geoBearing(0, -1799990000, 0, 1799990000) != 27000)
+    fail("geoBearing() across 180 degrees", 0, 179.999);
+  // pole to pole, and far out of range, without overflowing
+  want = haversine(-90, 0, 90, 0);
+  if (fabs(geoDistance(-900000000, 0, 900000000, 0) - want) > want * 0.0025)
+    fail("geoDistance() pole to pole", -90, 90);
+  geoDistance(INT32_MIN, INT32_MIN, INT32_MAX, INT32_MAX);
+}
+
+// crossing test in double, and how far the point is from the nearest edge
+static bool inPolygon(const nmea_geo_point_t *p, int n, double lat,
+                      double lon, double *nearest) {
+  bool inside = false;
+  *nearest = 1e18;
+  for (int i = 0, j = n - 1; i < n; j = i++) {
+    double ay = p[j].lat, ax = p[j].lon, by = p[i].lat, bx = p[i].lon;
+    if ((ay > lat) != (by > lat) &&
+        lon < (bx - ax) * (lat - ay) / (by - ay) + ax)
+      inside = !inside;
+    double dx = bx - ax, dy = by - ay;
+    double t = ((lon - ax) * dx + (lat - ay) * dy) / (dx * dx + dy * dy);
+    t = fmax(0, fmin(1, t));
+    *nearest = fmin(*nearest, hypot(ax + t * dx - lon, ay + t * dy - lat));
+  }
+  return inside;
+}
+
+#define NEAR_EDGE 2   // units from an edge where either answer will do
+#define POINTS 200000 // in the harbour fence
+
+static void fence(void) {
+  int n = sizeof(harbour_polygons) / sizeof(harbour_polygons[0]);
+  long inside = 0, nearEdge = 0;
+  for (long i = 0; i < POINTS; i++) {
+    int32_t lat = lround((40.50 + random01() * 0.45) / UNIT);
+    int32_t lon = lround((-74.20 + random01() * 0.50) / UNIT);
+    int want = -1;
+    double nearest = 1e18, d;
+    for (int k = 0; k < n; k++) {
+      const nmea_geo_polygon_t &p = harbour_polygons[k];
+      bool in = inPolygon(&harbour_points[p.first], p.n, lat, lon, &d);
+      nearest = fmin(nearest, d);
+      if (in && want < 0)
+        want = k;
+    }
+    int got = geoInFence(&harbour, lat, lon);
+    if (got != want) {
+      if (nearest > NEAR_EDGE)
+        fail("geoInFence() differs from the double test", lat * UNIT,
+             lon * UNIT);
+      nearEdge++;
+    }
+    inside += got >= 0;
+  }
+  printf("harbour fence: %ld of %ld points inside, %ld on an edge\n", inside,
+         (long)POINTS, nearEdge);
+}
+
+// random star shaped polygons up to 340 degrees wide, for edges far longer
+// than those in the fence
+static void bigPolygons(void) {
+  long checked = 0, nearEdge = 0;
+  for (int k = 0; k < 200; k++) {
+    std::vector<nmea_geo_point_t> p(3 + k % 20);
+    double lat0 = (random01() * 2 - 1) * 40, lon0 = (random01() * 2 - 1) * 10;
+    double size = pow(10, -3 + 5 * random01()); // 0.001 to 100 degrees
+    for (size_t i = 0; i < p.size(); i++) {
+      double angle = 2 * M_PI * (i + 0.8 * random01()) / p.size();
+      double r = size * (0.2 + 0.8 * random01());
+      p[i].lat = lround(fmax(-89, fmin(89, lat0 + r / 2 * sin(angle))) / UNIT);
+      p[i].lon = lround(fmax(-170, fmin(170, lon0 + r * 1.7 * cos(angle))) /
+                        UNIT);
+    }
+    for (int i = 0; i < 2000; i++) {
+      int32_t lat = lround((lat0 + (random01() * 2 - 1) * size) / UNIT);
+      int32_t lon = lround((lon0 + (random01() * 2 - 1) * size * 2) / UNIT);
+      double nearest;
+      bool want = inPolygon(p.data(), p.size(), lat, lon, &nearest);
+      if (geoInPolygon(p.data(), p.size(), lat, lon) != want) {
+        if (nearest > NEAR_EDGE)
+          fail("geoInPolygon() differs from the double test", lat * UNIT,
+               lon * UNIT);
+        nearEdge++;
+      }
+      checked++;
+    }
+  }
+  printf("large polygons: %ld points, %ld on an edge\n", checked, nearEdge);
+}
+
+static void bench(void) {
+  typedef std::chrono::steady_clock clock;
+  int n = sizeof(harbour_polygons) / sizeof(harbour_polygons[0]);
+  std::vector<nmea_geo_point_t> q(POINTS * 5);
+  for (auto &p : q) {
+    p.lat = lround((40.50 + random01() * 0.45) / UNIT);
+    p.lon = lround((-74.20 + random01() * 0.50) / UNIT);
+  }
+  long sum = 0;
+  clock::time_point t0 = clock::now();
+  for (auto &p : q)
+    sum += geoInFence(&harbour, p.lat, p.lon);
+  double grid = std::chrono::duration<double>(clock::now() - t0).count();
+  t0 = clock::now();
+  for (auto &p : q)
+    for (int k = 0; k < n; k++) {
+      const nmea_geo_polygon_t &poly = harbour_polygons[k];
+      if (geoInPolygon(&harbour_points[poly.first], poly.n, p.lat, p.lon)) {
+        sum += k;
+        break;
+      }
+    }
+  double every = std::chrono::duration<double>(clock::now() - t0).count();
+  t0 = clock::now();
+  for (auto &p : q)
+    sum += geoDistance(p.lat, p.lon, 407000000, -740000000) +
+           geoBearing(p.lat, p.lon, 407000000, -740000000);
+  double pairs = std::chrono::duration<double>(clock::now() - t0).count();
+  printf("%.1fM fence checks/s with the grid, %.2fM testing every polygon\n"
+         "%.1fM distance and bearing pairs/s (%ld)\n",
+         q.size() / grid / 1e6, q.size() / every / 1e6,
+         q.size() / pairs / 1e6, sum);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && !strcmp(argv[1], "-b")) {
+    bench();
+    return 0;
+  }
+  distanceAndBearing();
+  exact();
+  fence();
+  bigPolygons();
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
@@ -0,0 +1,174 @@
+// Records data value history through newDataValue() with a simulated
+// millis() and checks getHistory() and getHistoryBucket() against a shadow
+// copy of every value recorded: for several history lengths and tiers,
+// long enough for the rings to wrap many times, with updates that come
+// early and are skipped, ages past the end, tiers that don't exist, and
+// after removeHistory().  Prints the number of failures and exits non-zero
+// if there were any.  With -b it times a history update against the old
+// way, shifting the whole array down a place, for 20, 192 and 1000 values
+// instead.
+//
+// Usage: history [-b]
+#include <chrono> // before Arduino.h defines min and max
+#include <vector>
+
+#include <Adafruit_GPS.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+static unsigned long now = 1; // millis()
+unsigned long millis(void) { return now; }
+unsigned long micros(void) { return now * 1000; }
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+#define IDX NMEA_DEPTH
+
+static int bad = 0;
+
+static void fail(const char *what, long i) {
+  if (bad++ < 20)
+    printf("%s (%ld)\n", what, i);
+}
+
+/** What a tier should hold */
+struct ShadowTier {
+  unsigned seconds, n, perBucket;
+  std::vector<nmea_bucket_t> done; // completed buckets, oldest first
+  std::vector<int16_t> filling;    // values in the next bucket
+};
+
+static void run(unsigned interval, unsigned historyN,
+                std::vector<ShadowTier> tiers, long steps) {
+  Adafruit_GPS g;
+  nmea_float_t scale = 10, offset = 5;
+  now = 1;
+  if (!g.initHistory(IDX, scale, offset, interval, historyN)) {
+    fail("initHistory() failed", historyN);
+    return;
+  }
+  for (ShadowTier &t : tiers)
+    if (!g.addHistoryTier(IDX, t.seconds, t.n))
+      fail("addHistoryTier() failed", t.seconds);
+  historyN = max(10u, historyN);
+
+  std::vector<int16_t> shadow; // every history value, oldest first
+  unsigned long lastHistory = 0;
+  for (long i = 0; i < steps; i++) {
+    // mostly on time, sometimes early so no history is taken
+    now += rand() % 4 ? interval * 1000 + rand() % 300 : rand() % 900;
+    g.newDataValue(IDX, (rand() % 20000 - 10000) / 10.0);
+    if ((now - lastHistory) / 1000 >= interval || lastHistory == 0) {
+      lastHistory = now;
+      int16_t v16 = scale * (g.val[IDX].smoothed - offset);
+      shadow.push_back(v16);
+      for (ShadowTier &t : tiers) {
+        t.filling.push_back(v16);
+        if (t.filling.size() < t.perBucket)
+          continue;
+        nmea_bucket_t b = {v16, v16, 0};
+        int32_t sum = 0;
+        for (int16_t x : t.filling) {
+          b.min = min(b.min, x);
+          b.max = max(b.max, x);
+          sum += x;
+        }
+        b.mean = sum / (int32_t)t.filling.size();
+        t.done.push_back(b);
+        t.filling.clear();
+      }
+    }
+
+    // every age, and one past the end
+    for (unsigned age = 0; age <= historyN; age++) {
+      int16_t s = age < shadow.size() && age < historyN
+                      ? shadow[shadow.size() - 1 - age]
+                      : 0;
+      nmea_float_t want =
+          age < historyN ? (nmea_float_t)s / scale + offset : 0.0;
+      if (g.getHistory(IDX, age) != want)
+        fail("getHistory() differs from the shadow", i);
+    }
+    for (uint8_t k = 0; k <= tiers.size(); k++) {
+      unsigned n = k < tiers.size() ? tiers[k].n : 1;
+      for (unsigned age = 0; age <= n; age++) {
+        nmea_float_t mean = -1, lo = -1, hi = -1;
+        bool got = g.getHistoryBucket(IDX, k, age, &mean, &lo, &hi);
+        if (k == tiers.size() || age == n) {
+          if (got)
+            fail("getHistoryBucket() found a bucket that isn't there", i);
+          continue;
+        }
+        nmea_bucket_t b = {0, 0, 0};
+        if (age < tiers[k].done.size())
+          b = tiers[k].done[tiers[k].done.size() - 1 - age];
+        if (!got || mean != (nmea_float_t)b.mean / scale + offset ||
+            lo != (nmea_float_t)b.min / scale + offset ||
+            hi != (nmea_float_t)b.max / scale + offset)
+          fail("getHistoryBucket() differs from the shadow", i);
+      }
+    }
+  }
+  if (shadow.size() < 3 * historyN)
+    fail("history didn't wrap", historyN);
+
+  g.removeHistory(IDX);
+  nmea_float_t mean;
+  if (g.val[IDX].hist || g.getHistory(IDX, 0) != 0.0 ||
+      g.getHistoryBucket(IDX, 0, 0, &mean, NULL, NULL))
+    fail("history left after removeHistory()", historyN);
+  if (g.addHistoryTier(IDX, 60, 4))
+    fail("addHistoryTier() without history", historyN);
+}
+
+// nanoseconds per history update, the ring against shifting the array
+static void bench(unsigned historyN) {
+  using namespace std::chrono;
+  const long reps = 200000;
+  Adafruit_GPS ring, plain;
+  ring.initHistory(IDX, 10, 0, 1, historyN);
+  std::vector<int16_t> shifted(historyN);
+
+  now = 1;
+  auto t = steady_clock::now();
+  for (long i = 0; i < reps; i++) {
+    now += 1000;
+    ring.newDataValue(IDX, i & 1023);
+  }
+  double r = (double)duration_cast<nanoseconds>(steady_clock::now() - t)
+                 .count() / reps;
+
+  // newDataValue() without history, then the old update
+  now = 1;
+  t = steady_clock::now();
+  for (long i = 0; i < reps; i++) {
+    now += 1000;
+    plain.newDataValue(IDX, i & 1023);
+    for (unsigned k = 0; k < historyN - 1; k++)
+      shifted[k] = shifted[k + 1];
+    shifted[historyN - 1] = 10 * plain.val[IDX].smoothed;
+    asm volatile("" : : "r"(shifted.data()) : "memory");
+  }
+  double s = (double)duration_cast<nanoseconds>(steady_clock::now() - t)
+                 .count() / reps;
+  printf("%4u values: ring %.0f ns, shift %.0f ns a history update\n",
+         historyN, r, s);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && !strcmp(argv[1], "-b")) {
+    bench(20);
+    bench(192);
+    bench(1000);
+    return 0;
+  }
+  srand(1);
+  run(20, 192, {}, 1000);
+  run(1, 10, {{5, 7, 5}, {20, 4, 20}, {1, 3, 1}}, 3000);
+  run(2, 17, {{10, 9, 5}, {7, 5, 3}}, 3000);
+  run(1, 3, {{0, 2, 1}}, 500); // historyN and perBucket are at least 10 and 1
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+
+# Makes an NMEA corpus for the host tests, written to stdout: a simulated
+# drive with 10 Hz GGA and RMC, GSA, GLL, GSV, VTG and PMTK sentences,
+# marine instrument sentences, and some damaged lines: bad checksums,
+# missing '*', lines too long for the buffer, garbage, two '*', high bit
+# characters, '!' sentences and unknown ids and talkers.
+#
+# Usage: nmeacorpus.py [seed] [fixes] > corpus.nmea
+#
+# The same seed and number of fixes always make the same corpus.
+
+import random
+import sys
+
+
+def checksum(body):
+    c = 0
+    for ch in body:
+        c ^= ord(ch)
+    return c
+
+
+def sentence(body, lower=False):
+    return "$%s*%s\r\n" % (body, ("%02x" if lower else "%02X") % checksum(body))
+
+
+def ddmm(v, lon):
+    a = abs(v)
+    d = int(a)
+    return (("%03d%07.4f" if lon else "%02d%07.4f") % (d, (a - d) * 60),
+            ("EW" if lon else "NS")[v < 0])
+
+
+def fixes(n):
+    out = []
+    lat, lon = 40.7128, -74.0060
+    t = 0.0
+    for k in range(n):
+        t += 0.1
+        lat += random.uniform(-1e-4, 1e-4)
+        lon += random.uniform(-1e-4, 1e-4)
+        if random.random() < 0.01:
+            lat, lon = random.uniform(-89, 89), random.uniform(-179, 179)
+        tm = "%02d%02d%06.3f" % (int(t // 3600) % 24, int(t // 60) % 60, t % 60)
+        la, ns = ddmm(lat, False)
+        lo, ew = ddmm(lon, True)
+        q = random.choice([0, 1, 1, 1, 2])
+        sats = random.randint(0, 14)
+        hdop = random.uniform(0.5, 9.9)
+        alt = random.uniform(-50, 3000)
+        geo = random.uniform(-40, 40)
+        talk = random.choice(["GP", "GP", "GN", "II"])
+        out.append(sentence("%sGGA,%s,%s,%s,%s,%s,%d,%02d,%.2f,%.1f,M,%.1f,M,,"
+                            % (talk, tm, la, ns, lo, ew, q, sats, hdop, alt,
+                               geo)))
+        spd = random.uniform(0, 80)
+        ang = random.uniform(0, 359.99)
+        date = "%02d%02d%02d" % (random.randint(1, 28), random.randint(1, 12),
+                                 random.randint(0, 99))
+        out.append(sentence("%sRMC,%s,%s,%s,%s,%s,%s,%.2f,%.2f,%s,,,A"
+                            % (talk, tm, random.choice("AV"), la, ns, lo, ew,
+                               spd, ang, date), random.random() < 0.1))
+        if k % 5 == 0:
+            prns = ",".join(str(random.randint(1, 32))
+                            if random.random() < .6 else "" for _ in range(12))
+            out.append(sentence("GPGSA,A,%d,%s,%.2f,%.2f,%.2f"
+                                % (random.randint(1, 3), prns,
+                                   random.uniform(1, 9), hdop,
+                                   random.uniform(1, 9))))
+            out.append(sentence("GPGLL,%s,%s,%s,%s,%s,%s"
+                                % (la, ns, lo, ew, tm, random.choice("AV"))))
+            for i in range(3):
+                sats = ",".join("%02d,%02d,%03d,%02d"
+                                % (random.randint(1, 32), random.randint(0, 90),
+                                   random.randint(0, 359),
+                                   random.randint(0, 50)) for _ in range(4))
+                out.append(sentence("GPGSV,3,%d,11,%s" % (i + 1, sats)))
+            out.append(sentence("GPVTG,%.2f,T,,M,%.2f,N,%.2f,K,A"
+                                % (ang, spd, spd * 1.852)))
+        if k % 10 == 0:
+            out.append(sentence("PGTOP,11,%d" % random.randint(1, 3)))
+            out.append(sentence("PMTK001,314,3"))
+        if k % 3 == 0:
+            out += marine(tm, la, ns, lo, ew)
+        out += damage(out)
+    return out
+
+
+def marine(tm, la, ns, lo, ew):
+    u = random.uniform
+    d = u(0.5, 200)
+    bodies = [
+        "IIDBT,%.1f,f,%.1f,M,%.1f,F" % (d / 0.3048, d, d / 1.8288),
+        "IIHDM,%.1f,M" % u(0, 359),
+        "IIHDT,%.1f,T" % u(0, 359),
+        "WIMWV,%.1f,%s,%.1f,%s,%s" % (u(0, 359), random.choice("RT"),
+                                      u(0, 40), random.choice("NKM"),
+                                      random.choice("AV")),
+        "WIMDA,%.4f,I,%.4f,B,%.1f,C,%.1f,%s,%.1f,,,,,,,,,,,,"
+        % (u(29, 31), u(0.98, 1.04), u(-10, 40), u(0, 90),
+           random.choice("CF"), u(10, 90)),
+        "IIMTW,%.1f,%s" % (u(0, 30), random.choice("CF")),
+        "IIVHW,%.1f,T,%.1f,M,%.2f,N,%.2f,K" % (u(0, 359), u(0, 359), u(0, 9),
+                                               u(0, 16)),
+        "IIVLW,%.1f,N,%.1f,N" % (u(0, 9999), u(0, 99)),
+        "IIVPW,%.2f,N,," % u(-9, 9),
+        "IIVWR,%.1f,%s,%.1f,N,%.1f,M,%.1f,K" % (u(0, 180), random.choice("LR"),
+                                                u(0, 30), u(0, 15), u(0, 55)),
+        "IIWCV,%.2f,N,WP1" % u(0, 9),
+        "IIXTE,A,A,%.2f,%s,N" % (u(0, 3), random.choice("LR")),
+        "IIRMB,A,%.2f,%s,FROM1,TO1,%s,%s,%s,%s,%.1f,%.1f,%.1f,V"
+        % (u(0, 3), random.choice("LR"), la, ns, lo, ew, u(0, 99), u(0, 359),
+           u(-9, 9)),
+        "GPTXT,01,01,02,ANTSTATUS=OK",
+        "IIZDA,%s,01,02,2020,," % tm,
+        "IIAPB,A,A,0.10,R,N,V,V,011,M,DEST,011,M,011,M",
+    ]
+    return [sentence(b) for b in bodies]
+
+
+def damage(out):
+    r = random.random()
+    if r < 0.05:  # a changed character
+        s = list(random.choice(out[-5:]))
+        s[random.randrange(1, len(s) - 4)] = chr(random.randint(0x21, 0x7e))
+        return ["".join(s)]
+    if r < 0.07:
+        return [random.choice(out[-5:]).replace("*", "", 1)]
+    if r < 0.08:  # too long for the buffer
+        return [sentence("GPGGA," + ",".join("123.456" for _ in range(20)))]
+    if r < 0.09:  # no $
+        return ["".join(chr(random.randint(0x20, 0x7e))
+                        for _ in range(random.randint(0, 90))) + "\r\n"]
+    if r < 0.10:  # the last * is the checksum
+        return [sentence("GPTXT,01,01,02,A*B")]
+    if r < 0.11:
+        return [sentence("GPTXT,01,01,02,\xb0C")]
+    if r < 0.12:  # no CR and no checksum digits
+        return ["$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,"
+                "M,,*\n"]
+    if r < 0.13:
+        return ["!AIVDM,1,1,,B,177KQJ5000G?tO`K>RA1wUbN0TKH,0*5C\r\n"]
+    if r < 0.14:
+        return [sentence("GPXYZ,1,2,3"), sentence("QQGGA,1,2,3")]
+    return []
+
+
+def main():
+    random.seed(int(sys.argv[1]) if len(sys.argv) > 1 else 1)
+    out = fixes(int(sys.argv[2]) if len(sys.argv) > 2 else 6000)
+    sys.stdout.buffer.write("".join(out).encode("latin-1"))
+
+
+if __name__ == "__main__":
+    main()
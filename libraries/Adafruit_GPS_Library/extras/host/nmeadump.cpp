@@ -0,0 +1,191 @@
+// Feeds an NMEA corpus through read() and parse() a character at a time and
+// prints, for each line received, whether it parsed, the check result, the
+// ids, and every parsed value that changed, so the output of two versions
+// of the library can be compared.  With -b, prints the bytes per second and
+// the longest read() and parse() instead.
+//
+// With -a it reads with readAll(false), which stops at the end of each
+// sentence for the caller to parse(), and with -e with readAll(true), which
+// parses each sentence itself.  Both must print the same as read().  For
+// -e the stream hands over a line at a time so each one can be printed,
+// and a line parsed if parse() filled in lastSentence after it was
+// cleared.  With -b the whole corpus is waiting at once in every mode.
+//
+// Usage: nmeadump [-b] [-a | -e] <corpus>
+#include <chrono> // before Arduino.h defines min and max
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+#include <Adafruit_GPS.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+static unsigned long now = 1; // millis()
+unsigned long millis(void) { return now; }
+unsigned long micros(void) { return now * 1000; }
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+/** Stream that plays a buffer, all of it or up to a line end at a time */
+class MemoryStream : public Stream {
+public:
+  MemoryStream(const std::vector<uint8_t> &v)
+      : p(v.data()), end(v.data() + v.size()), limit(end) {}
+  int available(void) { return limit - p; }
+  int read(void) { return p < limit ? *p++ : -1; }
+  int peek(void) { return p < limit ? *p : -1; }
+  size_t write(uint8_t) { return 1; }
+  using Print::write;
+  /** let read() go as far as the next '\n', or the end */
+  void nextLine(void) {
+    limit = (const uint8_t *)memchr(p, '\n', end - p);
+    limit = limit ? limit + 1 : end;
+  }
+  /** @return whether there is anything left, available or not */
+  bool more(void) { return p < end; }
+
+private:
+  const uint8_t *p, *end, *limit;
+};
+
+static std::vector<std::string> last; // values printed before
+//------------------------------------------------------------------------------
+// print name=value if it changed since it was last printed
+static void field(unsigned i, const char *name, const char *format, ...) {
+  char value[80];
+  va_list ap;
+  va_start(ap, format);
+  vsnprintf(value, sizeof(value), format, ap);
+  va_end(ap);
+  if (last.size() <= i)
+    last.resize(i + 1);
+  if (last[i] != value) {
+    printf(" %s=%s", name, value);
+    last[i] = value;
+  }
+}
+//------------------------------------------------------------------------------
+static void dump(Adafruit_GPS &g, bool ok) {
+  unsigned i = 0;
+  printf("%d %d %s %s", ok, g.thisCheck, g.thisSource, g.thisSentence);
+  field(i++, "last", "%s %s", g.lastSource, g.lastSentence);
+  field(i++, "time", "%02d:%02d:%02d.%03d", g.hour, g.minute, g.seconds,
+        g.milliseconds);
+  field(i++, "date", "%02d/%02d/%02d", g.day, g.month, g.year);
+  field(i++, "lat", "%.6f %c %ld %.7f", g.latitude, g.lat ? g.lat : '0',
+        (long)g.latitude_fixed, g.latitudeDegrees);
+  field(i++, "lon", "%.6f %c %ld %.7f", g.longitude, g.lon ? g.lon : '0',
+        (long)g.longitude_fixed, g.longitudeDegrees);
+  field(i++, "geoid", "%.3f", g.geoidheight);
+  field(i++, "alt", "%.3f", g.altitude);
+  field(i++, "speed", "%.3f", g.speed);
+  field(i++, "angle", "%.3f", g.angle);
+  field(i++, "mag", "%.3f %c", g.magvariation, g.mag ? g.mag : '0');
+  field(i++, "dop", "%.3f %.3f %.3f", g.HDOP, g.VDOP, g.PDOP);
+  field(i++, "fix", "%d %d %d", g.fix, g.fixquality, g.fixquality_3d);
+  field(i++, "sats", "%d", g.satellites);
+  field(i++, "antenna", "%d", g.antenna);
+#ifdef NMEA_EXTENSIONS
+  for (int v = 0; v < NMEA_MAX_INDEX; v++) {
+    char name[8];
+    snprintf(name, sizeof(name), "v%d", v);
+    field(i++, name, "%.4f", g.val[v].latest);
+  }
+  field(i++, "wp", "%s %s", g.fromID, g.toID);
+  field(i++, "txt", "[%s] %d %d %d", g.txtTXT, g.txtTot, g.txtID, g.txtN);
+#endif // NMEA_EXTENSIONS
+  printf("\n");
+}
+//------------------------------------------------------------------------------
+int main(int argc, char **argv) {
+  bool bench = false;
+  char mode = 'r'; // read(), readAll(false) or readAll(true)
+  int arg = 1;
+  for (; arg < argc - 1; arg++) {
+    if (!strcmp(argv[arg], "-b"))
+      bench = true;
+    else if (!strcmp(argv[arg], "-a") || !strcmp(argv[arg], "-e"))
+      mode = argv[arg][1];
+    else
+      break;
+  }
+  if (arg != argc - 1) {
+    puts("usage: nmeadump [-b] [-a | -e] <corpus>");
+    return 2;
+  }
+  FILE *f = fopen(argv[arg], "rb");
+  if (!f)
+    return 2;
+  std::vector<uint8_t> corpus;
+  for (int c; (c = fgetc(f)) >= 0;)
+    corpus.push_back(c);
+  fclose(f);
+
+  typedef std::chrono::steady_clock clock;
+  typedef std::chrono::duration<double, std::nano> ns;
+  double readNs = 0, parseNs = 0, maxReadNs = 0, maxParseNs = 0;
+  unsigned long sentences = 0;
+  int passes = bench ? 50 : 1;
+  for (int pass = 0; pass < passes; pass++) {
+    MemoryStream s(corpus);
+    Adafruit_GPS gps(&s);
+    while (s.more()) {
+      now++;
+      if (mode == 'e' && !bench)
+        s.nextLine();
+      clock::time_point t0 = clock::now();
+      char sentence[NMEA_MAX_SENTENCE_ID];
+      strcpy(sentence, gps.lastSentence);
+      gps.lastSentence[0] = 0; // for readAll(true) to show it parsed
+      uint16_t n = 0;
+      if (mode == 'r')
+        gps.read();
+      else
+        n = gps.readAll(mode == 'e');
+      double dt = ns(clock::now() - t0).count();
+      readNs += dt;
+      if (dt > maxReadNs && pass)
+        maxReadNs = dt;
+      bool ok = gps.lastSentence[0];
+      if (!ok)
+        strcpy(gps.lastSentence, sentence);
+      if (mode == 'e') { // readAll() did the parsing
+        sentences += n;
+        if (n && !bench)
+          dump(gps, ok);
+        continue;
+      }
+      if (!gps.newNMEAreceived())
+        continue;
+      char *line = gps.lastNMEA();
+      t0 = clock::now();
+      ok = gps.parse(line);
+      dt = ns(clock::now() - t0).count();
+      parseNs += dt;
+      if (dt > maxParseNs && pass)
+        maxParseNs = dt;
+      sentences++;
+      if (!bench)
+        dump(gps, ok);
+    }
+  }
+  if (bench) {
+    static const char *how[] = {"read() and parse()",
+                                "readAll(false) and parse()", "readAll(true)"};
+    double bytes = (double)corpus.size() * passes;
+    printf("%.1f MB/s through %s, %.1f ns per byte read",
+           bytes / (readNs + parseNs) * 1e3,
+           how[mode == 'r' ? 0 : mode == 'a' ? 1 : 2], readNs / bytes);
+    if (mode != 'e')
+      printf(", %.0f ns per parse()", parseNs / sentences);
+    printf("\nlongest %s %.0f ns", mode == 'r' ? "read()" : "readAll()",
+           maxReadNs);
+    if (mode != 'e')
+      printf(", parse() %.0f ns", maxParseNs);
+    printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,184 @@
+// Builds every sentence build() knows from random values, parses it back
+// with parse() and checks the values came through to the places build()
+// writes, the fixed point position exactly.  Then builds them again with
+// no directions set yet, which must give empty direction fields rather
+// than a 0 byte in the sentence.  Prints the number of failures and exits
+// non-zero if there were any.
+//
+// Usage: roundtrip
+#include <math.h>
+
+#include <Adafruit_GPS.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+unsigned long millis(void) { return 1; }
+unsigned long micros(void) { return 1000; }
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+static const char *sentences[] = {"GGA", "GLL", "RMC", "DBT", "HDM", "HDT",
+                                  "MWV", "RMB", "TXT", "VHW", "VPW", "WCV"};
+static int bad = 0;
+
+static void fail(const char *s, const char *what, const char *nmea) {
+  if (bad++ < 20)
+    printf("%s %s: %.*s\n", s, what, (int)strcspn(nmea, "\r\n"), nmea);
+}
+
+static void near(const char *s, const char *what, const char *nmea, double a,
+                 double b, double tol) {
+  if (fabs(a - b) > tol)
+    fail(s, what, nmea);
+}
+
+static bool is(const char *a, const char *b) { return !strcmp(a, b); }
+
+// a random position in all the forms parse() gives, as build() writes the
+// fixed point one
+static void coord(nmea_float_t &dddmm, int32_t &fixed, nmea_float_t &degrees,
+                  char &dir, int most, const char *dirs) {
+  int32_t d = rand() % most, m = rand() % 600000; // 1e-4 minutes
+  dddmm = d * 100 + m / 10000.0;
+  fixed = d * 10000000 + m * 1000 / 60; // truncated, as parseCoord() does
+  dir = dirs[rand() % 2];
+  if (dir == dirs[1])
+    fixed = -fixed;
+  degrees = fixed / 10000000.0;
+}
+
+static void randomise(Adafruit_GPS &g) {
+  g.hour = rand() % 24;
+  g.minute = rand() % 60;
+  g.seconds = rand() % 60;
+  g.milliseconds = rand() % 100 * 10;
+  g.day = 1 + rand() % 28;
+  g.month = 1 + rand() % 12;
+  g.year = rand() % 100;
+  coord(g.latitude, g.latitude_fixed, g.latitudeDegrees, g.lat, 90, "NS");
+  coord(g.longitude, g.longitude_fixed, g.longitudeDegrees, g.lon, 180, "EW");
+  g.fixquality = rand() % 3;
+  g.satellites = rand() % 13;
+  g.HDOP = rand() % 5000 / 100.0;
+  g.altitude = (rand() % 200000 - 1000) / 10.0;
+  g.geoidheight = (rand() % 2000 - 1000) / 10.0;
+  g.speed = rand() % 10000 / 100.0;
+  g.angle = rand() % 36000 / 100.0;
+  g.magvariation = rand() % 3000 / 100.0;
+  g.mag = rand() % 2 ? 'E' : 'W';
+  g.val[NMEA_DEPTH].latest = rand() % 100000 / 100.0;
+  g.val[NMEA_HDG].latest = rand() % 3600 / 10.0;
+  g.val[NMEA_HDT].latest = rand() % 3600 / 10.0;
+  g.val[NMEA_AWA].latest = rand() % 3600 / 10.0 - 180;
+  g.val[NMEA_AWS].latest = rand() % 5000 / 100.0;
+  g.val[NMEA_VTW].latest = rand() % 2000 / 100.0;
+  g.val[NMEA_VMG].latest = (rand() % 2000 - 1000) / 100.0;
+}
+
+static void check(Adafruit_GPS &src, Adafruit_GPS &dst, const char *s,
+                  const char *nmea) {
+  if (is(s, "GGA") || is(s, "GLL") || is(s, "RMC")) {
+    near(s, "latitude", nmea, dst.latitude, src.latitude, 1e-3);
+    near(s, "longitude", nmea, dst.longitude, src.longitude, 2e-3);
+    if (dst.latitude_fixed != src.latitude_fixed ||
+        dst.longitude_fixed != src.longitude_fixed)
+      fail(s, "fixed position", nmea);
+    if (dst.lat != src.lat || dst.lon != src.lon)
+      fail(s, "direction", nmea);
+    if (dst.hour != src.hour || dst.minute != src.minute ||
+        dst.seconds != src.seconds || dst.milliseconds != src.milliseconds)
+      fail(s, "time", nmea);
+  }
+  if (is(s, "GGA")) {
+    near(s, "HDOP", nmea, dst.HDOP, src.HDOP, 0.006);
+    near(s, "altitude", nmea, dst.altitude, src.altitude, 0.06);
+    near(s, "geoidheight", nmea, dst.geoidheight, src.geoidheight, 0.06);
+    if (dst.satellites != src.satellites || dst.fixquality != src.fixquality)
+      fail(s, "fix", nmea);
+  }
+  if (is(s, "RMC")) {
+    near(s, "speed", nmea, dst.speed, src.speed, 0.006);
+    near(s, "angle", nmea, dst.angle, src.angle, 0.006);
+    if (dst.day != src.day || dst.month != src.month || dst.year != src.year)
+      fail(s, "date", nmea);
+  }
+  static const struct {
+    const char *s;
+    uint8_t i;
+    double tol;
+  } values[] = {{"DBT", NMEA_DEPTH, 0.006}, {"HDM", NMEA_HDG, 0.06},
+                {"HDT", NMEA_HDT, 0.06},    {"MWV", NMEA_AWA, 0.06},
+                {"MWV", NMEA_AWS, 0.006},   {"VHW", NMEA_VTW, 0.006},
+                {"VPW", NMEA_VMG, 0.006}};
+  for (auto &v : values)
+    if (is(s, v.s))
+      near(s, "value", nmea, dst.val[v.i].latest, src.val[v.i].latest, v.tol);
+}
+
+// a sentence must be printable up to the * and end in *hh\r\n
+static bool wellFormed(const char *nmea) {
+  const char *star = strchr(nmea, '*');
+  if (!star || strcmp(star + 3, "\r\n"))
+    return false;
+  for (const char *p = nmea; p < star; p++)
+    if (*p < ' ' || *p > '~')
+      return false;
+  return true;
+}
+
+int main(void) {
+  Adafruit_GPS src, dst;
+  char nmea[120];
+  long built = 0;
+
+  // no directions yet, as before the first fix
+  src.latitude = 4043.5001;
+  src.latitude_fixed = 407250016;
+  src.longitude = 7400.2502;
+  src.longitude_fixed = 740041700;
+  src.day = 19;
+  src.month = 10;
+  for (const char *s : sentences) {
+    if (!src.build(nmea, "GP", s)) {
+      fail(s, "no build", "");
+      continue;
+    }
+    if (!wellFormed(nmea))
+      fail(s, "zero direction", nmea);
+    else if (!dst.parse(nmea))
+      fail(s, "zero direction no parse", nmea);
+    else if (is(s, "RMC") && (dst.day != src.day || dst.month != src.month))
+      fail(s, "zero direction fields after", nmea);
+  }
+
+  // minutes that round up to the next degree
+  src.latitude_fixed = -129999999;
+  src.lat = 'S';
+  src.longitude_fixed = 1799999995;
+  src.lon = 'E';
+  const char *rounded = "$GPGLL,1300.0000,S,18000.0000,E,";
+  if (!src.build(nmea, "GP", "GLL") || strncmp(nmea, rounded, strlen(rounded)))
+    fail("GLL", "rounded to a degree", nmea);
+
+  srand(1);
+  for (int k = 0; k < 20000; k++) {
+    randomise(src);
+    for (const char *s : sentences) {
+      if (!src.build(nmea, "GP", s)) {
+        fail(s, "no build", "");
+        continue;
+      }
+      built++;
+      if (!wellFormed(nmea))
+        fail(s, "badly formed", nmea);
+      else if (!dst.parse(nmea))
+        fail(s, "no parse", nmea);
+      else
+        check(src, dst, s, nmea);
+    }
+  }
+  printf("%ld built, %d bad\n", built, bad);
+  return bad != 0;
+}
@@ -0,0 +1,200 @@
+// Runs Adafruit_NMEA_Router for a minute of simulated time with two inputs
+// playing corpus.nmea at 9600 and 4800 baud, and three outputs with the 64
+// byte transmit buffer of an AVR serial port: everything at 38400 baud, GGA
+// and RMC once a second at 4800 baud, everything at 1200 baud, which can't
+// keep up, and a port that has stalled.  Every line an output gets must be
+// a whole sentence with a good checksum that is on its list, the counts
+// for each output must add up to the sentences received, the GGA and RMC
+// lines longer than the transmit buffer must get through, and the slow and
+// stalled ports must not cost the others any sentences.  Built with
+// NMEA_ROUTER_OUTPUTS 4.  Prints the
+// counts for each input and output, the sentences per second service()
+// handles, and the number of failures, and exits non-zero if there were
+// any.  With -b it runs ten minutes and prints only the sentences per
+// second.
+//
+// Usage: router [-b] <corpus>
+#include <chrono> // before Arduino.h defines min and max
+#include <string>
+#include <vector>
+
+#include <NMEA_router.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+static unsigned long now = 1; // millis()
+unsigned long millis(void) { return now; }
+unsigned long micros(void) { return now * 1000; }
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+#define TX_BUFFER 64 // bytes, as in HardwareSerial on AVR
+
+static int bad = 0;
+
+static void fail(const char *what, const char *port) {
+  if (bad++ < 20)
+    printf("%s (%s)\n", what, port);
+}
+
+/** Stream that plays a corpus over and over at a baud rate */
+class SerialIn : public Stream {
+public:
+  SerialIn(const std::vector<uint8_t> &v, unsigned long baud, size_t start)
+      : corpus(v), baud(baud), pos(start) {}
+  int available(void) { return arrived() - taken; }
+  int read(void) {
+    if (!available())
+      return -1;
+    taken++;
+    int c = corpus[pos++];
+    if (pos == corpus.size())
+      pos = 0;
+    return c;
+  }
+  int peek(void) { return available() ? corpus[pos] : -1; }
+  size_t write(uint8_t) { return 1; }
+  using Print::write;
+
+private:
+  // characters sent by now, at 10 bits a character
+  unsigned long arrived(void) { return (unsigned long long)now * baud / 10000; }
+  const std::vector<uint8_t> &corpus;
+  unsigned long baud, taken = 0;
+  size_t pos;
+};
+
+/** Print with a transmit buffer emptied at a baud rate, or not at all */
+class SerialOut : public Print {
+public:
+  SerialOut(unsigned long baud) : baud(baud) {}
+  int availableForWrite(void) {
+    drain();
+    return TX_BUFFER - buffered;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) {
+    drain();
+    n = min(n, (size_t)(TX_BUFFER - buffered));
+    wire.append((const char *)b, n);
+    buffered += n;
+    return n;
+  }
+  std::string wire; // everything written, sent or still in the buffer
+
+private:
+  void drain(void) {
+    unsigned long sent = (unsigned long long)now * baud / 10000;
+    unsigned long n = min(sent - drained, buffered);
+    buffered -= n;
+    drained = buffered ? drained + n : sent; // time spent idle is gone
+  }
+  unsigned long baud, drained = 0, buffered = 0;
+};
+
+static const char *positionOnly[] = {"GGA", "RMC", "ZZ"};
+static const char *names[] = {"plotter", "autopilot", "logger", "stalled"};
+
+// a whole sentence with a good checksum
+static bool good(const std::string &s) {
+  size_t star = s.rfind('*');
+  if ((s[0] != '$' && s[0] != '!') || star == std::string::npos ||
+      s.size() < star + 5 || s.compare(s.size() - 2, 2, "\r\n"))
+    return false;
+  uint8_t sum = 0;
+  for (size_t i = 1; i < star; i++)
+    sum ^= s[i];
+  return strtol(s.substr(star + 1, 2).c_str(), NULL, 16) == sum;
+}
+
+// check what each output got, and print the counts
+static void check(Adafruit_NMEA_Router &router, SerialOut **outs,
+                  uint32_t received) {
+  printf("input  sentences  bad  tooLong  noBuffer\n");
+  for (uint8_t i = 0; i < router.nInputs; i++) {
+    nmea_router_input_t &r = router.inputs[i];
+    printf("%5d  %9lu  %3lu  %7lu  %8lu\n", i, (unsigned long)r.sentences,
+           (unsigned long)r.bad, (unsigned long)r.tooLong,
+           (unsigned long)r.noBuffer);
+    if (r.noBuffer)
+      fail("an input found the pool empty", "input");
+  }
+  printf("output     sent  filtered  limited  dropped  maxDepth\n");
+  for (uint8_t i = 0; i < router.nOutputs; i++) {
+    nmea_router_output_t &o = router.outputs[i];
+    printf("%-9s %5lu  %8lu  %7lu  %7lu  %8d\n", names[i],
+           (unsigned long)o.sent, (unsigned long)o.filtered,
+           (unsigned long)o.limited, (unsigned long)o.dropped, o.maxDepth);
+    if (o.sent + o.filtered + o.limited + o.dropped + o.depth != received)
+      fail("counts don't add up to the sentences received", names[i]);
+
+    uint32_t lines = 0;
+    size_t longest = 0;
+    const std::string &w = outs[i]->wire;
+    for (size_t p = 0, e; (e = w.find('\n', p)) != std::string::npos;
+         p = e + 1) {
+      std::string s = w.substr(p, e + 1 - p);
+      lines++;
+      longest = max(longest, s.size());
+      if (!good(s))
+        fail("a broken sentence", names[i]);
+      else if (o.list && s.compare(3, 3, "GGA") && s.compare(3, 3, "RMC"))
+        fail("a sentence not on the list", names[i]);
+    }
+    if (lines != o.sent)
+      fail("lines written differ from sent", names[i]);
+    if (o.list && longest <= TX_BUFFER)
+      fail("no line longer than the transmit buffer", names[i]);
+  }
+  if (router.outputs[0].dropped || router.outputs[1].dropped)
+    fail("a port that keeps up lost sentences", "plotter or autopilot");
+  if (!router.outputs[2].dropped)
+    fail("the slow port wasn't dropping", names[2]);
+  if (!router.outputs[3].dropped || router.outputs[3].sent > 1)
+    fail("the stalled port wasn't dropping", names[3]);
+}
+
+int main(int argc, char **argv) {
+  bool bench = argc == 3 && !strcmp(argv[1], "-b");
+  if (argc != 2 && !bench) {
+    puts("usage: router [-b] <corpus>");
+    return 2;
+  }
+  FILE *f = fopen(argv[argc - 1], "rb");
+  if (!f)
+    return 2;
+  std::vector<uint8_t> corpus;
+  for (int c; (c = fgetc(f)) >= 0;)
+    corpus.push_back(c);
+  fclose(f);
+
+  SerialIn gps(corpus, 9600, 0), sounder(corpus, 4800, corpus.size() / 2);
+  SerialOut plotter(38400), autopilot(4800), logger(1200), stalled(0);
+  SerialOut *outs[] = {&plotter, &autopilot, &logger, &stalled};
+  Adafruit_NMEA_Router router;
+  router.addInput(&gps);
+  router.addInput(&sounder);
+  router.addOutput(&plotter);
+  router.addOutput(&autopilot, positionOnly, 1000);
+  router.addOutput(&logger);
+  router.addOutput(&stalled);
+
+  typedef std::chrono::steady_clock clock;
+  double seconds = 0;
+  uint32_t received = 0;
+  unsigned long ms = bench ? 600000 : 60000;
+  for (now = 1; now <= ms; now++) {
+    clock::time_point t0 = clock::now();
+    received += router.service();
+    seconds += std::chrono::duration<double>(clock::now() - t0).count();
+  }
+  printf("%.0f sentences per second through service(), %lu in %lu s\n",
+         received / seconds, (unsigned long)received, ms / 1000);
+  if (bench)
+    return 0;
+  check(router, outs, received);
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
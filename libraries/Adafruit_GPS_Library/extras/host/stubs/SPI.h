@@ -0,0 +1,18 @@
+#ifndef SPI_h
+#define SPI_h
+#include "Arduino.h"
+#define SPI_MODE0 0
+class SPISettings {
+public:
+  SPISettings(void) {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+class SPIClass {
+public:
+  void begin(void) {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t b) { return b; }
+};
+extern SPIClass SPI;
+#endif // SPI_h
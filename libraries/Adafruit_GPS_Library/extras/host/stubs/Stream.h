@@ -0,0 +1,21 @@
+#ifndef Stream_h
+#define Stream_h
+#include "Print.h"
+class Stream : public Print {
+public:
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+  virtual int peek(void) = 0;
+};
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  int available(void) { return 0; }
+  int read(void) { return -1; }
+  int peek(void) { return -1; }
+  size_t write(uint8_t c) { return putchar(c) != EOF; }
+  using Print::write;
+  operator bool() { return true; }
+};
+extern HardwareSerial Serial;
+#endif // Stream_h
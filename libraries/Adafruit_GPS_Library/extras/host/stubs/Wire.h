@@ -0,0 +1,18 @@
+#ifndef Wire_h
+#define Wire_h
+#include "Arduino.h"
+class TwoWire : public Stream {
+public:
+  void begin(void) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 0; }
+  uint8_t requestFrom(uint8_t, size_t, bool = true) { return 0; }
+  int available(void) { return 0; }
+  int read(void) { return -1; }
+  int peek(void) { return -1; }
+  size_t write(uint8_t) { return 1; }
+  using Print::write;
+  void setClock(uint32_t) {}
+};
+extern TwoWire Wire;
+#endif // Wire_h
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+
+# Converts fence polygons to the PROGMEM tables used by geoInFence() (see
+# NMEA_geo.h for a description of the grid), writing a .h file to stdout.
+#
+# Input is a GeoJSON file with Polygon or MultiPolygon features, of which
+# only the outer rings are used, or a text file with one polygon per line
+# as space separated lat,lon pairs in decimal degrees. Lines starting with #
+# are ignored.
+#
+# Usage: fencegrid.py [--name NAME] [--cells N] <fences.json|fences.txt> > out.h
+#
+# The grid has about --cells cells (default 256) over the bounding box of
+# all the polygons, as near square on the ground as will fit. More cells use
+# more flash and make more checks quick. Polygons may not cross the 180
+# degree meridian, and there can be at most 127 of them.
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+
+INSIDE = 0x80
+MAXPOLYGONS = 127
+
+
+def load_text(path):
+    polygons = []
+    for line in open(path):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        ring = []
+        for pair in line.split():
+            lat, lon = pair.split(",")
+            ring.append((float(lat), float(lon)))
+        polygons.append(ring)
+    return polygons
+
+
+def load_geojson(path):
+    data = json.load(open(path))
+    features = data.get("features", [data])
+    polygons = []
+    for f in features:
+        g = f.get("geometry", f)
+        if g["type"] == "Polygon":
+            rings = [g["coordinates"][0]]
+        elif g["type"] == "MultiPolygon":
+            rings = [p[0] for p in g["coordinates"]]
+        else:
+            continue
+        for ring in rings:  # GeoJSON is lon,lat
+            polygons.append([(lat, lon) for lon, lat in ring])
+    return polygons
+
+
+def to_fixed(polygons):
+    fixed = []
+    for ring in polygons:
+        pts = [(int(round(lat * 1e7)), int(round(lon * 1e7)))
+               for lat, lon in ring]
+        if len(pts) > 1 and pts[0] == pts[-1]:
+            pts.pop()  # closed rings repeat the first vertex
+        if len(pts) < 3:
+            sys.exit("fencegrid: a polygon has fewer than 3 vertices")
+        fixed.append(pts)
+    return fixed
+
+
+def inside(pts, lat, lon):
+    # the same crossing test as geoInPolygon()
+    result = False
+    a = pts[-1]
+    for b in pts:
+        if (a[0] > lat) != (b[0] > lat):
+            cross = (b[1] - a[1]) * (lat - a[0]) - (lon - a[1]) * (b[0] - a[0])
+            if (cross > 0) == (b[0] > a[0]):
+                result = not result
+        a = b
+    return result
+
+
+def segment_hits_box(a, b, box):
+    # Liang-Barsky clipping of the segment a-b to the box
+    lat0, lon0, lat1, lon1 = box
+    t0, t1 = 0.0, 1.0
+    dlat, dlon = b[0] - a[0], b[1] - a[1]
+    for p, q in ((-dlat, a[0] - lat0), (dlat, lat1 - a[0]),
+                 (-dlon, a[1] - lon0), (dlon, lon1 - a[1])):
+        if p == 0:
+            if q < 0:
+                return False
+        else:
+            t = q / p
+            if p < 0:
+                t0 = max(t0, t)
+            else:
+                t1 = min(t1, t)
+            if t0 > t1:
+                return False
+    return True
+
+
+def cell_entry(index, pts, box):
+    # box is a little bigger than the cell, so a cell marked inside has no
+    # edge anywhere near it and every point in it really is inside
+    a = pts[-1]
+    for b in pts:
+        if segment_hits_box(a, b, box):
+            return index
+        a = b
+    lat = (box[0] + box[2]) // 2
+    lon = (box[1] + box[3]) // 2
+    if inside(pts, lat, lon):
+        return index | INSIDE
+    if box[0] <= pts[0][0] <= box[2] and box[1] <= pts[0][1] <= box[3]:
+        return index  # the whole polygon is inside the cell
+    return None
+
+
+def make_grid(polygons, cells):
+    lat0 = min(p[0] for pts in polygons for p in pts)
+    lon0 = min(p[1] for pts in polygons for p in pts)
+    lat1 = max(p[0] for pts in polygons for p in pts) + 1
+    lon1 = max(p[1] for pts in polygons for p in pts) + 1
+    # as near square on the ground as will fit in the number of cells
+    height = lat1 - lat0
+    width = (lon1 - lon0) * math.cos(math.radians((lat0 + lat1) / 2e7))
+    width = max(width, 1)
+    rows = max(1, min(255, int(round(math.sqrt(cells * height / width)))))
+    cols = max(1, min(255, cells // rows))
+    cell_lat = -(-height // rows)
+    cell_lon = -(-(lon1 - lon0) // cols)
+
+    boxes = []
+    for pts in polygons:
+        boxes.append((min(p[0] for p in pts), min(p[1] for p in pts),
+                      max(p[0] for p in pts), max(p[1] for p in pts)))
+    starts, entries = [], []
+    for r in range(rows):
+        for c in range(cols):
+            box = (lat0 + r * cell_lat - 1, lon0 + c * cell_lon - 1,
+                   lat0 + (r + 1) * cell_lat, lon0 + (c + 1) * cell_lon)
+            starts.append(len(entries))
+            for i, pts in enumerate(polygons):
+                b = boxes[i]
+                if (b[0] > box[2] or b[2] < box[0] or b[1] > box[3] or
+                        b[3] < box[1]):
+                    continue
+                e = cell_entry(i, pts, box)
+                if e is not None:
+                    entries.append(e)
+    starts.append(len(entries))
+    if len(entries) > 65535:
+        sys.exit("fencegrid: too many cell entries, use fewer --cells")
+    return lat0, lon0, cell_lat, cell_lon, rows, cols, boxes, starts, entries
+
+
+def c_list(values, per_line, fmt="%d"):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Make a geofence header")
+    parser.add_argument("--name", help="name of the fence (default: file name)")
+    parser.add_argument("--cells", type=int, default=256,
+                        help="roughly how many grid cells to use")
+    parser.add_argument("file")
+    args = parser.parse_args()
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(
+        os.path.basename(args.file))[0])
+    if args.file.lower().endswith((".json", ".geojson")):
+        polygons = to_fixed(load_geojson(args.file))
+    else:
+        polygons = to_fixed(load_text(args.file))
+    if not polygons:
+        sys.exit("fencegrid: no polygons in %s" % args.file)
+    if len(polygons) > MAXPOLYGONS:
+        sys.exit("fencegrid: %d polygons, at most %d" %
+                 (len(polygons), MAXPOLYGONS))
+    for pts in polygons:
+        if max(p[1] for p in pts) - min(p[1] for p in pts) > 1800000000:
+            sys.exit("fencegrid: a polygon crosses the 180 degree meridian")
+
+    (lat0, lon0, cell_lat, cell_lon, rows, cols, boxes, starts,
+     entries) = make_grid(polygons, args.cells)
+
+    points, polys = [], []
+    for pts, box in zip(polygons, boxes):
+        polys.append("    {%d, %d, %d, %d, %d, %d}" %
+                     (box[0], box[1], box[2], box[3], len(points), len(pts)))
+        points.extend(pts)
+    if len(points) > 65535:
+        sys.exit("fencegrid: too many vertices")
+
+    inside_cells = sum(1 for e in entries if e & INSIDE)
+    print("// Made by fencegrid.py from %s: %d polygons, %d vertices, "
+          "%dx%d grid" % (os.path.basename(args.file), len(polygons),
+                          len(points), rows, cols))
+    print("// %d cell entries, %d of them for cells wholly inside a polygon" %
+          (len(entries), inside_cells))
+    print()
+    print("#include <NMEA_geo.h>")
+    print()
+    print("const nmea_geo_point_t %s_points[] PROGMEM = {" % name)
+    print(",\n".join("    {%d, %d}" % p for p in points))
+    print("};")
+    print()
+    print("const nmea_geo_polygon_t %s_polygons[] PROGMEM = {" % name)
+    print(",\n".join(polys))
+    print("};")
+    print()
+    print("const uint16_t %s_cellStart[] PROGMEM = {" % name)
+    print(c_list(starts, 10))
+    print("};")
+    print()
+    print("const uint8_t %s_cellList[] PROGMEM = {" % name)
+    print(c_list(entries, 12, "0x%02X") if entries else "    0")
+    print("};")
+    print()
+    print("const nmea_geo_fence_t %s = {" % name)
+    print("    %d, %d, %d, %d, %d, %d," %
+          (lat0, lon0, cell_lat, cell_lon, rows, cols))
+    print("    %s_cellStart, %s_cellList, %s_polygons, %s_points};" %
+          (name, name, name, name))
+
+
+if __name__ == "__main__":
+    main()
@@ -267,13 +267,13 @@ size_t Adafruit_GPS::write(uint8_t c) {
     may overflow if there are frequent NMEA sentences. An 82 character NMEA
     sentence 10 times per second will require 820 calls per second, and
     once a loop() may not be enough. Check for newNMEAreceived() after at
-    least every 10 calls, or you may miss some short sentences.
+    least every 10 calls, or you may miss some short sentences. readAll()
+    takes everything waiting in one call.
     @return The character that we received, or 0 if nothing was available
 */
 /**************************************************************************/
 char Adafruit_GPS::read(void) {
-  static uint32_t firstChar = 0; // first character received in current sentence
-  uint32_t tStart = millis();    // as close as we can get to time char was sent
+  uint32_t tStart = millis(); // as close as we can get to time char was sent
   char c = 0;
 
   if (paused || noComms)
@@ -301,43 +301,14 @@ char Adafruit_GPS::read(void) {
       c = _i2cbuffer[_buff_idx];
       _buff_idx++;
     } else {
-      // refill the buffer!
-      if (gpsI2C->requestFrom((uint8_t)0x10, (uint8_t)GPS_MAX_I2C_TRANSFER,
-                              (uint8_t) true) == GPS_MAX_I2C_TRANSFER) {
-        // got data!
-        _buff_max = 0;
-        char curr_char = 0;
-        for (int i = 0; i < GPS_MAX_I2C_TRANSFER; i++) {
-          curr_char = gpsI2C->read();
-          if ((curr_char == 0x0A) && (last_char != 0x0D)) {
-            // skip duplicate 0x0A's - but keep as part of a CRLF
-            continue;
-          }
-          last_char = curr_char;
-          _i2cbuffer[_buff_max] = curr_char;
-          _buff_max++;
-        }
-        _buff_max--; // back up to the last valid slot
-        if ((_buff_max == 0) && (_i2cbuffer[0] == 0x0A)) {
-          _buff_max = -1; // ahh there was nothing to read after all
-        }
-        _buff_idx = 0;
-      }
+      readI2C();
       return c;
     }
   }
 
   if (gpsSPI) {
     do {
-      gpsSPI->beginTransaction(gpsSPI_settings);
-      if (gpsSPI_cs >= 0) {
-        digitalWrite(gpsSPI_cs, LOW);
-      }
-      c = gpsSPI->transfer(0xFF);
-      if (gpsSPI_cs >= 0) {
-        digitalWrite(gpsSPI_cs, HIGH);
-      }
-      gpsSPI->endTransaction();
+      c = readSPI();
       // skip duplicate 0x0A's - but keep as part of a CRLF
     } while (((c == 0x0A) && (last_char != 0x0D)) ||
              (!isprint(c) && !isspace(c)));
@@ -345,13 +316,188 @@ char Adafruit_GPS::read(void) {
   }
   // Serial.print(c);
 
+  addChar(c, tStart);
+  return c;
+}
+
+/**************************************************************************/
+/*!
+    @brief Read everything the GPS has waiting in one call, rather than a
+    character per call to read(). millis() is only called at the start and
+    once per sentence, so sentTime and recvdTime mean what they do with
+    read(). With parseEach, every sentence is parsed as soon as it is
+    complete, so none are lost, and the last one stays in lastNMEA() with
+    newNMEAreceived() false. Without it, reading stops at the end of the
+    first complete sentence so the caller can deal with it.
+    @param parseEach True to parse each sentence as it is completed
+    @param maxChars Most characters to read in this call, to bound the time
+    spent if the GPS sends faster than they can be handled
+    @return The number of sentences completed
+*/
+/**************************************************************************/
+uint16_t Adafruit_GPS::readAll(bool parseEach, uint16_t maxChars) {
+  uint16_t sentences = 0;
+  if (paused || noComms)
+    return sentences;
+
+  uint32_t t = millis(); // time for all the characters before the next '\n'
+  for (uint16_t i = 0; i < maxChars; i++) {
+    int c = nextChar();
+    if (c < 0)
+      break;
+    if (!addChar(c, t))
+      continue;
+    sentences++;
+    if (!parseEach)
+      break;
+    parse(lastNMEA());
+    t = millis();
+  }
+  return sentences;
+}
+
+/**************************************************************************/
+/*!
+    @brief Get the next character from the GPS for readAll() without waiting.
+    @return The character, or -1 if none is available
+*/
+/**************************************************************************/
+int Adafruit_GPS::nextChar(void) {
+#if (defined(__AVR__) || defined(ESP8266)) && defined(USE_SW_SERIAL)
+  if (gpsSwSerial)
+    return gpsSwSerial->read(); // -1 when empty, so no need for available()
+#endif
+  if (gpsHwSerial)
+    return gpsHwSerial->read();
+  if (gpsStream)
+    return gpsStream->read();
+  if (gpsI2C) {
+    if (_buff_idx > _buff_max && !readI2C())
+      return -1;
+    return _i2cbuffer[_buff_idx++];
+  }
+  if (gpsSPI) {
+    char c = readSPI();
+    // duplicate 0x0A's are what the GPS sends when it has nothing to say
+    if (((c == 0x0A) && (last_char != 0x0D)) || (!isprint(c) && !isspace(c)))
+      return -1;
+    last_char = c;
+    return c;
+  }
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief Refill the I2C buffer from the GPS.
+    @return True if the GPS sent any data
+*/
+/**************************************************************************/
+bool Adafruit_GPS::readI2C(void) {
+  if (gpsI2C->requestFrom((uint8_t)0x10, (uint8_t)GPS_MAX_I2C_TRANSFER,
+                          (uint8_t) true) != GPS_MAX_I2C_TRANSFER)
+    return false;
+  // got data!
+  _buff_max = 0;
+  char curr_char = 0;
+  for (int i = 0; i < GPS_MAX_I2C_TRANSFER; i++) {
+    curr_char = gpsI2C->read();
+    if ((curr_char == 0x0A) && (last_char != 0x0D)) {
+      // skip duplicate 0x0A's - but keep as part of a CRLF
+      continue;
+    }
+    last_char = curr_char;
+    _i2cbuffer[_buff_max] = curr_char;
+    _buff_max++;
+  }
+  _buff_max--; // back up to the last valid slot
+  if ((_buff_max == 0) && (_i2cbuffer[0] == 0x0A)) {
+    _buff_max = -1; // ahh there was nothing to read after all
+  }
+  _buff_idx = 0;
+  return _buff_max >= 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief Read one byte from the GPS over SPI.
+    @return The byte read
+*/
+/**************************************************************************/
+char Adafruit_GPS::readSPI(void) {
+  gpsSPI->beginTransaction(gpsSPI_settings);
+  if (gpsSPI_cs >= 0) {
+    digitalWrite(gpsSPI_cs, LOW);
+  }
+  char c = gpsSPI->transfer(0xFF);
+  if (gpsSPI_cs >= 0) {
+    digitalWrite(gpsSPI_cs, HIGH);
+  }
+  gpsSPI->endTransaction();
+  return c;
+}
+
+/**************************************************************************/
+/*!
+    @brief Add a character to the line being received, and swap the line
+    buffers when it completes a sentence.
+    @param c The character received
+    @param tStart millis() when the character was received
+    @return True if c completed a sentence
+*/
+/**************************************************************************/
+bool Adafruit_GPS::addChar(char c, uint32_t tStart) {
+  uint8_t idx = lineidx; // where c goes
   currentline[lineidx++] = c;
   if (lineidx >= MAXLINELENGTH)
     lineidx = MAXLINELENGTH -
               1; // ensure there is someplace to put the next received character
 
+  // Keep the checksum up to date a character at a time, the same way check()
+  // computes it, so parsing a sentence doesn't start with two passes over it
+  uint8_t *fields = rxField[currentline == line2];
+  if (idx == 0) {
+    rxSum = rxStar = 0;
+    rxKnown = true;
+    rxFieldCount = 0;
+    rxFieldsOpen = true;
+  } else {
+    if (c == '*') {
+      rxStar = idx;
+      rxStarSum = rxSum;
+    }
+    rxSum ^= c;
+    // note where each field starts, and the * that ends the last one
+    if (rxFieldsOpen && (c == ',' || c == '*')) {
+      if (rxFieldCount < NMEA_MAX_FIELDS) {
+        fields[rxFieldCount++] = c == ',' ? idx + 1 : idx;
+        rxFieldsOpen = c == ',';
+      } else {
+        rxFieldCount = 0; // too many, parse() will look for them
+        rxFieldsOpen = false;
+      }
+    }
+  }
+  // a 0 ends the string early and a long line overwrites its last character,
+  // so leave those to check()
+  if (c == 0 || idx == MAXLINELENGTH - 1)
+    rxKnown = false;
+
   if (c == '\n') {
     currentline[lineidx] = 0;
+    rxFields[currentline == line2] =
+        rxKnown && !rxFieldsOpen ? rxFieldCount : 0;
+
+    if (!rxKnown)
+      lastCheck = -1;
+    else if (currentline[0] != '$' && currentline[0] != '!')
+      lastCheck = NMEA_BAD;
+    else if (rxStar &&
+             rxStarSum == parseHex(currentline[rxStar + 1]) * 16 +
+                              parseHex(currentline[rxStar + 2]))
+      lastCheck = NMEA_HAS_DOLLAR + NMEA_HAS_CHECKSUM;
+    else
+      lastCheck = NMEA_HAS_DOLLAR;
 
     if (currentline == line1) {
       currentline = line2;
@@ -369,12 +515,12 @@ char Adafruit_GPS::read(void) {
     recvdTime = millis(); // time we got the end of the string
     sentTime = firstChar;
     firstChar = 0; // there are no characters yet
-    return c;      // wait until next character to set time
+    return true;   // wait until next character to set time
   }
 
   if (firstChar == 0)
     firstChar = tStart;
-  return c;
+  return false;
 }
 
 /**************************************************************************/
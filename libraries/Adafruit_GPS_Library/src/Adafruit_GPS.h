@@ -50,6 +50,8 @@
 #define GPS_MAX_SPI_TRANSFER                                                   \
   100                     ///< The max number of bytes we'll try to read at once
 #define MAXLINELENGTH 120 ///< how long are max NMEA lines to parse?
+#define NMEA_MAX_FIELDS                                                        \
+  20 ///< field starts read() notes in each line for parse(), enough for GSV
 #define NMEA_MAX_SENTENCE_ID                                                   \
   20 ///< maximum length of a sentence ID name, including terminating 0
 #define NMEA_MAX_SOURCE_ID                                                     \
@@ -99,6 +101,7 @@ public:
   size_t available(void);
   size_t write(uint8_t);
   char read(void);
+  uint16_t readAll(bool parseEach = true, uint16_t maxChars = 1000);
   void sendCommand(const char *);
   bool newNMEAreceived();
   void pause(bool b);
@@ -141,6 +144,12 @@ public:
                               unsigned historyInterval = 20,
                               unsigned historyN = 192);
   void removeHistory(nmea_index_t idx);
+  nmea_tier_t *addHistoryTier(nmea_index_t idx, unsigned bucketInterval,
+                              unsigned bucketN);
+  nmea_float_t getHistory(nmea_index_t idx, unsigned age = 0);
+  bool getHistoryBucket(nmea_index_t idx, uint8_t tier, unsigned age,
+                        nmea_float_t *mean, nmea_float_t *min = NULL,
+                        nmea_float_t *max = NULL);
   void showDataValue(nmea_index_t idx, int n = 7);
   bool isCompoundAngle(nmea_index_t idx);
 #endif
@@ -243,33 +252,47 @@ private:
   void data_init();
   // NMEA_parse.cpp
   const char *tokenOnList(char *token, const char **list);
+  int8_t checkSum(char *nmea);
   bool parseCoord(char *p, nmea_float_t *angleDegrees = NULL,
                   nmea_float_t *angle = NULL, int32_t *angle_fixed = NULL,
                   char *dir = NULL);
   char *parseStr(char *buff, char *p, int n);
+  int32_t parseDecimal(char *p, uint8_t *places);
+  nmea_float_t parseFloat(char *p);
+  int32_t parseInt(char *p);
   bool parseTime(char *);
   bool parseFix(char *);
   bool parseAntenna(char *);
   bool isEmpty(char *pStart);
-
-  // used by check() for validity tests, room for future expansion
-  const char *sources[7] = {"II", "WI", "GP", "PG",
-                            "GN", "P",  "ZZZ"}; ///< valid source ids
+  char *nextField(char *p);
+  bool parseGGA(char *p);
+  bool parseGLL(char *p);
+  bool parseGSA(char *p);
+  bool parseRMC(char *p);
+  bool parseTOP(char *p);
 #ifdef NMEA_EXTENSIONS
-  const char *sentences_parsed[21] = {"GGA", "GLL", "GSA", "RMC", "DBT", "HDM",
-                                      "HDT", "MDA", "MTW", "MWV", "RMB", "TOP",
-                                      "TXT", "VHW", "VLW", "VPW", "VWR", "WCV",
-                                      "XTE", "ZZZ"}; ///< parseable sentence ids
-  const char *sentences_known[15] = {
-      "APB", "DPT", "GSV", "HDG", "MWD", "ROT",
-      "RPM", "RSA", "VDR", "VTG", "ZDA", "ZZZ"}; ///< known, but not parseable
-#else // make the lists short to save memory
-  const char *sentences_parsed[6] = {"GGA", "GLL", "GSA", "RMC",
-                                     "TOP", "ZZZ"}; ///< parseable sentence ids
-  const char *sentences_known[4] = {"DBT", "HDM", "HDT",
-                                    "ZZZ"}; ///< known, but not parseable
+  bool parseDBT(char *p);
+  bool parseHDM(char *p);
+  bool parseHDT(char *p);
+  bool parseMDA(char *p);
+  bool parseMTW(char *p);
+  bool parseMWV(char *p);
+  bool parseRMB(char *p);
+  bool parseTXT(char *p);
+  bool parseVHW(char *p);
+  bool parseVLW(char *p);
+  bool parseVPW(char *p);
+  bool parseVWR(char *p);
+  bool parseWCV(char *p);
+  bool parseXTE(char *p);
 #endif
 
+  /// function that parses the fields of one type of sentence
+  typedef bool (Adafruit_GPS::*nmea_parser_t)(char *p);
+  static const nmea_parser_t
+      sentenceParsers[]; ///< parser for each sentence id check() knows, or NULL
+  uint8_t thisIndex = 0; ///< index check() found for the current sentence id
+
   // Make all of these times far in the past by setting them near the middle of
   // the millis() range. Timing assumes that sentences are parsed promptly.
   uint32_t lastUpdate =
@@ -284,6 +307,12 @@ private:
   bool paused;
 
   uint8_t parseResponse(char *response);
+  int nextChar(void);
+  bool readI2C(void);
+  char readSPI(void);
+  bool addChar(char c, uint32_t tStart);
+  uint32_t firstChar = 0; ///< millis() when the current line's first character
+                          ///< was received, or 0 if there are none yet
 #ifdef USE_SW_SERIAL
   SoftwareSerial *gpsSwSerial;
 #endif
@@ -310,6 +339,27 @@ private:
   volatile char *lastline;      ///< Pointer to previous line buffer
   volatile bool recvdflag;      ///< Received flag
   volatile bool inStandbyMode;  ///< In standby flag
+
+  // read() checks each sentence as it arrives so check() needn't rescan it
+  uint16_t rxSum = 0;     ///< XOR of the current line after the first char
+  uint16_t rxStarSum = 0; ///< rxSum up to the last * in the current line
+  uint8_t rxStar = 0;     ///< index of the last * in the current line, or 0
+  bool rxKnown = false;   ///< rxSum and rxStar match the current line
+
+  // read() notes where each field starts so parse() needn't look for commas
+  uint8_t rxField[2][NMEA_MAX_FIELDS]; ///< start of each field after the
+                                       ///< first in line1 and line2, then the
+                                       ///< first *
+  uint8_t rxFields[2] = {0, 0}; ///< entries in rxField for line1 and line2,
+                                ///< 0 if they aren't known
+  uint8_t rxFieldCount = 0;     ///< entries so far for the current line
+  bool rxFieldsOpen = false;    ///< the current line has had no * yet
+  char *parseLine = NULL;       ///< line parse() is using rxField for
+  const uint8_t *parseField;    ///< rxField entry for the field after p
+  const uint8_t *parseFieldEnd; ///< end of the rxField entries
+  uint8_t parseFrom = 0;        ///< offset of the field nextField() expects
+  volatile int8_t lastCheck =
+      -1; ///< thisCheck result for lastline from read(), -1 if unknown
 };
 /**************************************************************************/
 
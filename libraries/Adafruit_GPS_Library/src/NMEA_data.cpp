@@ -74,21 +74,37 @@ void Adafruit_GPS::newDataValue(nmea_index_t idx, nmea_float_t v) {
     val[idx].smoothed = val[idx].latest;
 
   val[idx].lastUpdate = millis(); // take a time stamp
-  if (val[idx].hist) {            // there's a history struct for this tag
-    unsigned long seconds = (millis() - val[idx].hist->lastHistory) / 1000;
+  nmea_history_t *h = val[idx].hist;
+  if (h) { // there's a history struct for this tag
+    unsigned long seconds = (millis() - h->lastHistory) / 1000;
     // do an update if the time has come, or if this is the first time through
-    if (seconds >= val[idx].hist->historyInterval ||
-        val[idx].hist->lastHistory == 0) {
-
-      // move the old history back in time by one step
-      for (unsigned i = 0; i < (val[idx].hist->n - 1); i++)
-        val[idx].hist->data[i] = val[idx].hist->data[i + 1];
-
+    if (seconds >= h->historyInterval || h->lastHistory == 0) {
       // Create the new entry, scaling and offsetting the value to fit into an
-      // integer, and based on the smoothed value.
-      val[idx].hist->data[val[idx].hist->n - 1] =
-          val[idx].hist->scale * (val[idx].smoothed - val[idx].hist->offset);
-      val[idx].hist->lastHistory = millis();
+      // integer, and based on the smoothed value. It replaces the oldest
+      // entry, so nothing has to move.
+      int16_t v16 = h->scale * (val[idx].smoothed - h->offset);
+      h->data[h->head] = v16;
+      if (++h->head >= h->n)
+        h->head = 0;
+      h->lastHistory = millis();
+
+      // add it to the next bucket in each coarser tier
+      for (nmea_tier_t *t = h->tiers; t; t = t->next) {
+        if (t->count == 0 || v16 < t->min)
+          t->min = v16;
+        if (t->count == 0 || v16 > t->max)
+          t->max = v16;
+        t->sum += v16;
+        if (++t->count >= t->perBucket) { // bucket is full, so store it
+          t->data[t->head].min = t->min;
+          t->data[t->head].max = t->max;
+          t->data[t->head].mean = t->sum / t->count;
+          if (++t->head >= t->n)
+            t->head = 0;
+          t->count = 0;
+          t->sum = 0;
+        }
+      }
     }
   }
 #endif // NMEA_EXTENSIONS
@@ -393,16 +409,21 @@ nmea_history_t *Adafruit_GPS::initHistory(nmea_index_t idx, nmea_float_t scale,
         // initialize the data array
         for (unsigned i = 0; i < historyN; i++)
           val[idx].hist->data[i] = 0;
-      } else
+      } else {
         free(val[idx].hist);
+        val[idx].hist = NULL;
+      }
     }
     if (val[idx].hist != NULL) {
+      // malloc() doesn't apply the defaults in the struct
       val[idx].hist->n = historyN;
-      if (scale > 0.0f)
-        val[idx].hist->scale = scale;
+      val[idx].hist->head = 0;
+      val[idx].hist->lastHistory = 0;
+      val[idx].hist->scale = scale > 0.0f ? scale : 1.0f;
       val[idx].hist->offset = offset;
-      if (historyInterval > 0)
-        val[idx].hist->historyInterval = historyInterval;
+      val[idx].hist->historyInterval =
+          historyInterval > 0 ? historyInterval : 20;
+      val[idx].hist->tiers = NULL;
     }
     return val[idx].hist;
   }
@@ -420,12 +441,121 @@ void Adafruit_GPS::removeHistory(nmea_index_t idx) {
   if (idx < NMEA_MAX_INDEX) {
     if (val[idx].hist == NULL)
       return;
+    while (val[idx].hist->tiers) {
+      nmea_tier_t *t = val[idx].hist->tiers;
+      val[idx].hist->tiers = t->next;
+      free(t->data);
+      free(t);
+    }
     free(val[idx].hist->data);
     free(val[idx].hist);
     val[idx].hist = NULL;
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief Add a coarser tier of history to a data value that already has
+    history. Each bucket in the tier keeps the min, max and mean of the
+    history values recorded over bucketInterval seconds, so a few tiers can
+    cover hours of data in a fixed amount of memory. Tiers are kept in the
+    order they are added, tier 0 first. Mean values of angles that cross
+    the 0/360 or -180/180 transitions are not meaningful, so give the sin and
+    cos values history and tiers instead.
+    @param idx The data index for the value with history
+    @param bucketInterval Approximate time in seconds covered by each bucket,
+    rounded down to a multiple of the history interval.
+    @param bucketN Number of buckets in the tier.
+    @return pointer to the tier, or NULL if there is no history or no memory
+*/
+/**************************************************************************/
+nmea_tier_t *Adafruit_GPS::addHistoryTier(nmea_index_t idx,
+                                          unsigned bucketInterval,
+                                          unsigned bucketN) {
+  if (idx >= NMEA_MAX_INDEX || val[idx].hist == NULL || bucketN == 0)
+    return NULL;
+  nmea_tier_t *t = (nmea_tier_t *)malloc(sizeof(nmea_tier_t));
+  if (t == NULL)
+    return NULL;
+  t->data = (nmea_bucket_t *)malloc(sizeof(nmea_bucket_t) * bucketN);
+  if (t->data == NULL) {
+    free(t);
+    return NULL;
+  }
+  for (unsigned i = 0; i < bucketN; i++)
+    t->data[i].min = t->data[i].max = t->data[i].mean = 0;
+  t->n = bucketN;
+  t->head = 0;
+  t->perBucket =
+      max((unsigned)1, bucketInterval / val[idx].hist->historyInterval);
+  t->count = 0;
+  t->sum = 0;
+  t->min = t->max = 0;
+  t->next = NULL;
+  // add it to the end of the list
+  nmea_tier_t **last = &val[idx].hist->tiers;
+  while (*last)
+    last = &(*last)->next;
+  *last = t;
+  return t;
+}
+
+/**************************************************************************/
+/*!
+    @brief Retrieve a value from the history of a data value.
+    @param idx The data index for the value with history
+    @param age How many history intervals back to go, 0 for the most recent
+    @return the history value converted back to a float, or 0.0 if there is
+    no history that old
+*/
+/**************************************************************************/
+nmea_float_t Adafruit_GPS::getHistory(nmea_index_t idx, unsigned age) {
+  if (idx >= NMEA_MAX_INDEX || val[idx].hist == NULL)
+    return 0.0;
+  nmea_history_t *h = val[idx].hist;
+  if (age >= h->n)
+    return 0.0;
+  unsigned i = h->head + h->n - 1 - age; // newest is just before the oldest
+  if (i >= h->n)
+    i -= h->n;
+  return (nmea_float_t)h->data[i] / h->scale + h->offset;
+}
+
+/**************************************************************************/
+/*!
+    @brief Retrieve a bucket from a coarser tier of a data value's history.
+    @param idx The data index for the value with history
+    @param tier Which tier, 0 for the first one added with addHistoryTier()
+    @param age How many buckets back to go, 0 for the most recently completed
+    @param mean Pointer to set to the mean of the bucket
+    @param min Pointer to set to the smallest value in the bucket, if not NULL
+    @param max Pointer to set to the largest value in the bucket, if not NULL
+    @return true if the bucket exists, false otherwise
+*/
+/**************************************************************************/
+bool Adafruit_GPS::getHistoryBucket(nmea_index_t idx, uint8_t tier,
+                                    unsigned age, nmea_float_t *mean,
+                                    nmea_float_t *min, nmea_float_t *max) {
+  if (idx >= NMEA_MAX_INDEX || val[idx].hist == NULL)
+    return false;
+  nmea_history_t *h = val[idx].hist;
+  nmea_tier_t *t = h->tiers;
+  while (t && tier--)
+    t = t->next;
+  if (t == NULL || age >= t->n)
+    return false;
+  unsigned i = t->head + t->n - 1 - age;
+  if (i >= t->n)
+    i -= t->n;
+  if (mean)
+    *mean = (nmea_float_t)t->data[i].mean / h->scale + h->offset;
+  if (min)
+    *min = (nmea_float_t)t->data[i].min / h->scale + h->offset;
+  if (max)
+    *max = (nmea_float_t)t->data[i].max / h->scale + h->offset;
+  return true;
+}
+
 /**************************************************************************/
 /*!
     @brief Print out the current state of a data value. Primarily useful as
@@ -455,15 +585,32 @@ void Adafruit_GPS::showDataValue(nmea_index_t idx, int n) {
   Serial.print(",  ockam:");
   Serial.print(val[idx].ockam);
   if (val[idx].hist) {
+    nmea_history_t *h = val[idx].hist;
     Serial.print("\n     History at ");
-    Serial.print(val[idx].hist->historyInterval);
+    Serial.print(h->historyInterval);
     Serial.print(" second intervals:  ");
-    Serial.print(val[idx].hist->data[val[idx].hist->n - 1]);
-    for (unsigned i = val[idx].hist->n - 2;
-         i >= max(val[idx].hist->n - n, (unsigned)0);
-         i--) { // most recent first
-      Serial.print(", ");
-      Serial.print(val[idx].hist->data[i]);
+    unsigned i = h->head; // most recent first
+    for (unsigned k = 0; k < (unsigned)n && k < h->n; k++) {
+      i = i ? i - 1 : h->n - 1;
+      if (k)
+        Serial.print(", ");
+      Serial.print(h->data[i]);
+    }
+    for (nmea_tier_t *t = h->tiers; t; t = t->next) {
+      Serial.print("\n     Min/mean/max of ");
+      Serial.print(t->perBucket);
+      Serial.print(" values:  ");
+      i = t->head;
+      for (unsigned k = 0; k < (unsigned)n && k < t->n; k++) {
+        i = i ? i - 1 : t->n - 1;
+        if (k)
+          Serial.print(", ");
+        Serial.print(t->data[i].min);
+        Serial.print("/");
+        Serial.print(t->data[i].mean);
+        Serial.print("/");
+        Serial.print(t->data[i].max);
+      }
     }
   }
   Serial.print("\n");
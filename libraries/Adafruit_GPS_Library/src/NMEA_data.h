@@ -13,6 +13,9 @@
   20 ///< maximum length of a sentence ID name, including terminating 0
 #define NMEA_MAX_SOURCE_ID                                                     \
   3 ///< maximum length of a source ID name, including terminating 0
+#define NMEA_KEY(a, b, c)                                                      \
+  ((uint32_t)(a) << 16 | (uint32_t)(b) << 8 |                                  \
+   (c)) ///< three characters of a sentence ID packed into an integer
 
 /*************************************************************************
   doubles and floats are identical on AVR processors like the UNO where space
@@ -34,6 +37,36 @@
 typedef NMEA_FLOAT_T
     nmea_float_t; ///< the type of variables to use for floating point
 
+/**************************************************************************/
+/*!
+  Struct to summarize a stretch of history values in a coarser tier of
+  history, in the same scaled integers as the history itself.
+ **************************************************************************/
+typedef struct {
+  int16_t min;  ///< smallest history value in the bucket
+  int16_t max;  ///< largest history value in the bucket
+  int16_t mean; ///< average of the history values in the bucket
+} nmea_bucket_t;
+
+/**************************************************************************/
+/*!
+  Struct for a coarser tier of history added to a data value's history. Each
+  bucket combines perBucket consecutive history values, so a tier of 60
+  buckets of 5 minutes over a 1 second history covers 5 hours. The buckets
+  are a circular buffer like the history itself, so adding one moves nothing.
+ **************************************************************************/
+typedef struct nmea_tier_s {
+  nmea_bucket_t *data = NULL;      ///< circular array of buckets
+  unsigned n = 0;                  ///< number of buckets
+  unsigned head = 0;               ///< index of the oldest bucket
+  uint16_t perBucket = 1;          ///< history values combined per bucket
+  uint16_t count = 0;              ///< history values in the next bucket
+  int32_t sum = 0;                 ///< sum of the values in the next bucket
+  int16_t min = 0;                 ///< smallest value in the next bucket
+  int16_t max = 0;                 ///< largest value in the next bucket
+  struct nmea_tier_s *next = NULL; ///< next coarser tier, if any
+} nmea_tier_t;
+
 /**************************************************************************/
 /*!
   Struct to contain all the details associated with the history of an NMEA
@@ -46,15 +79,20 @@ typedef NMEA_FLOAT_T
   Only some tags have history in order to save memory. Most of the memory
   cost is directly in the array.
 
+  The array is a circular buffer with the oldest value at data[head], which
+  the next value overwrites. Use getHistory() to read values by age.
+
   192 history values taken every 20 seconds covers just over an hour.
  **************************************************************************/
 typedef struct {
-  int16_t *data = NULL;          ///< array of ints, oldest first
+  int16_t *data = NULL;          ///< circular array of ints
   unsigned n = 0;                ///< number of history array elements
+  unsigned head = 0;             ///< index of the oldest element
   uint32_t lastHistory = 0;      ///< millis() when history was last updated
   uint16_t historyInterval = 20; ///< seconds between history updates
   nmea_float_t scale = 1.0;      ///< history = (smoothed - offset) * scale
   nmea_float_t offset = 0.0;     ///< value = (float) history / scale + offset
+  nmea_tier_t *tiers = NULL;     ///< coarser tiers of history, if any
 } nmea_history_t;
 
 /**************************************************************************/
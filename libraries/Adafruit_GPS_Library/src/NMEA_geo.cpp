@@ -0,0 +1,264 @@
+/**************************************************************************/
+/*!
+  @file NMEA_geo.cpp
+
+  Code for distance, bearing and geofence checks on fixed point latitude
+  and longitude. Distance and bearing use the equirectangular approximation:
+  the longitude difference is scaled by the cosine of the mean latitude and
+  the result treated as flat, on a sphere of the mean Earth radius like the
+  usual haversine formula. Over the distances a sketch usually cares about
+  that is as good as haversine, and it needs no floating point, just a table
+  lookup, a few multiplies and an integer square root.
+
+  Fences are polygons in PROGMEM with a grid over them made on a computer by
+  fencegrid/fencegrid.py. Each cell of the grid lists the polygons that reach
+  into it and flags those that cover it completely, so most checks find the
+  answer from the cell alone and the rest test only one or two polygons.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+
+#include <NMEA_geo.h>
+
+// metres per 1/10000000 degree on a sphere of radius 6371008.8 m, times 2^20
+#define METRES_PER_UNIT_Q20 11660
+
+// cos of each whole degree from 0 to 90, times 32768
+static const uint16_t cosTable[91] PROGMEM = {
+    32768, 32763, 32748, 32723, 32688, 32643, 32588, 32524, 32449, 32365,
+    32270, 32166, 32052, 31928, 31795, 31651, 31499, 31336, 31164, 30983,
+    30792, 30592, 30382, 30163, 29935, 29698, 29452, 29197, 28932, 28660,
+    28378, 28088, 27789, 27482, 27166, 26842, 26510, 26170, 25822, 25466,
+    25102, 24730, 24351, 23965, 23571, 23170, 22763, 22348, 21926, 21498,
+    21063, 20622, 20174, 19720, 19261, 18795, 18324, 17847, 17364, 16877,
+    16384, 15886, 15384, 14876, 14365, 13848, 13328, 12803, 12275, 11743,
+    11207, 10668, 10126, 9580,  9032,  8481,  7927,  7371,  6813,  6252,
+    5690,  5126,  4560,  3993,  3425,  2856,  2286,  1715,  1144,  572,
+    0};
+
+// atan(i / 32) in hundredths of a degree for i from 0 to 32
+static const uint16_t atanTable[33] PROGMEM = {
+    0,    179,  358,  536,  713,  888,  1062, 1234, 1404, 1571, 1735,
+    1897, 2056, 2211, 2363, 2511, 2657, 2798, 2936, 3070, 3201, 3327,
+    3451, 3571, 3687, 3800, 3909, 4016, 4119, 4218, 4315, 4409, 4500};
+
+// cos of a latitude in 1/10000000 degree, times 32768
+static uint16_t cosFixed(int32_t lat) {
+  uint32_t a = lat < 0 ? -(uint32_t)lat : lat;
+  uint8_t deg = a / 10000000UL;
+  if (deg >= 90)
+    return 0;
+  // fraction of the degree in 1/65536ths, near enough
+  uint16_t frac = (a - deg * 10000000UL) / 153;
+  uint16_t c0 = pgm_read_word(&cosTable[deg]);
+  uint16_t c1 = pgm_read_word(&cosTable[deg + 1]);
+  return c0 - ((uint32_t)(c0 - c1) * frac >> 16);
+}
+
+// atan of z / 32768 for z from 0 to 32768, in hundredths of a degree
+static uint16_t atanFixed(uint32_t z) {
+  uint8_t i = z >> 10;
+  if (i >= 32)
+    return 4500;
+  uint16_t a0 = pgm_read_word(&atanTable[i]);
+  uint16_t a1 = pgm_read_word(&atanTable[i + 1]);
+  return a0 + ((uint32_t)(a1 - a0) * (z & 1023) >> 10);
+}
+
+// square root rounded down
+static uint16_t isqrt(uint32_t n) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > n)
+    bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else
+      root >>= 1;
+    bit >>= 2;
+  }
+  return root;
+}
+
+// east and north distances from point 1 to point 2 in 1/10000000 degree of
+// latitude, as sizes and directions, scaled down together to below 2^15 so
+// they can be squared, returning how many times they were halved
+static uint8_t flatOffset(int32_t lat1, int32_t lon1, int32_t lat2,
+                          int32_t lon2, uint32_t *east, uint32_t *north,
+                          bool *goingEast, bool *goingNorth) {
+  *goingNorth = lat2 >= lat1;
+  *north = *goingNorth ? (uint32_t)lat2 - lat1 : (uint32_t)lat1 - lat2;
+  *goingEast = lon2 >= lon1;
+  uint32_t absLon = *goingEast ? (uint32_t)lon2 - lon1 : (uint32_t)lon1 - lon2;
+  // the long way round is up to 3600000000, so take the short way across
+  // the 180 degree meridian instead
+  if (absLon > 3600000000UL)
+    absLon -= 3600000000UL;
+  else if (absLon > 1800000000UL) {
+    absLon = 3600000000UL - absLon;
+    *goingEast = !*goingEast;
+  }
+  // absLon * cos >> 15 in two parts, so each product fits in 32 bits
+  uint16_t c = cosFixed(lat1 / 2 + lat2 / 2);
+  *east = (absLon >> 15) * c + ((absLon & 0x7FFF) * c >> 15);
+  uint8_t shift = 0;
+  while ((*east | *north) >= 0x8000) {
+    *east >>= 1;
+    *north >>= 1;
+    shift++;
+  }
+  return shift;
+}
+
+/**************************************************************************/
+/*!
+    @brief Distance between two points, e.g. GPS.latitude_fixed and
+    GPS.longitude_fixed and a waypoint. Within 1 m or 0.06% of the haversine
+    distance up to 100 km apart, and 0.25% up to 500 km, below 70 degrees
+    latitude. Past that, or nearer the poles, the error grows quickly.
+    @param lat1 Latitude of the first point in 1/10000000 degree
+    @param lon1 Longitude of the first point in 1/10000000 degree
+    @param lat2 Latitude of the second point in 1/10000000 degree
+    @param lon2 Longitude of the second point in 1/10000000 degree
+    @return The distance in metres
+*/
+/**************************************************************************/
+uint32_t geoDistance(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2) {
+  uint32_t east, north;
+  bool goingEast, goingNorth;
+  uint8_t shift = flatOffset(lat1, lon1, lat2, lon2, &east, &north,
+                             &goingEast, &goingNorth);
+  uint32_t units = (uint32_t)isqrt(east * east + north * north) << shift;
+  // (units * METRES_PER_UNIT_Q20 + 2^19) >> 20 with units split at 2^16
+  uint32_t low = (units & 0xFFFF) * METRES_PER_UNIT_Q20 + (1UL << 19);
+  return ((units >> 16) * METRES_PER_UNIT_Q20 + (low >> 16)) >> 4;
+}
+
+/**************************************************************************/
+/*!
+    @brief Bearing from one point to another. This is close to the great
+    circle's bearing half way along rather than at the start, which differ by
+    less than 0.15 degree up to 10 km apart and 1.3 degrees up to 100 km,
+    below 70 degrees latitude.
+    @param lat1 Latitude of the point to start from in 1/10000000 degree
+    @param lon1 Longitude of the point to start from in 1/10000000 degree
+    @param lat2 Latitude of the point to go to in 1/10000000 degree
+    @param lon2 Longitude of the point to go to in 1/10000000 degree
+    @return The bearing in hundredths of a degree clockwise from true north,
+    0 to 35999, or 0 if the points are the same
+*/
+/**************************************************************************/
+uint16_t geoBearing(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2) {
+  uint32_t east, north;
+  bool goingEast, goingNorth;
+  flatOffset(lat1, lon1, lat2, lon2, &east, &north, &goingEast, &goingNorth);
+  if (east == 0 && north == 0)
+    return 0;
+  uint16_t a; // from north or south towards east or west, 0 to 9000
+  if (east <= north)
+    a = atanFixed((east << 15) / north);
+  else
+    a = 9000 - atanFixed((north << 15) / east);
+  if (goingNorth)
+    return goingEast || a == 0 ? a : 36000 - a;
+  return goingEast ? 18000 - a : 18000 + a;
+}
+
+// true if the edge from a to b, which crosses the latitude of the point,
+// crosses it east of the point. Edges that pass on both sides of the point
+// are halved, keeping the half that crosses, until they are short enough
+// for the side test's products to fit in 32 bits.
+static bool crossesEast(nmea_geo_point_t a, nmea_geo_point_t b, int32_t lat,
+                        int32_t lon) {
+  while (true) {
+    if (a.lon > lon && b.lon > lon)
+      return true;
+    if (a.lon <= lon && b.lon <= lon)
+      return false;
+    uint32_t dLat = a.lat < b.lat ? (uint32_t)b.lat - a.lat
+                                  : (uint32_t)a.lat - b.lat;
+    uint32_t dLon = a.lon < b.lon ? (uint32_t)b.lon - a.lon
+                                  : (uint32_t)a.lon - b.lon;
+    if ((dLat | dLon) < 0x8000) {
+      // the point is between the ends, so these all fit in an int16_t
+      int16_t edgeLat = b.lat - a.lat, edgeLon = b.lon - a.lon;
+      int16_t toLat = lat - a.lat, toLon = lon - a.lon;
+      int32_t cross = (int32_t)edgeLon * toLat - (int32_t)toLon * edgeLat;
+      return (cross > 0) == (b.lat > a.lat);
+    }
+    nmea_geo_point_t m; // the middle, without overflowing
+    m.lat = (a.lat >> 1) + (b.lat >> 1) + (a.lat & b.lat & 1);
+    m.lon = (a.lon >> 1) + (b.lon >> 1) + (a.lon & b.lon & 1);
+    if ((m.lat > lat) == (a.lat > lat))
+      a = m;
+    else
+      b = m;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Check if a point is inside a polygon, by counting how many of its
+    edges a line due east from the point crosses.
+    @param points Pointer to the vertices in PROGMEM, in order around the
+    edge in either direction and not repeating the first at the end
+    @param n Number of vertices
+    @param lat Latitude of the point in 1/10000000 degree
+    @param lon Longitude of the point in 1/10000000 degree
+    @return True if the point is inside. Points on an edge, or within a
+    unit or two of one, can go either way.
+*/
+/**************************************************************************/
+bool geoInPolygon(const nmea_geo_point_t *points, uint16_t n, int32_t lat,
+                  int32_t lon) {
+  if (n < 3)
+    return false;
+  bool inside = false;
+  nmea_geo_point_t a, b;
+  memcpy_P(&a, &points[n - 1], sizeof(a));
+  for (uint16_t i = 0; i < n; i++) {
+    memcpy_P(&b, &points[i], sizeof(b));
+    if ((a.lat > lat) != (b.lat > lat) && crossesEast(a, b, lat, lon))
+      inside = !inside;
+    a = b;
+  }
+  return inside;
+}
+
+/**************************************************************************/
+/*!
+    @brief Find which polygon of a fence a point is in.
+    @param fence Pointer to the fence, as made by fencegrid.py
+    @param lat Latitude of the point in 1/10000000 degree
+    @param lon Longitude of the point in 1/10000000 degree
+    @return The index of the first polygon the point is in, or -1 if none
+*/
+/**************************************************************************/
+int16_t geoInFence(const nmea_geo_fence_t *fence, int32_t lat, int32_t lon) {
+  if (lat < fence->lat0 || lon < fence->lon0)
+    return -1;
+  uint32_t row = ((uint32_t)lat - fence->lat0) / fence->cellLat;
+  uint32_t col = ((uint32_t)lon - fence->lon0) / fence->cellLon;
+  if (row >= fence->rows || col >= fence->cols)
+    return -1;
+  uint16_t cell = row * fence->cols + col;
+  uint16_t end = pgm_read_word(&fence->cellStart[cell + 1]);
+  for (uint16_t i = pgm_read_word(&fence->cellStart[cell]); i < end; i++) {
+    uint8_t entry = pgm_read_byte(&fence->cellList[i]);
+    uint8_t p = entry & ~NMEA_GEO_INSIDE;
+    if (entry & NMEA_GEO_INSIDE)
+      return p;
+    nmea_geo_polygon_t poly;
+    memcpy_P(&poly, &fence->polygons[p], sizeof(poly));
+    if (lat < poly.minLat || lat > poly.maxLat || lon < poly.minLon ||
+        lon > poly.maxLon)
+      continue;
+    if (geoInPolygon(&fence->points[poly.first], poly.n, lat, lon))
+      return p;
+  }
+  return -1;
+}
@@ -0,0 +1,70 @@
+/**************************************************************************/
+/*!
+  @file NMEA_geo.h
+
+  Distance, bearing and geofence checks that work directly on the
+  latitude_fixed and longitude_fixed values, in 1/10000000 of a degree,
+  using only integer maths so they are quick on boards without an FPU.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+#ifndef _NMEA_GEO_H
+#define _NMEA_GEO_H
+
+#include <Adafruit_GPS.h>
+
+/**************************************************************************/
+/*!
+  Struct for one vertex of a fence polygon, kept in PROGMEM.
+ **************************************************************************/
+typedef struct {
+  int32_t lat; ///< latitude in 1/10000000 degree
+  int32_t lon; ///< longitude in 1/10000000 degree
+} nmea_geo_point_t;
+
+/**************************************************************************/
+/*!
+  Struct for one fence polygon, kept in PROGMEM, with its bounding box and
+  where its vertices are in the fence's list of points.
+ **************************************************************************/
+typedef struct {
+  int32_t minLat; ///< southern edge of the bounding box
+  int32_t minLon; ///< western edge of the bounding box
+  int32_t maxLat; ///< northern edge of the bounding box
+  int32_t maxLon; ///< eastern edge of the bounding box
+  uint16_t first; ///< index of the first vertex in the points
+  uint16_t n;     ///< number of vertices
+} nmea_geo_polygon_t;
+
+/**************************************************************************/
+/*!
+  Struct for a set of fence polygons and a grid over them, so that a check
+  only has to look at the polygons that reach into the cell the position is
+  in. Each cell's list gives polygon indexes, with NMEA_GEO_INSIDE added if
+  the whole cell is inside that polygon. The arrays are in PROGMEM and are
+  made by fencegrid/fencegrid.py.
+ **************************************************************************/
+typedef struct {
+  int32_t lat0;                       ///< southern edge of the grid
+  int32_t lon0;                       ///< western edge of the grid
+  int32_t cellLat;                    ///< height of a cell
+  int32_t cellLon;                    ///< width of a cell
+  uint8_t rows;                       ///< cells from south to north
+  uint8_t cols;                       ///< cells from west to east
+  const uint16_t *cellStart;          ///< start of each cell's list, then end
+  const uint8_t *cellList;            ///< polygon lists for all the cells
+  const nmea_geo_polygon_t *polygons; ///< the polygons
+  const nmea_geo_point_t *points;     ///< the vertices of all the polygons
+} nmea_geo_fence_t;
+
+#define NMEA_GEO_INSIDE 0x80 ///< cell list flag for a cell wholly inside
+
+uint32_t geoDistance(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2);
+uint16_t geoBearing(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2);
+bool geoInPolygon(const nmea_geo_point_t *points, uint16_t n, int32_t lat,
+                  int32_t lon);
+int16_t geoInFence(const nmea_geo_fence_t *fence, int32_t lat, int32_t lon);
+
+#endif // _NMEA_GEO_H
@@ -22,6 +22,99 @@
 
 #include <Adafruit_GPS.h>
 
+/**************************************************************************/
+/*
+  The sentence ids that check() recognizes, each with the function that
+  parse() uses for it, P(), or known but not parsed, K(). Change a P() to a
+  K() to leave that parser out of the build. The ids are found with a perfect
+  hash of their three letters, so the order doesn't matter.
+*/
+/**************************************************************************/
+#ifdef NMEA_EXTENSIONS
+#define NMEA_SENTENCES(P, K)                                                   \
+  P(GGA) P(GLL) P(GSA) P(RMC) P(TOP) P(DBT) P(HDM) P(HDT) P(MDA) P(MTW)        \
+  P(MWV) P(RMB) P(TXT) P(VHW) P(VLW) P(VPW) P(VWR) P(WCV) P(XTE) K(APB)        \
+  K(DPT) K(GSV) K(HDG) K(MWD) K(ROT) K(RPM) K(RSA) K(VDR) K(VTG) K(ZDA)
+#else // make the list short to save memory
+#define NMEA_SENTENCES(P, K)                                                   \
+  P(GGA) P(GLL) P(GSA) P(RMC) P(TOP) K(DBT) K(HDM) K(HDT)
+#endif
+
+#define NMEA_KEY_OF(id) NMEA_KEY(#id[0], #id[1], #id[2]),
+#define NMEA_PARSER_OF(id) &Adafruit_GPS::parse##id,
+#define NMEA_NO_PARSER(id) NULL,
+
+/// multiplier that gives every sentence id its own slot
+#define NMEA_HASH_MULT 0xE4B67E53UL
+#define NMEA_HASH_SLOTS 64 ///< number of slots in the hash table
+
+static constexpr uint32_t sentenceKeys[] = {
+    NMEA_SENTENCES(NMEA_KEY_OF, NMEA_KEY_OF)};
+static constexpr uint8_t sentenceCount =
+    sizeof(sentenceKeys) / sizeof(sentenceKeys[0]);
+
+const Adafruit_GPS::nmea_parser_t Adafruit_GPS::sentenceParsers[] = {
+    NMEA_SENTENCES(NMEA_PARSER_OF, NMEA_NO_PARSER)};
+
+// slot in the hash table for a sentence key
+static constexpr uint8_t sentenceSlot(uint32_t key) {
+  return (uint32_t)(key * NMEA_HASH_MULT) >> 26;
+}
+
+// index of the sentence id in slot, or sentenceCount if the slot is empty
+static constexpr uint8_t slotIndex(uint8_t slot, uint8_t i = 0) {
+  return i >= sentenceCount                        ? sentenceCount
+         : sentenceSlot(sentenceKeys[i]) == slot ? i
+                                                 : slotIndex(slot, i + 1);
+}
+
+// true if no id after i shares a slot with id i
+static constexpr bool slotFree(uint8_t i, uint8_t j) {
+  return j >= sentenceCount ||
+         (sentenceSlot(sentenceKeys[i]) != sentenceSlot(sentenceKeys[j]) &&
+          slotFree(i, j + 1));
+}
+
+// true if every id from i on has its own slot
+static constexpr bool slotsUnique(uint8_t i = 0) {
+  return i >= sentenceCount || (slotFree(i, i + 1) && slotsUnique(i + 1));
+}
+
+static_assert(slotsUnique(),
+              "two sentence ids share a hash slot, change NMEA_HASH_MULT");
+
+#define NMEA_SLOTS_8(s)                                                        \
+  slotIndex(s), slotIndex(s + 1), slotIndex(s + 2), slotIndex(s + 3),          \
+      slotIndex(s + 4), slotIndex(s + 5), slotIndex(s + 6), slotIndex(s + 7)
+
+/// index into sentenceKeys and sentenceParsers for each hash slot
+static const uint8_t sentenceIndex[NMEA_HASH_SLOTS] = {
+    NMEA_SLOTS_8(0),  NMEA_SLOTS_8(8),  NMEA_SLOTS_8(16), NMEA_SLOTS_8(24),
+    NMEA_SLOTS_8(32), NMEA_SLOTS_8(40), NMEA_SLOTS_8(48), NMEA_SLOTS_8(56)};
+
+/// talker ids that check() accepts, any other starting with P is proprietary
+static const uint16_t talkers[] = {'I' << 8 | 'I', 'W' << 8 | 'I',
+                                   'G' << 8 | 'P', 'P' << 8 | 'G',
+                                   'G' << 8 | 'N'};
+
+// Start of the field after p, or the * or end of the string if p is in the
+// last field, so that a sentence with fields missing leaves p on the * and
+// every field after reads as empty instead of running off the end. When p is
+// the field parse() is up to in a line from read(), the start read() noted
+// for the next field is used instead of looking for the comma.
+char *Adafruit_GPS::nextField(char *p) {
+  if (p == parseLine + parseFrom && parseLine) {
+    if (parseField < parseFieldEnd)
+      parseFrom = *parseField++;
+    return parseLine + parseFrom;
+  }
+  for (; *p != ','; p++) {
+    if (*p == '*' || *p == 0)
+      return p;
+  }
+  return p + 1;
+}
+
 /**************************************************************************/
 /*!
     @brief Parse a standard NMEA string and update the relevant variables.
@@ -40,9 +133,11 @@
     parse() permits, but does not require Carriage Return and Line Feed at the
    end of sentences. The end of the sentence is recognized by the * for the
    checksum. parse() will not recognize a sentence without a valid checksum.
+   Fields missing from the end of a short sentence are treated as empty.
 
    NMEA_EXTENSIONS must be defined in order to parse more than basic
-   GPS module sentences.
+   GPS module sentences. check() looks the sentence up in a hash table of the
+   ids in NMEA_SENTENCES and parse() calls the function listed there for it.
 
     @param nmea Pointer to the NMEA string
     @return True if successfully parsed, false if fails check or parsing
@@ -52,519 +147,704 @@ bool Adafruit_GPS::parse(char *nmea) {
   if (!check(nmea))
     return false;
   // passed the check, so there's a valid source in thisSource and a valid
-  // sentence in thisSentence
+  // sentence in thisSentence, and check() found its parser
+  // use the field starts read() noted if this is its line
+  uint8_t n = nmea == (char *)lastline && lastCheck >= 0
+                  ? rxFields[lastline == line2]
+                  : 0;
+  if (n) {
+    parseLine = nmea;
+    parseField = rxField[lastline == line2];
+    parseFieldEnd = parseField + n;
+    parseFrom = 0;
+  }
   char *p = nmea; // Pointer to move through the sentence -- good parsers are
                   // non-destructive
-  p = strchr(p, ',') + 1; // Skip to char after the next comma, then check.
-
-  // This may look inefficient, but an M0 will get down the list in about 1 us /
-  // strcmp()! Put the GPS sentences from Adafruit_GPS at the top to make
-  // pruning excess code easier. Otherwise, keep them alphabetical for ease of
-  // reading.
-  if (!strcmp(thisSentence, "GGA")) { //************************************GGA
-    // Adafruit from Actisense NGW-1 from SH CP150C
-    parseTime(p);
-    p = strchr(p, ',') + 1; // parse time with specialized function
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
-      newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
-      newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p)) { // if it's a , (or a * at end of sentence) the value is
-                       // not included
-      fixquality = atoi(p); // needs additional processing
-      if (fixquality > 0) {
-        fix = true;
-        lastFix = sentTime;
-      } else
-        fix = false;
-    }
-    p = strchr(p, ',') + 1; // then move on to the next
-    // Most can just be parsed with atoi() or atof(), then move on to the next.
-    if (!isEmpty(p))
-      satellites = atoi(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDOP, HDOP = atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      altitude = atof(p);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1; // skip the units
-    if (!isEmpty(p))
-      geoidheight = atof(p); // skip the rest
-
-  } else if (!strcmp(thisSentence, "RMC")) { //*****************************RMC
-    // in Adafruit from Actisense NGW-1 from SH CP150C
-    parseTime(p);
-    p = strchr(p, ',') + 1;
-    parseFix(p);
-    p = strchr(p, ',') + 1;
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
-      newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
-      newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_SOG, speed = atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_COG, angle = atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p)) {
-      uint32_t fulldate = atof(p);
-      day = fulldate / 10000;
-      month = (fulldate % 10000) / 100;
-      year = (fulldate % 100);
-      lastDate = sentTime;
-    } // skip the rest
-
-  } else if (!strcmp(thisSentence, "GLL")) { //*****************************GLL
-    // in Adafruit from Actisense NGW-1 from SH CP150C
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
-      newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
-      newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    parseTime(p);
-    p = strchr(p, ',') + 1;
-    parseFix(p); // skip the rest
-
-  } else if (!strcmp(thisSentence, "GSA")) { //*****************************GSA
-    // in Adafruit from Actisense NGW-1
-    p = strchr(p, ',') + 1; // skip selection mode
-    if (!isEmpty(p))
-      fixquality_3d = atoi(p);
-    p = strchr(p, ',') + 1;
-    // skip 12 Satellite PDNs without interpreting them
-    for (int i = 0; i < 12; i++)
-      p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      PDOP = atof(p);
-    p = strchr(p, ',') + 1;
-    // parse out HDOP, we also parse this from the GGA sentence. Chipset should
-    // report the same for both
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDOP, HDOP = atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      VDOP = atof(p); // last before checksum
-
-  } else if (!strcmp(thisSentence, "TOP")) { //*****************************TOP
-    // See:
-    // https://learn.adafruit.com/adafruit-ultimate-gps-featherwing/antenna-options
-    // There is an output sentence that will tell you the status of the
-    // antenna. $PGTOP,11,x where x is the status number. If x is 3 that means
-    // it is using the external antenna. If x is 2 it's using the internal
-    p = strchr(p, ',') + 1;
-    parseAntenna(p);
-  }
-
-#ifdef NMEA_EXTENSIONS // Sentences not required for basic GPS functionality
-  else if (!strcmp(thisSentence, "APB")) { //*******************************APB
-    // from Actisense NGW-1 from SH CP150C
+  p = nextField(p); // Skip to char after the next comma, then check.
+  bool ok = (this->*sentenceParsers[thisIndex])(p);
+  parseLine = NULL;
+  if (!ok)
     return false;
 
-  } else if (!strcmp(thisSentence, "DBT")) { //*****************************DBT
-    // from Actisense NGW-1
-    // feet, metres, fathoms below transducer coerced to water depth from
-    // surface in metres
-    if (!isEmpty(p))
-      newDataValue(NMEA_DEPTH,
-                   (nmea_float_t)atof(p) * 0.3048f + depthToTransducer);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_DEPTH, (nmea_float_t)atof(p) + depthToTransducer);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_DEPTH,
-                   (nmea_float_t)atof(p) * 6 * 0.3048f + depthToTransducer);
-
-  } else if (!strcmp(thisSentence, "DPT")) { //*****************************DPT
-    // from Actisense NGW-1
-    return false;
+  // Record the successful parsing of where the last data came from and when
+  strcpy(lastSource, thisSource);
+  strcpy(lastSentence, thisSentence);
+  lastUpdate = millis();
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "GSV")) { //*****************************GSV
-    // from Actisense NGW-1
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a GGA sentence, Global Positioning System Fix
+    Data
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseGGA(char *p) {
+  // Adafruit from Actisense NGW-1 from SH CP150C
+  parseTime(p);
+  p = nextField(p); // parse time with specialized function
+  // parse out both latitude and direction, then go to next field, or fail
+  if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    newDataValue(NMEA_LAT, latitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  // parse out both longitude and direction, then go to next field, or fail
+  if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    newDataValue(NMEA_LON, longitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p)) { // if it's a , (or a * at end of sentence) the value is
+                     // not included
+    fixquality = parseInt(p); // needs additional processing
+    if (fixquality > 0) {
+      fix = true;
+      lastFix = sentTime;
+    } else
+      fix = false;
+  }
+  p = nextField(p); // then move on to the next
+  // Most can just be parsed with parseInt() or parseFloat(), then move on to
+  // the next.
+  if (!isEmpty(p))
+    satellites = parseInt(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDOP, HDOP = parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p))
+    altitude = parseFloat(p);
+  p = nextField(p);
+  p = nextField(p); // skip the units
+  if (!isEmpty(p))
+    geoidheight = parseFloat(p); // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "HDG")) { //*****************************HDG
-    // from Actisense NGW-1 from SH CP150C
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a RMC sentence, Recommended Minimum Specific GNSS
+    Data
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseRMC(char *p) {
+  // in Adafruit from Actisense NGW-1 from SH CP150C
+  parseTime(p);
+  p = nextField(p);
+  parseFix(p);
+  p = nextField(p);
+  // parse out both latitude and direction, then go to next field, or fail
+  if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    newDataValue(NMEA_LAT, latitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  // parse out both longitude and direction, then go to next field, or fail
+  if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    newDataValue(NMEA_LON, longitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_SOG, speed = parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_COG, angle = parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p)) {
+    uint32_t fulldate = parseInt(p);
+    day = fulldate / 10000;
+    month = (fulldate % 10000) / 100;
+    year = (fulldate % 100);
+    lastDate = sentTime;
+  } // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "HDM")) { //*****************************HDM
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDG, atof(p)); // skip the rest
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a GLL sentence, Geographic Position, Latitude and
+    Longitude
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseGLL(char *p) {
+  // in Adafruit from Actisense NGW-1 from SH CP150C
+  // parse out both latitude and direction, then go to next field, or fail
+  if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    newDataValue(NMEA_LAT, latitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  // parse out both longitude and direction, then go to next field, or fail
+  if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    newDataValue(NMEA_LON, longitudeDegrees);
+  p = nextField(p);
+  p = nextField(p);
+  parseTime(p);
+  p = nextField(p);
+  parseFix(p); // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "HDT")) { //*****************************HDT
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDT, atof(p)); // skip the rest
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a GSA sentence, GNSS DOP and Active Satellites
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseGSA(char *p) {
+  // in Adafruit from Actisense NGW-1
+  p = nextField(p); // skip selection mode
+  if (!isEmpty(p))
+    fixquality_3d = parseInt(p);
+  p = nextField(p);
+  // skip 12 Satellite PDNs without interpreting them
+  for (int i = 0; i < 12; i++)
+    p = nextField(p);
+  if (!isEmpty(p))
+    PDOP = parseFloat(p);
+  p = nextField(p);
+  // parse out HDOP, we also parse this from the GGA sentence. Chipset should
+  // report the same for both
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDOP, HDOP = parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p))
+    VDOP = parseFloat(p); // last before checksum
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "MDA")) { //*****************************MDA
-    // from Actisense NGW-1
-    if (!isEmpty(p))
-      newDataValue(NMEA_BAROMETER, atof(p) * 3386.39);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_BAROMETER, atof(p) * 100000);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    nmea_float_t T = 100000.;
-    char u = 'C';
-    if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      u = *p;
-    p = strchr(p, ',') + 1;
-    if (u != 'C') {
-      T = (T - 32) / 1.8f;
-      u = 'C';
-    } // coerce to C
-    if (T < 1000)
-      newDataValue(NMEA_TEMPERATURE_AIR, T);
-    T = 100000.;
-    u = 'C';
-    if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      u = *p;
-    p = strchr(p, ',') + 1;
-    if (u != 'C') {
-      T = (T - 32) / 1.8f;
-      u = 'C';
-    }
-    if (T < 1000)
-      newDataValue(NMEA_TEMPERATURE_WATER, T);
-    if (!isEmpty(p))
-      newDataValue(NMEA_HUMIDITY, atof(p)); // skip the rest
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a TOP sentence, PGTOP antenna status
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseTOP(char *p) {
+  // See:
+  // https://learn.adafruit.com/adafruit-ultimate-gps-featherwing/antenna-options
+  // There is an output sentence that will tell you the status of the
+  // antenna. $PGTOP,11,x where x is the status number. If x is 3 that means
+  // it is using the external antenna. If x is 2 it's using the internal
+  p = nextField(p);
+  parseAntenna(p);
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "MTW")) { //*****************************MTW
-    nmea_float_t T = 100000.;
-    char u = 'C';
-    if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      u = *p; // last before checksum
-    if (u != 'C') {
-      T = (T - 32) / 1.8f;
-      u = 'C';
-    }
-    if (T < 1000)
-      newDataValue(NMEA_TEMPERATURE_WATER, T);
+#ifdef NMEA_EXTENSIONS // Sentences not required for basic GPS functionality
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a DBT sentence, Depth Below Transducer
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseDBT(char *p) {
+  // from Actisense NGW-1
+  // feet, metres, fathoms below transducer coerced to water depth from
+  // surface in metres
+  if (!isEmpty(p))
+    newDataValue(NMEA_DEPTH, parseFloat(p) * 0.3048f + depthToTransducer);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_DEPTH, parseFloat(p) + depthToTransducer);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_DEPTH, parseFloat(p) * 6 * 0.3048f + depthToTransducer);
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "MWD")) { //*****************************MWD
-    // from Actisense NGW-1
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a HDM sentence, Heading, Magnetic
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseHDM(char *p) {
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDG, parseFloat(p)); // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "MWV")) { //*****************************MWV
-    // from Actisense NGW-1
-    nmea_float_t ang = 100000.;
-    char ref = 'T';
-    if (!isEmpty(p))
-      ang = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      ref = *p;
-    p = strchr(p, ',') + 1;
-    nmea_float_t spd = 100000.;
-    if (!isEmpty(p))
-      spd = atof(p);
-    p = strchr(p, ',') + 1;
-    char units = 'N';
-    if (!isEmpty(p))
-      units = *p;
-    p = strchr(p, ',') + 1;
-    char stat = 'A';
-    if (!isEmpty(p))
-      stat = *p; // last before checksum
-    if (units == 'K') {
-      spd /= 1.6f;
-      units = 'M';
-    }
-    if (units == 'M') {
-      spd *= 5280.0f / 6000.0f;
-      units = 'N';
-    }
-    if (ang > 180.0f)
-      ang -= 360.0f;
-    if (ref == 'R') {
-      if (ang < 1000.0f && stat == 'A')
-        newDataValue(NMEA_AWA, ang);
-      if (spd < 1000.0f && stat == 'A')
-        newDataValue(NMEA_AWS, spd);
-    } else {
-      if (ang < 1000.0f && stat == 'A')
-        newDataValue(NMEA_TWA, ang);
-      if (spd < 1000.0f && stat == 'A')
-        newDataValue(NMEA_TWS, spd);
-    }
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a HDT sentence, Heading, True
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseHDT(char *p) {
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDT, parseFloat(p)); // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "RMB")) { //*****************************RMB
-    // from Actisense NGW-1 from SH CP150C
-    // RMB Recommended Minimum Navigation Information
-    //       1 2   3 4    5    6       7 8        9 10  11 12  13 14
-    //       | |   | |    |    |       | |        | |   |   |   | |
-    //$--RMB,A,x.x,a,c--c,c--c,llll.ll,a,yyyyy.yy,a,x.x,x.x,x.x,A*hh
-    // 1) Status, V = Navigation receiver warning
-    // 2) Cross Track error - nautical miles
-    // 3) Direction to Steer, Left or Right
-    // 4) TO Waypoint ID
-    // 5) FROM Waypoint ID
-    // 6) Destination Waypoint Latitude 7) N or S
-    // 8) Destination Waypoint Longitude 9) E or W
-    // 10) Range to destination in nautical miles
-    // 11) Bearing to destination in degrees True
-    // 12) Destination closing velocity in knots
-    // 13) Arrival Status, A = Arrival Circle Entered 14) Checksum
-    p = strchr(p, ',') + 1; // skip status
-    nmea_float_t xte = 100000.;
-    char xteDir = 'X';
-    if (!isEmpty(p))
-      xte = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      xteDir = *p;
-    p = strchr(p, ',') + 1;
-    if (xte < 10000.0f && xteDir != 'X') {
-      if (xteDir == 'L')
-        xte *= -1.0f;
-      newDataValue(NMEA_XTE, xte);
-    }
-    if (!isEmpty(p))
-      parseStr(toID, p, NMEA_MAX_WP_ID);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      parseStr(fromID, p, NMEA_MAX_WP_ID);
-    p = strchr(p, ',') + 1;
-    nmea_float_t latitudeWP = 0;
-    nmea_float_t longitudeWP = 0;
-    int32_t latitude_fixedWP = 0;
-    int32_t longitude_fixedWP = 0;
-    nmea_float_t latitudeDegreesWP = 0;
-    nmea_float_t longitudeDegreesWP = 0;
-    char latWP = 'X';
-    char lonWP = 'X';
-
-    // parse out both latitude and direction for WayPoint, then go to next
-    // field, or fail
-    if (!isEmpty(p)) {
-      if (!parseCoord(p, &latitudeDegreesWP, &latitudeWP, &latitude_fixedWP,
-                      &latWP))
-        return false;
-      else
-        newDataValue(NMEA_LATWP, latitudeDegreesWP);
-    }
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction for WayPoint, then go to next
-    // field, or fail
-    if (!isEmpty(p)) {
-      if (!parseCoord(p, &longitudeDegreesWP, &longitudeWP, &longitude_fixedWP,
-                      &lonWP))
-        return false;
-      else
-        newDataValue(NMEA_LONWP, longitudeDegreesWP);
-    }
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_DISTWP, atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_COGWP, atof(p));
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_VMGWP, atof(p)); // skip arrival flag
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a MDA sentence, Meteorological Composite
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseMDA(char *p) {
+  // from Actisense NGW-1
+  if (!isEmpty(p))
+    newDataValue(NMEA_BAROMETER, parseFloat(p) * 3386.39);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_BAROMETER, parseFloat(p) * 100000);
+  p = nextField(p);
+  p = nextField(p);
+  nmea_float_t T = 100000.;
+  char u = 'C';
+  if (!isEmpty(p))
+    T = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    u = *p;
+  p = nextField(p);
+  if (u != 'C') {
+    T = (T - 32) / 1.8f;
+    u = 'C';
+  } // coerce to C
+  if (T < 1000)
+    newDataValue(NMEA_TEMPERATURE_AIR, T);
+  T = 100000.;
+  u = 'C';
+  if (!isEmpty(p))
+    T = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    u = *p;
+  p = nextField(p);
+  if (u != 'C') {
+    T = (T - 32) / 1.8f;
+    u = 'C';
+  }
+  if (T < 1000)
+    newDataValue(NMEA_TEMPERATURE_WATER, T);
+  if (!isEmpty(p))
+    newDataValue(NMEA_HUMIDITY, parseFloat(p)); // skip the rest
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "ROT")) { //*****************************ROT
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a MTW sentence, Mean Temperature of Water
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseMTW(char *p) {
+  nmea_float_t T = 100000.;
+  char u = 'C';
+  if (!isEmpty(p))
+    T = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    u = *p; // last before checksum
+  if (u != 'C') {
+    T = (T - 32) / 1.8f;
+    u = 'C';
+  }
+  if (T < 1000)
+    newDataValue(NMEA_TEMPERATURE_WATER, T);
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "RPM")) { //*****************************RPM
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a MWV sentence, Wind Speed and Angle
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseMWV(char *p) {
+  // from Actisense NGW-1
+  nmea_float_t ang = 100000.;
+  char ref = 'T';
+  if (!isEmpty(p))
+    ang = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    ref = *p;
+  p = nextField(p);
+  nmea_float_t spd = 100000.;
+  if (!isEmpty(p))
+    spd = parseFloat(p);
+  p = nextField(p);
+  char units = 'N';
+  if (!isEmpty(p))
+    units = *p;
+  p = nextField(p);
+  char stat = 'A';
+  if (!isEmpty(p))
+    stat = *p; // last before checksum
+  if (units == 'K') {
+    spd /= 1.6f;
+    units = 'M';
+  }
+  if (units == 'M') {
+    spd *= 5280.0f / 6000.0f;
+    units = 'N';
+  }
+  if (ang > 180.0f)
+    ang -= 360.0f;
+  if (ref == 'R') {
+    if (ang < 1000.0f && stat == 'A')
+      newDataValue(NMEA_AWA, ang);
+    if (spd < 1000.0f && stat == 'A')
+      newDataValue(NMEA_AWS, spd);
+  } else {
+    if (ang < 1000.0f && stat == 'A')
+      newDataValue(NMEA_TWA, ang);
+    if (spd < 1000.0f && stat == 'A')
+      newDataValue(NMEA_TWS, spd);
+  }
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "RSA")) { //*****************************RSA
-    // from Actisense NGW-1
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a RMB sentence, Recommended Minimum Navigation
+    Information
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseRMB(char *p) {
+  // from Actisense NGW-1 from SH CP150C
+  // RMB Recommended Minimum Navigation Information
+  //       1 2   3 4    5    6       7 8        9 10  11 12  13 14
+  //       | |   | |    |    |       | |        | |   |   |   | |
+  //$--RMB,A,x.x,a,c--c,c--c,llll.ll,a,yyyyy.yy,a,x.x,x.x,x.x,A*hh
+  // 1) Status, V = Navigation receiver warning
+  // 2) Cross Track error - nautical miles
+  // 3) Direction to Steer, Left or Right
+  // 4) TO Waypoint ID
+  // 5) FROM Waypoint ID
+  // 6) Destination Waypoint Latitude 7) N or S
+  // 8) Destination Waypoint Longitude 9) E or W
+  // 10) Range to destination in nautical miles
+  // 11) Bearing to destination in degrees True
+  // 12) Destination closing velocity in knots
+  // 13) Arrival Status, A = Arrival Circle Entered 14) Checksum
+  p = nextField(p); // skip status
+  nmea_float_t xte = 100000.;
+  char xteDir = 'X';
+  if (!isEmpty(p))
+    xte = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    xteDir = *p;
+  p = nextField(p);
+  if (xte < 10000.0f && xteDir != 'X') {
+    if (xteDir == 'L')
+      xte *= -1.0f;
+    newDataValue(NMEA_XTE, xte);
+  }
+  if (!isEmpty(p))
+    parseStr(toID, p, NMEA_MAX_WP_ID);
+  p = nextField(p);
+  if (!isEmpty(p))
+    parseStr(fromID, p, NMEA_MAX_WP_ID);
+  p = nextField(p);
+  nmea_float_t latitudeWP = 0;
+  nmea_float_t longitudeWP = 0;
+  int32_t latitude_fixedWP = 0;
+  int32_t longitude_fixedWP = 0;
+  nmea_float_t latitudeDegreesWP = 0;
+  nmea_float_t longitudeDegreesWP = 0;
+  char latWP = 'X';
+  char lonWP = 'X';
 
-  } else if (!strcmp(thisSentence, "TXT")) { //*****************************TXT
-    if (!isEmpty(p))
-      txtTot = atoi(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      txtN = atoi(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      txtID = atoi(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      parseStr(txtTXT, p, 61); // copy the text to NMEA TXT max of 61 characters
+  // parse out both latitude and direction for WayPoint, then go to next
+  // field, or fail
+  if (!isEmpty(p)) {
+    if (!parseCoord(p, &latitudeDegreesWP, &latitudeWP, &latitude_fixedWP,
+                    &latWP))
+      return false;
+    else
+      newDataValue(NMEA_LATWP, latitudeDegreesWP);
+  }
+  p = nextField(p);
+  p = nextField(p);
+  // parse out both longitude and direction for WayPoint, then go to next
+  // field, or fail
+  if (!isEmpty(p)) {
+    if (!parseCoord(p, &longitudeDegreesWP, &longitudeWP, &longitude_fixedWP,
+                    &lonWP))
+      return false;
+    else
+      newDataValue(NMEA_LONWP, longitudeDegreesWP);
+  }
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_DISTWP, parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_COGWP, parseFloat(p));
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_VMGWP, parseFloat(p)); // skip arrival flag
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "VDR")) { //*****************************VDR
-    // from Actisense NGW-1
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a TXT sentence, Text Transmission
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseTXT(char *p) {
+  if (!isEmpty(p))
+    txtTot = parseInt(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    txtN = parseInt(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    txtID = parseInt(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    parseStr(txtTXT, p, 61); // copy the text to NMEA TXT max of 61 characters
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "VHW")) { //*****************************VHW
-    // from Actisense NGW-1
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDT, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_HDG, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_VTW, atof(p)); // skip the other units
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a VHW sentence, Water Speed and Heading
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseVHW(char *p) {
+  // from Actisense NGW-1
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDT, parseFloat(p));
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_HDG, parseFloat(p));
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_VTW, parseFloat(p)); // skip the other units
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "VLW")) { //*****************************VLW
-    // from Actisense NGW-1
-    if (!isEmpty(p))
-      newDataValue(NMEA_LOG, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_LOGR, atof(p)); // skip the other units
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a VLW sentence, Distance Traveled through Water
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseVLW(char *p) {
+  // from Actisense NGW-1
+  if (!isEmpty(p))
+    newDataValue(NMEA_LOG, parseFloat(p));
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    newDataValue(NMEA_LOGR, parseFloat(p)); // skip the other units
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "VPW")) { //*****************************VPW
-    // knots, metres/s coerced to knots
-    nmea_float_t vmg = 100000.;
-    if (!isEmpty(p))
-      vmg = atof(p);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      vmg = atof(p) * 0.3048 * 3600. / 6000.; // skip units
-    if (vmg < 1000.0f)
-      newDataValue(NMEA_VMG, vmg);
-  } else if (!strcmp(thisSentence, "VTG")) { //*****************************VTG
-    // from Actisense NGW-1 from SH CP150C
-    return false;
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a VPW sentence, Speed Measured Parallel to Wind
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseVPW(char *p) {
+  // knots, metres/s coerced to knots
+  nmea_float_t vmg = 100000.;
+  if (!isEmpty(p))
+    vmg = parseFloat(p);
+  p = nextField(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    vmg = parseFloat(p) * 0.3048 * 3600. / 6000.; // skip units
+  if (vmg < 1000.0f)
+    newDataValue(NMEA_VMG, vmg);
+  return true;
+}
 
-  } else if (!strcmp(thisSentence, "VWR")) { //*****************************VWR
-    // from Actisense NGW-1
-    nmea_float_t ang = 1000.;
-    if (!isEmpty(p))
-      ang = atof(p);
-    p = strchr(p, ',') + 1;
-    char ref = ' ';
-    if (!isEmpty(p))
-      ref = *p;
-    p = strchr(p, ',') + 1;
-    if (ref == 'L')
-      ang *= -1;
-    if (ang < 1000.0f)
-      newDataValue(NMEA_AWA, ang);
-    nmea_float_t ws = 0.0;
-    char units = 'X';
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // knots
-    if (!isEmpty(p))
-      units = *p;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // meters / second
-    if (!isEmpty(p))
-      units = *p;
-    p = strchr(p, ',') + 1; // M
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // kilometers / hour can be converted back to knots
-    if (!isEmpty(p))
-      units = *p; // last before checksum
-    if (units == 'M') {
-      ws *= 3.6f;
-      units = 'K';
-    } // convert m/s to km/h
-    if (units == 'K') {
-      ws /= 1.6f;
-      units = 'M';
-    } // convert km/h to miles / h
-    if (units == 'M') {
-      ws *= 5280.0f / 6000.0f;
-      units = 'N';
-    } // convert miles / hr to knots
-    if (units == 'N')
-      newDataValue(NMEA_AWS, ws); // store the final result
-
-  } else if (!strcmp(thisSentence, "WCV")) { //*****************************WCV
-    // from SH CP150C
-    if (!isEmpty(p))
-      newDataValue(NMEA_VMGWP, atof(p)); // skip the rest
-
-  } else if (!strcmp(thisSentence, "XTE")) { //*****************************XTE
-    // from Actisense NGW-1 from SH CP150C
-    p = strchr(p, ',') + 1; // skip status 1
-    p = strchr(p, ',') + 1; // skip status 2
-    nmea_float_t xte = 100000.;
-    char xteDir = 'X';
-    if (!isEmpty(p))
-      xte = atof(p);
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      xteDir = *p;
-    p = strchr(p, ',') + 1;
-    if (xte < 10000.0f && xteDir != 'X') {
-      if (xteDir == 'L')
-        xte *= -1.0f;
-      newDataValue(NMEA_XTE, xte);
-    } // skip units
-
-  } else if (!strcmp(thisSentence, "ZDA")) { //*****************************ZDA
-    // from Actisense NGW-1
-    return false;
-  }
-#endif // NMEA_EXTENSIONS
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a VWR sentence, Relative Wind Speed and Angle
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseVWR(char *p) {
+  // from Actisense NGW-1
+  nmea_float_t ang = 1000.;
+  if (!isEmpty(p))
+    ang = parseFloat(p);
+  p = nextField(p);
+  char ref = ' ';
+  if (!isEmpty(p))
+    ref = *p;
+  p = nextField(p);
+  if (ref == 'L')
+    ang *= -1;
+  if (ang < 1000.0f)
+    newDataValue(NMEA_AWA, ang);
+  nmea_float_t ws = 0.0;
+  char units = 'X';
+  if (!isEmpty(p))
+    ws = parseFloat(p);
+  p = nextField(p); // knots
+  if (!isEmpty(p))
+    units = *p;
+  p = nextField(p);
+  if (!isEmpty(p))
+    ws = parseFloat(p);
+  p = nextField(p); // meters / second
+  if (!isEmpty(p))
+    units = *p;
+  p = nextField(p); // M
+  if (!isEmpty(p))
+    ws = parseFloat(p);
+  p = nextField(p); // kilometers / hour can be converted back to knots
+  if (!isEmpty(p))
+    units = *p; // last before checksum
+  if (units == 'M') {
+    ws *= 3.6f;
+    units = 'K';
+  } // convert m/s to km/h
+  if (units == 'K') {
+    ws /= 1.6f;
+    units = 'M';
+  } // convert km/h to miles / h
+  if (units == 'M') {
+    ws *= 5280.0f / 6000.0f;
+    units = 'N';
+  } // convert miles / hr to knots
+  if (units == 'N')
+    newDataValue(NMEA_AWS, ws); // store the final result
+  return true;
+}
 
-  else {
-    return false; // didn't find the required sentence definition
-  }
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a WCV sentence, Waypoint Closure Velocity
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseWCV(char *p) {
+  // from SH CP150C
+  if (!isEmpty(p))
+    newDataValue(NMEA_VMGWP, parseFloat(p)); // skip the rest
+  return true;
+}
 
-  // Record the successful parsing of where the last data came from and when
-  strcpy(lastSource, thisSource);
-  strcpy(lastSentence, thisSentence);
-  lastUpdate = millis();
+/**************************************************************************/
+/*!
+    @brief Parse the fields of a XTE sentence, Cross-Track Error, Measured
+    @param p Pointer to the first field
+    @return True if successfully parsed, false if fails parsing
+*/
+/**************************************************************************/
+bool Adafruit_GPS::parseXTE(char *p) {
+  // from Actisense NGW-1 from SH CP150C
+  p = nextField(p); // skip status 1
+  p = nextField(p); // skip status 2
+  nmea_float_t xte = 100000.;
+  char xteDir = 'X';
+  if (!isEmpty(p))
+    xte = parseFloat(p);
+  p = nextField(p);
+  if (!isEmpty(p))
+    xteDir = *p;
+  p = nextField(p);
+  if (xte < 10000.0f && xteDir != 'X') {
+    if (xteDir == 'L')
+      xte *= -1.0f;
+    newDataValue(NMEA_XTE, xte);
+  } // skip units
   return true;
 }
+#endif // NMEA_EXTENSIONS
 
 /**************************************************************************/
 /*!
     @brief Check an NMEA string for basic format, valid source ID and valid
     and valid sentence ID. Update the values of thisCheck, thisSource and
-    thisSentence.
+    thisSentence. If nmea is the unchanged line from lastNMEA(), the checksum
+    that read() kept as it received the line is used instead of scanning it.
     @param nmea Pointer to the NMEA string
     @return True if well formed, false if it has problems
 */
 /**************************************************************************/
 bool Adafruit_GPS::check(char *nmea) {
-  thisCheck = 0; // new check
   *thisSentence = *thisSource = 0;
-  if (*nmea != '$' && *nmea != '!')
-    return false; // doesn't start with $ or !
+  // read() checks the line it received as the characters arrive
+  if (nmea == (char *)lastline && lastCheck >= 0)
+    thisCheck = lastCheck;
   else
-    thisCheck += NMEA_HAS_DOLLAR;
+    thisCheck = checkSum(nmea); // new check
+  if (thisCheck != NMEA_HAS_DOLLAR + NMEA_HAS_CHECKSUM)
+    return false;
+  // extract source of variable length
+  char *p = nmea + 1;
+  uint16_t talker = (uint8_t)p[0] << 8 | (uint8_t)p[1];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < sizeof(talkers) / sizeof(talkers[0]); i++) {
+    if (talkers[i] == talker)
+      n = 2;
+  }
+  if (!n && p[0] == 'P')
+    n = 1;
+  if (!n)
+    return false;
+  strncpy(thisSource, p, n);
+  thisSource[n] = 0;
+  thisCheck += NMEA_HAS_SOURCE;
+  p += n;
+  // extract sentence id and check if parsed
+  uint32_t key = 0;
+  for (uint8_t i = 0; i < 3 && p[i]; i++)
+    key = key << 8 | (uint8_t)p[i];
+  uint8_t i = sentenceIndex[sentenceSlot(key)];
+  if (i >= sentenceCount || sentenceKeys[i] != key) {
+    parseStr(thisSentence, p, NMEA_MAX_SENTENCE_ID);
+    return false; // unknown
+  }
+  strncpy(thisSentence, p, 3);
+  thisSentence[3] = 0;
+  thisCheck += NMEA_HAS_SENTENCE;
+  if (!sentenceParsers[i])
+    return false; // known but not parsed
+  thisCheck += NMEA_HAS_SENTENCE_P;
+  thisIndex = i;
+  return true; // passed all the tests
+}
+
+/**************************************************************************/
+/*!
+    @brief Check an NMEA string for a leading $ or ! and a valid checksum.
+    @param nmea Pointer to the NMEA string
+    @return NMEA_BAD, NMEA_HAS_DOLLAR, or NMEA_HAS_DOLLAR + NMEA_HAS_CHECKSUM
+*/
+/**************************************************************************/
+int8_t Adafruit_GPS::checkSum(char *nmea) {
+  if (*nmea != '$' && *nmea != '!')
+    return NMEA_BAD; // doesn't start with $ or !
   // do checksum check -- first look if we even have one -- ignore all but last
   // *
   char *ast = nmea; // not strchr(nmea,'*'); for first *
@@ -572,45 +852,15 @@ bool Adafruit_GPS::check(char *nmea) {
     ast++; // go to the end
   while (*ast != '*' && ast > nmea)
     ast--; // then back to * if it's there
-  if (*ast != '*')
-    return false; // there is no asterisk
-  else {
-    uint16_t sum = parseHex(*(ast + 1)) * 16; // extract checksum
-    sum += parseHex(*(ast + 2));
-    char *p = nmea; // check checksum
-    for (char *p1 = p + 1; p1 < ast; p1++)
-      sum ^= *p1;
-    if (sum != 0)
-      return false; // bad checksum :(
-    else
-      thisCheck += NMEA_HAS_CHECKSUM;
-  }
-  // extract source of variable length
-  char *p = nmea + 1;
-  const char *src = tokenOnList(p, sources);
-  if (src) {
-    strcpy(thisSource, src);
-    thisCheck += NMEA_HAS_SOURCE;
-  } else
-    return false;
-  p += strlen(src);
-  // extract sentence id and check if parsed
-  const char *snc = tokenOnList(p, sentences_parsed);
-  if (snc) {
-    strcpy(thisSentence, snc);
-    thisCheck += NMEA_HAS_SENTENCE_P + NMEA_HAS_SENTENCE;
-  } else { // check if known
-    snc = tokenOnList(p, sentences_known);
-    if (snc) {
-      strcpy(thisSentence, snc);
-      thisCheck += NMEA_HAS_SENTENCE;
-      return false; // known but not parsed
-    } else {
-      parseStr(thisSentence, p, NMEA_MAX_SENTENCE_ID);
-      return false; // unknown
-    }
-  }
-  return true; // passed all the tests
+  if (*ast != '*' || !ast[1] || !ast[2])
+    return NMEA_HAS_DOLLAR; // there is no asterisk and two digits after it
+  uint16_t sum = parseHex(*(ast + 1)) * 16; // extract checksum
+  sum += parseHex(*(ast + 2));
+  for (char *p1 = nmea + 1; p1 < ast; p1++)
+    sum ^= *p1;
+  if (sum != 0)
+    return NMEA_HAS_DOLLAR; // bad checksum :(
+  return NMEA_HAS_DOLLAR + NMEA_HAS_CHECKSUM;
 }
 
 /**************************************************************************/
@@ -682,18 +932,28 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
                               char *dir) {
   char *p = pStart;
   if (!isEmpty(p)) {
-    // get the number in DDDMM.mmmm format and break into components
-    char degreebuff[10] = {0}; // Ensure string is terminated after strncpy
-    char *e = strchr(p, '.');
-    if (e == NULL || e - p > 6)
-      return false;                // no decimal point in range
-    strncpy(degreebuff, p, e - p); // get DDDMM
-    long dddmm = atol(degreebuff);
-    long degrees = (dddmm / 100);         // truncate the minutes
-    long minutes = dddmm - degrees * 100; // remove the degrees
-    p = e;                                // start from the decimal point
-    nmea_float_t decminutes = atof(e); // the fraction after the decimal point
-    p = strchr(p, ',') + 1;            // go to the next field
+    // get the number in DDDMM.mmmm format and break into components, with
+    // the fraction of a minute as an integer count of 1e-7 minutes
+    int32_t dddmm = 0;
+    for (; isDigit(*p) && p - pStart < 6; p++)
+      dddmm = dddmm * 10 + *p - '0';
+    if (*p != '.')
+      return false;                          // no decimal point in range
+    int32_t degrees = (dddmm / 100);         // truncate the minutes
+    int32_t minutes = dddmm - degrees * 100; // remove the degrees
+    if (degrees > 180)
+      return false; // and degrees * 10000000 below would overflow
+    int32_t decminutes = 0;
+    uint8_t n = 0;
+    for (p++; isDigit(*p); p++) {
+      if (n < 7) {
+        decminutes = decminutes * 10 + *p - '0';
+        n++;
+      }
+    }
+    for (; n < 7; n++)
+      decminutes *= 10;
+    p = nextField(p); // go to the next field
 
     // get the NSEW direction as a character
     char nsew = 'X';
@@ -703,9 +963,9 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
       return false; // no direction provided
 
     // set the various numerical formats to their values
-    long fixed = degrees * 10000000 + (minutes * 10000000) / 60 +
-                 (decminutes * 10000000) / 60;
-    nmea_float_t ang = degrees * 100 + minutes + decminutes;
+    int32_t fixed =
+        degrees * 10000000 + (minutes * 10000000 + decminutes) / 60;
+    nmea_float_t ang = dddmm + decminutes / (nmea_float_t)10000000.;
     nmea_float_t deg = fixed / (nmea_float_t)10000000.;
     if (nsew == 'S' ||
         nsew == 'W') { // fixed and deg are signed, but DDDMM.mmmm is not
@@ -749,24 +1009,87 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
 */
 /**************************************************************************/
 char *Adafruit_GPS::parseStr(char *buff, char *p, int n) {
-  char *e = strchr(p, ',');
-  int len = 0;
-  if (e) {
-    len = min(int(e - p), n - 1);
-    strncpy(buff, p, len); // copy up to the comma
-    buff[len] = 0;
-  } else {
-    e = strchr(p, '*');
-    if (e) {
-      len = min(int(e - p), n - 1);
-      strncpy(buff, p, len); // or up to the *
-      buff[e - p] = 0;
+  int len = 0; // copy up to the comma, the *, the end or max capacity
+  for (; len < n - 1 && p[len] != ',' && p[len] != '*' && p[len]; len++)
+    buff[len] = p[len];
+  buff[len] = 0;
+  return buff;
+}
+
+/**************************************************************************/
+/*!
+    @brief Parse a decimal number from an NMEA field as a scaled integer,
+    using no floating point. The value is the result / 10^places. Keeps the
+    first 9 significant digits, and at most 9 decimal places.
+    @param p Pointer to the location of the token in the NMEA string
+    @param places Pointer to fill with the number of decimal places kept
+    @return The digits as an integer, 0 if there is no number
+*/
+/**************************************************************************/
+int32_t Adafruit_GPS::parseDecimal(char *p, uint8_t *places) {
+  bool neg = (*p == '-');
+  if (neg || *p == '+')
+    p++;
+  int32_t v = 0;
+  uint8_t dec = 0;
+  bool point = false;
+  for (;; p++) {
+    if (isDigit(*p)) {
+      if (v >= 100000000L || dec >= 9) {
+        if (point)
+          continue; // drop decimal places that won't fit
+        v = 999999999L; // too big to be NMEA data
+      } else {
+        v = v * 10 + *p - '0';
+        if (point)
+          dec++;
+      }
+    } else if (*p == '.' && !point) {
+      point = true;
     } else {
-      len = min((int)strlen(p), n - 1);
-      strncpy(buff, p, len); // or to the end or max capacity
+      break; // end of the number
     }
   }
-  return buff;
+  *places = dec;
+  return neg ? -v : v;
+}
+
+/**************************************************************************/
+/*!
+    @brief Parse a decimal number from an NMEA field. Replaces atof(), with
+    the digits converted as an integer and a single division by a power of
+    ten, far quicker without floating point hardware.
+    @param p Pointer to the location of the token in the NMEA string
+    @return The value, 0 if there is no number
+*/
+/**************************************************************************/
+nmea_float_t Adafruit_GPS::parseFloat(char *p) {
+  static const int32_t tens[10] = {1,      10,      100,      1000,     10000,
+                                   100000, 1000000, 10000000, 100000000,
+                                   1000000000L};
+  uint8_t places;
+  int32_t v = parseDecimal(p, &places);
+  if (places == 0)
+    return v;
+  return v / (nmea_float_t)tens[places];
+}
+
+/**************************************************************************/
+/*!
+    @brief Parse the integer part of a number from an NMEA field. Replaces
+    atoi() and atol().
+    @param p Pointer to the location of the token in the NMEA string
+    @return The value, 0 if there is no number
+*/
+/**************************************************************************/
+int32_t Adafruit_GPS::parseInt(char *p) {
+  bool neg = (*p == '-');
+  if (neg || *p == '+')
+    p++;
+  int32_t v = 0;
+  for (; isDigit(*p); p++)
+    v = v < 100000000L ? v * 10 + *p - '0' : 999999999L; // too big for NMEA
+  return neg ? -v : v;
 }
 
 /**************************************************************************/
@@ -779,16 +1102,22 @@ char *Adafruit_GPS::parseStr(char *buff, char *p, int n) {
 /**************************************************************************/
 bool Adafruit_GPS::parseTime(char *p) {
   if (!isEmpty(p)) { // get time
-    uint32_t time = atol(p);
+    uint32_t time = parseInt(p);
     hour = time / 10000;
     minute = (time % 10000) / 100;
     seconds = (time % 100);
-    char *dec = strchr(p, '.');
-    char *comstar = min(strchr(p, ','), strchr(p, '*'));
-    if (dec != NULL && comstar != NULL && dec < comstar)
-      milliseconds = atof(dec) * 1000;
-    else
-      milliseconds = 0;
+    // up to three digits of milliseconds after the decimal point, if any
+    milliseconds = 0;
+    while (isDigit(*p))
+      p++;
+    if (*p == '.') {
+      p++;
+      for (uint8_t n = 0; n < 3; n++) {
+        milliseconds *= 10;
+        if (isDigit(*p))
+          milliseconds += *p++ - '0';
+      }
+    }
     lastTime = sentTime;
     return true;
   }
@@ -848,7 +1177,7 @@ bool Adafruit_GPS::parseAntenna(char *p) {
 */
 /**************************************************************************/
 bool Adafruit_GPS::isEmpty(char *pStart) {
-  if (',' != *pStart && '*' != *pStart && pStart != NULL)
+  if (pStart != NULL && ',' != *pStart && '*' != *pStart && *pStart)
     return false;
   else
     return true;
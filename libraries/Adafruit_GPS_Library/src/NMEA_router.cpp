@@ -0,0 +1,353 @@
+/**************************************************************************/
+/*!
+  @file NMEA_router.cpp
+
+  Code for passing NMEA sentences from several inputs to several outputs,
+  e.g. merging a GPS, a compass and a depth sounder onto one chart plotter
+  while sending only the position to an autopilot. Each output port has a
+  list of sentences in the same form as Adafruit_GPS::onList(), a limit on
+  how often each sentence id is passed on, and a queue so that a slow port
+  doesn't hold up the others.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+
+#include <NMEA_router.h>
+
+// value of a hex digit, or 0 if it isn't one
+static uint8_t hexValue(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief Add a Stream to read NMEA sentences from.
+    @param in Pointer to the Stream, e.g. &Serial1
+    @return The index of the input in inputs[], or -1 if there is no room
+*/
+/**************************************************************************/
+int8_t Adafruit_NMEA_Router::addInput(Stream *in) {
+  if (nInputs >= NMEA_ROUTER_INPUTS)
+    return -1;
+  inputs[nInputs].in = in;
+  return nInputs++;
+}
+
+/**************************************************************************/
+/*!
+    @brief Add a port to send NMEA sentences to.
+    @param out Pointer to the Print to write to, e.g. &Serial2
+    @param list A list of sentences to pass, with the final entry "ZZ", or
+    NULL to pass everything. Three letter entries match the sentence id
+    after a two letter source, like onList(). Longer entries match the start
+    of the name, e.g. "GPGSV" or "PMTK".
+    @param minGap Least time in ms between sentences with the same id, 0 for
+    no limit
+    @param decimate Pass only one in this many sentences with each id. Only
+    the NMEA_ROUTER_RATE_IDS most recently sent ids are tracked, so increase
+    it if the port sees more ids than that.
+    @param blocking True to write whole lines whatever availableForWrite()
+    says, for a Print that doesn't implement it. The base
+    Print::availableForWrite() returns 0, so without blocking nothing would
+    ever be written to such a port.
+    @return The index of the output in outputs[], or -1 if there is no room
+*/
+/**************************************************************************/
+int8_t Adafruit_NMEA_Router::addOutput(Print *out, const char **list,
+                                       uint16_t minGap, uint8_t decimate,
+                                       bool blocking) {
+  if (nOutputs >= NMEA_ROUTER_OUTPUTS)
+    return -1;
+  nmea_router_output_t *o = &outputs[nOutputs];
+  o->out = out;
+  o->list = list;
+  o->minGap = minGap;
+  o->decimate = max((uint8_t)1, decimate);
+  o->blocking = blocking;
+  return nOutputs++;
+}
+
+/**************************************************************************/
+/*!
+    @brief Parse every valid sentence with an Adafruit_GPS object as well as
+    passing it on, so the sketch has the merged data from all the inputs.
+    @param gps Pointer to the Adafruit_GPS object, or NULL to stop parsing
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Router::setParser(Adafruit_GPS *gps) { parser = gps; }
+
+/**************************************************************************/
+/*!
+    @brief Read what is waiting on each input, pass each complete sentence
+    to the outputs that want it, and write as much of each output queue as
+    the port has room for. Call it frequently from loop().
+    @param maxChars Most characters to take from each input in one call
+    @return The number of valid sentences received
+*/
+/**************************************************************************/
+uint16_t Adafruit_NMEA_Router::service(uint16_t maxChars) {
+  uint16_t received = 0;
+  for (uint8_t i = 0; i < nInputs; i++) {
+    nmea_router_input_t *r = &inputs[i];
+    for (uint16_t n = 0; n < maxChars; n++) {
+      int c = r->in->read();
+      if (c < 0)
+        break;
+
+      if (c == '$' || c == '!') { // start of a sentence, even mid line
+        if (r->line >= 0) {
+          r->bad++; // the last one never ended
+          release(r->line);
+        }
+        r->line = newLine();
+        if (r->line < 0) {
+          r->noBuffer++;
+          continue;
+        }
+        lines[r->line][0] = c;
+        r->len = 1;
+        r->sum = r->star = r->starSum = 0;
+        continue;
+      }
+      if (r->line < 0)
+        continue; // waiting for the start of a sentence
+
+      char *line = lines[r->line];
+      if (r->len >= MAXLINELENGTH - 1) {
+        r->tooLong++;
+        release(r->line);
+        r->line = -1;
+        continue;
+      }
+      line[r->len] = c;
+      if (c == '*') {
+        r->star = r->len;
+        r->starSum = r->sum;
+      }
+      r->sum ^= c;
+      r->len++;
+      if (c != '\n')
+        continue;
+
+      // a complete line, so check it once for all the outputs
+      line[r->len] = 0;
+      bool ok;
+      if (r->star && r->star + 2 < r->len)
+        ok = r->starSum == (hexValue(line[r->star + 1]) << 4 |
+                            hexValue(line[r->star + 2]));
+      else
+        ok = !needChecksum;
+      if (ok) {
+        r->sentences++;
+        received++;
+        lengths[r->line] = r->len;
+        route(r->line);
+      } else
+        r->bad++;
+      release(r->line);
+      r->line = -1;
+    }
+  }
+  for (uint8_t i = 0; i < nOutputs; i++)
+    send(&outputs[i]);
+  return received;
+}
+
+/**************************************************************************/
+/*!
+    @brief Find a free line in the pool and claim it. If there are none, drop
+    the oldest lines from the longest queues until one is free, so a port
+    that has stopped taking data can't starve the rest. A line that is
+    partly written is kept, so the port doesn't get half a sentence.
+    @return The index of the line, or -1 if all are in use by the inputs
+*/
+/**************************************************************************/
+int8_t Adafruit_NMEA_Router::newLine(void) {
+  while (true) {
+    for (uint8_t i = 0; i < NMEA_ROUTER_LINES; i++) {
+      if (users[i] == 0) {
+        users[i] = 1;
+        return i;
+      }
+    }
+    nmea_router_output_t *longest = NULL;
+    uint8_t most = 0;
+    for (uint8_t i = 0; i < nOutputs; i++) {
+      uint8_t n = outputs[i].depth - (outputs[i].written ? 1 : 0);
+      if (n > most) {
+        longest = &outputs[i];
+        most = n;
+      }
+    }
+    if (!longest)
+      return -1;
+    uint8_t q = longest->head;
+    if (longest->written) { // drop the next one and move the head up to it
+      uint8_t next = q + 1 < NMEA_ROUTER_QUEUE ? q + 1 : 0;
+      uint8_t partial = longest->queue[q];
+      longest->queue[q] = longest->queue[next];
+      longest->queue[next] = partial;
+    }
+    release(longest->queue[q]);
+    if (++longest->head >= NMEA_ROUTER_QUEUE)
+      longest->head = 0;
+    longest->depth--;
+    longest->dropped++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Give up one claim on a line in the pool, freeing it after the last
+    @param line The index of the line
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Router::release(uint8_t line) {
+  if (users[line])
+    users[line]--;
+}
+
+/**************************************************************************/
+/*!
+    @brief Queue a valid sentence for each output that wants it. The queues
+    hold the index of the line, so the sentence itself is never copied.
+    @param line The index of the line in the pool
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Router::route(uint8_t line) {
+  const char *nmea = lines[line];
+  if (parser)
+    parser->parse((char *)nmea);
+  uint32_t key = NMEA_KEY(nmea[3], nmea[4], nmea[5]);
+  for (uint8_t i = 0; i < nOutputs; i++) {
+    nmea_router_output_t *o = &outputs[i];
+    if (!onList(o, nmea)) {
+      o->filtered++;
+      continue;
+    }
+    if (o->depth >= NMEA_ROUTER_QUEUE) {
+      send(o); // make room if the port can take some
+      if (o->depth >= NMEA_ROUTER_QUEUE) {
+        o->dropped++;
+        continue;
+      }
+    }
+    if (!rateOK(o, key)) {
+      o->limited++;
+      continue;
+    }
+    uint8_t q = o->head + o->depth;
+    if (q >= NMEA_ROUTER_QUEUE)
+      q -= NMEA_ROUTER_QUEUE;
+    o->queue[q] = line;
+    users[line]++;
+    o->depth++;
+    if (o->depth > o->maxDepth)
+      o->maxDepth = o->depth;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Check if a sentence is on an output's list.
+    @param o Pointer to the output
+    @param nmea Pointer to the sentence
+    @return True if the output has no list or the sentence is on it
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Router::onList(nmea_router_output_t *o, const char *nmea) {
+  if (!o->list)
+    return true;
+  // stop at terminator with first two letters ZZ and don't crash without it
+  for (int i = 0; strncmp(o->list[i], "ZZ", 2) && i < 1000; i++) {
+    const char *e = o->list[i];
+    size_t n = strlen(e);
+    if (n == 3 ? !strncmp(nmea + 3, e, 3) : !strncmp(nmea + 1, e, n))
+      return true;
+  }
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief Apply an output's minGap and decimate limits to a sentence id,
+    and record that it is being sent if it passes.
+    @param o Pointer to the output
+    @param key The sentence id packed by NMEA_KEY()
+    @return True if the sentence should be sent
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Router::rateOK(nmea_router_output_t *o, uint32_t key) {
+  if (o->minGap == 0 && o->decimate <= 1)
+    return true;
+  uint32_t now = millis();
+  // find the id, or else the one that has gone longest without being sent
+  nmea_router_rate_t *e = &o->rate[0];
+  for (uint8_t i = 0; i < NMEA_ROUTER_RATE_IDS; i++) {
+    if (o->rate[i].key == key) {
+      e = &o->rate[i];
+      break;
+    }
+    if (now - o->rate[i].lastSent > now - e->lastSent || !o->rate[i].key)
+      e = &o->rate[i];
+  }
+  if (e->key != key) { // first time, or for a long time
+    e->key = key;
+    e->count = 0;
+  } else if (now - e->lastSent < o->minGap)
+    return false;
+  if (e->count > 0) { // skipping the rest of the decimate group
+    if (++e->count >= o->decimate)
+      e->count = 0;
+    return false;
+  }
+  if (o->decimate > 1)
+    e->count = 1;
+  e->lastSent = now;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Write the lines waiting in an output's queue, oldest first, until
+    the queue is empty or the port has no more room. A line that doesn't fit
+    is written in pieces as room appears, as a serial port's transmit
+    buffer may be smaller than a sentence, e.g. 64 bytes on AVR. Ports with
+    blocking set are written whole lines.
+    @param o Pointer to the output
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Router::send(nmea_router_output_t *o) {
+  while (o->depth) {
+    uint8_t line = o->queue[o->head];
+    uint8_t n = lengths[line] - o->written;
+    if (!o->blocking) {
+      int room = o->out->availableForWrite();
+      if (room <= 0)
+        return;
+      if (room < n)
+        n = room;
+    }
+    o->written += o->out->write((const uint8_t *)lines[line] + o->written, n);
+    if (o->written < lengths[line])
+      return; // the rest when there is room
+    o->written = 0;
+    o->sent++;
+    release(line);
+    if (++o->head >= NMEA_ROUTER_QUEUE)
+      o->head = 0;
+    o->depth--;
+  }
+}
@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*!
+  @file NMEA_router.h
+
+  A multiplexer for NMEA sentences that reads several input Streams, checks
+  each sentence once, and passes it on to the output ports whose lists
+  include it. Sentences are assembled in a shared pool of line buffers and
+  the output queues hold references into the pool, so a sentence going to
+  several ports is never copied.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+#ifndef _NMEA_ROUTER_H
+#define _NMEA_ROUTER_H
+
+#include <Adafruit_GPS.h>
+
+#ifndef NMEA_ROUTER_INPUTS
+#define NMEA_ROUTER_INPUTS 3 ///< most input Streams
+#endif
+#ifndef NMEA_ROUTER_OUTPUTS
+#define NMEA_ROUTER_OUTPUTS 3 ///< most output ports
+#endif
+#ifndef NMEA_ROUTER_LINES
+#define NMEA_ROUTER_LINES                                                      \
+  8 ///< line buffers shared by the inputs and the output queues
+#endif
+#ifndef NMEA_ROUTER_QUEUE
+#define NMEA_ROUTER_QUEUE 6 ///< most sentences waiting for one output
+#endif
+#ifndef NMEA_ROUTER_RATE_IDS
+#define NMEA_ROUTER_RATE_IDS                                                   \
+  8 ///< sentence ids an output tracks for rate limiting and decimation
+#endif
+
+/**************************************************************************/
+/*!
+  Struct for one input Stream and the counts of what it has sent.
+ **************************************************************************/
+typedef struct {
+  Stream *in = NULL;        ///< where the sentences come from
+  int8_t line = -1;         ///< pool line being filled, or -1 if none
+  uint8_t len = 0;          ///< characters in the line so far
+  uint8_t sum = 0;          ///< XOR of the line after the first character
+  uint8_t star = 0;         ///< index of the last * in the line, or 0
+  uint8_t starSum = 0;      ///< sum up to the last *
+  uint32_t sentences = 0;   ///< valid sentences received
+  uint32_t bad = 0;         ///< lines dropped for a bad or missing checksum
+  uint32_t tooLong = 0;     ///< lines dropped for being too long
+  uint32_t noBuffer = 0;    ///< lines dropped because the pool was empty
+} nmea_router_input_t;
+
+/**************************************************************************/
+/*!
+  Struct for one sentence id an output has sent, for rate limiting and
+  decimation.
+ **************************************************************************/
+typedef struct {
+  uint32_t key = 0;      ///< sentence id packed by NMEA_KEY(), 0 if unused
+  uint32_t lastSent = 0; ///< millis() when it was last queued
+  uint8_t count = 0;     ///< sentences with this id since the last one queued
+} nmea_router_rate_t;
+
+/**************************************************************************/
+/*!
+  Struct for one output port, its filter, its queue of references into the
+  line pool, and the counts of what happened to the sentences sent its way.
+ **************************************************************************/
+typedef struct {
+  Print *out = NULL;         ///< where the sentences go
+  const char **list = NULL;  ///< sentences to pass, "ZZ" last, NULL for all
+  uint16_t minGap = 0;       ///< least ms between sentences with the same id
+  uint8_t decimate = 1;      ///< pass only one in this many of each id
+  bool blocking = false;     ///< write whole lines, ignore availableForWrite()
+  uint8_t queue[NMEA_ROUTER_QUEUE]; ///< pool lines waiting, oldest first
+  uint8_t head = 0;                 ///< index in queue of the oldest line
+  uint8_t depth = 0;                ///< lines waiting in the queue
+  uint8_t maxDepth = 0;             ///< most lines ever waiting at once
+  uint8_t written = 0;              ///< characters of the oldest line written
+  nmea_router_rate_t rate[NMEA_ROUTER_RATE_IDS]; ///< recently sent ids
+  uint32_t sent = 0;                             ///< sentences written
+  uint32_t filtered = 0;  ///< sentences not on the list
+  uint32_t limited = 0;   ///< sentences skipped by minGap or decimate
+  uint32_t dropped = 0;   ///< sentences lost because the queue was full
+} nmea_router_output_t;
+
+/**************************************************************************/
+/*!
+    @brief  Routes NMEA sentences from several inputs to several outputs
+*/
+/**************************************************************************/
+class Adafruit_NMEA_Router {
+public:
+  int8_t addInput(Stream *in);
+  int8_t addOutput(Print *out, const char **list = NULL, uint16_t minGap = 0,
+                   uint8_t decimate = 1, bool blocking = false);
+  void setParser(Adafruit_GPS *gps);
+  uint16_t service(uint16_t maxChars = 200);
+
+  nmea_router_input_t inputs[NMEA_ROUTER_INPUTS];    ///< the input Streams
+  nmea_router_output_t outputs[NMEA_ROUTER_OUTPUTS]; ///< the output ports
+  uint8_t nInputs = 0;  ///< number of inputs added
+  uint8_t nOutputs = 0; ///< number of outputs added
+  bool needChecksum = true; ///< drop sentences that don't have a checksum
+
+private:
+  int8_t newLine(void);
+  void release(uint8_t line);
+  void route(uint8_t line);
+  bool onList(nmea_router_output_t *o, const char *nmea);
+  bool rateOK(nmea_router_output_t *o, uint32_t key);
+  void send(nmea_router_output_t *o);
+
+  char lines[NMEA_ROUTER_LINES][MAXLINELENGTH]; ///< the shared line pool
+  uint8_t lengths[NMEA_ROUTER_LINES];           ///< length of each line
+  uint8_t users[NMEA_ROUTER_LINES] = {0}; ///< inputs and queues using a line
+  Adafruit_GPS *parser = NULL;            ///< parses every valid sentence
+};
+
+#endif // _NMEA_ROUTER_H
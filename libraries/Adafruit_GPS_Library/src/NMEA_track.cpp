@@ -0,0 +1,350 @@
+/**************************************************************************/
+/*!
+  @file NMEA_track.cpp
+
+  Code for recording a track with as few points and bytes as possible. Each
+  new fix is held back in a window that starts at the last point kept, and
+  while the straight line from that point to the new fix passes within the
+  tolerance of every fix in between, none of them are needed. When it
+  doesn't, or the window is full, the fix before the new one is kept and
+  starts the next window. This is the opening window form of Douglas-Peucker
+  line simplification, so a drive along straight roads needs only the
+  corners, and a track drawn from the kept points is never further than the
+  tolerance from any recorded fix.
+
+  Each kept point is written as the difference in time, latitude and
+  longitude from the point before, each zig-zag encoded so that small
+  negative numbers are small too, then written as a varint, seven bits per
+  byte, low bits first, with the top bit set on every byte but the last. The
+  first point in a file is the difference from 0, 0 at 2000-01-01. A point a
+  few seconds and a few tens of metres from the last takes 4 to 6 bytes
+  instead of the 12 of the raw values.
+
+  The records can go to any Print, such as a File on an SD card, or into a
+  RAM buffer used as a ring, where the oldest points are dropped to make
+  room for new ones. trackdecode/trackdecode.py reads a file on a computer.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+
+#include <NMEA_track.h>
+
+// metres per 1/10000000 degree of latitude
+#define METRES_PER_UNIT 0.011132
+
+// days before the first of each month in a year that isn't a leap year
+static const uint16_t daysBefore[12] = {0,   31,  59,  90,  120, 151,
+                                        181, 212, 243, 273, 304, 334};
+
+// write one zig-zag varint, returning the bytes used
+static uint8_t putVarint(uint8_t *rec, int32_t value) {
+  uint32_t v = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+  uint8_t n = 0;
+  while (v >= 0x80) {
+    rec[n++] = (v & 0x7F) | 0x80;
+    v >>= 7;
+  }
+  rec[n++] = v;
+  return n;
+}
+
+// read one zig-zag varint, returning the bytes used or 0 if it is cut short
+static uint8_t getVarint(const uint8_t *rec, uint8_t len, int32_t *value) {
+  uint32_t v = 0;
+  for (uint8_t n = 0; n < len && n < 5; n++) {
+    v |= (uint32_t)(rec[n] & 0x7F) << (7 * n);
+    if (!(rec[n] & 0x80)) {
+      *value = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+      return n + 1;
+    }
+  }
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief Start recording into a RAM buffer. When it fills up the oldest
+    points are dropped to make room, and rewind() and next() read back what
+    is left.
+    @param buffer Pointer to the RAM to use
+    @param size Size of the buffer in bytes, at least NMEA_TRACK_MAX_RECORD
+    @param tolerance Furthest in metres the track may stray from a fix
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::begin(uint8_t *buffer, uint16_t size,
+                                nmea_float_t tolerance) {
+  begin((Print *)NULL, tolerance);
+  this->buffer = buffer;
+  this->size = size;
+}
+
+/**************************************************************************/
+/*!
+    @brief Start recording to a Print, e.g. a File on an SD card opened for
+    writing. Call flush() before closing the file to write the last point.
+    @param out Pointer to the Print to write to
+    @param tolerance Furthest in metres the track may stray from a fix
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::begin(Print *out, nmea_float_t tolerance) {
+  this->out = out;
+  buffer = NULL;
+  size = tail = used = readPos = readLeft = 0;
+  tolerance /= METRES_PER_UNIT;
+  tolerance2 = tolerance * tolerance;
+  nWindow = 0;
+  points = kept = bytes = overwritten = 0;
+  last = first = reading = nmea_track_point_t();
+}
+
+/**************************************************************************/
+/*!
+    @brief Add the current fix from a GPS to the track.
+    @param gps Pointer to the Adafruit_GPS object with the fix
+    @return True if the GPS had a fix to add
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Track::add(Adafruit_GPS *gps) {
+  if (!gps->fix)
+    return false;
+  uint8_t month = gps->month >= 1 && gps->month <= 12 ? gps->month : 1;
+  uint32_t days = gps->year * 365UL + (gps->year + 3) / 4 +
+                  daysBefore[month - 1] + max(gps->day, (uint8_t)1) - 1;
+  if (month > 2 && gps->year % 4 == 0)
+    days++;
+  return add(gps->latitude_fixed, gps->longitude_fixed,
+             ((days * 24 + gps->hour) * 60 + gps->minute) * 60 +
+                 gps->seconds);
+}
+
+/**************************************************************************/
+/*!
+    @brief Add a point to the track.
+    @param lat Latitude in 1/10000000 degree, like latitude_fixed
+    @param lon Longitude in 1/10000000 degree, like longitude_fixed
+    @param time Seconds since 2000-01-01 00:00 UTC, or any other count of
+    seconds that doesn't go backwards
+    @return True, to match add(Adafruit_GPS *)
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Track::add(int32_t lat, int32_t lon, uint32_t time) {
+  nmea_track_point_t p;
+  p.lat = lat;
+  p.lon = lon;
+  p.time = time;
+  points++;
+  if (nWindow == 0) {
+    keep(&p);
+    return true;
+  }
+  if (nWindow >= NMEA_TRACK_WINDOW || !fits(&p))
+    keep(&window[nWindow - 1]);
+  window[nWindow++] = p;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Check if the straight line from the last point kept to a new
+    point passes close enough to all the points held back.
+    @param p Pointer to the new point
+    @return True if none of the points held back are needed
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Track::fits(const nmea_track_point_t *p) {
+  const nmea_track_point_t *a = &window[0];
+  // work in a flat patch around a, with both axes in 1/10000000 degree of
+  // latitude, which is close enough over the length of one window
+  nmea_float_t dx = (int32_t)((uint32_t)p->lon - a->lon) * lonScale;
+  nmea_float_t dy = (int32_t)((uint32_t)p->lat - a->lat);
+  nmea_float_t len2 = dx * dx + dy * dy;
+  for (uint8_t i = 1; i < nWindow; i++) {
+    nmea_float_t x = (int32_t)((uint32_t)window[i].lon - a->lon) * lonScale;
+    nmea_float_t y = (int32_t)((uint32_t)window[i].lat - a->lat);
+    // distance to the nearest point on the segment, not the whole line, so
+    // going out and back along a road keeps the far end
+    nmea_float_t t = len2 > 0 ? (x * dx + y * dy) / len2 : 0;
+    if (t < 0)
+      t = 0;
+    else if (t > 1)
+      t = 1;
+    x -= t * dx;
+    y -= t * dy;
+    if (x * x + y * y > tolerance2)
+      return false;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Write out the last point held back, so that the track ends at
+    the last fix added. Recording carries on from there.
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::flush(void) {
+  if (nWindow < 2)
+    return;
+  keep(&window[nWindow - 1]);
+  nWindow = 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief Write a point out as a record and make it the start of the next
+    window, working out the east-west scale there.
+    @param p Pointer to the point
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::keep(const nmea_track_point_t *p) {
+  uint8_t rec[NMEA_TRACK_MAX_RECORD];
+  uint8_t len = encode(rec, &last, p);
+  last = *p;
+  window[0] = *p;
+  nWindow = 1;
+  lonScale = cos(p->lat * (nmea_float_t)(DEG_TO_RAD / 1e7));
+  kept++;
+  bytes += len;
+  if (out)
+    out->write(rec, len);
+  if (!buffer || len > size)
+    return;
+  while (size - used < len)
+    dropOldest();
+  uint16_t head = tail + used;
+  for (uint8_t i = 0; i < len; i++) {
+    if (head >= size)
+      head -= size;
+    buffer[head++] = rec[i];
+  }
+  used += len;
+}
+
+/**************************************************************************/
+/*!
+    @brief Drop the oldest record from the RAM buffer, moving the base of
+    the next one on so that it still decodes.
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::dropOldest(void) {
+  uint8_t rec[NMEA_TRACK_MAX_RECORD];
+  uint8_t len = decode(rec, copyOut(tail, rec), &first);
+  if (len == 0) { // can't happen unless the buffer was written over
+    tail = used = 0;
+    return;
+  }
+  tail += len;
+  if (tail >= size)
+    tail -= size;
+  used -= len;
+  overwritten++;
+}
+
+/**************************************************************************/
+/*!
+    @brief Copy up to one record's worth of bytes out of the RAM buffer,
+    unwrapping it if it runs past the end.
+    @param pos Index in the buffer to start from
+    @param rec Pointer to NMEA_TRACK_MAX_RECORD bytes to copy to
+    @return The number of bytes copied
+*/
+/**************************************************************************/
+uint8_t Adafruit_NMEA_Track::copyOut(uint16_t pos, uint8_t *rec) {
+  uint16_t left = used - (pos >= tail ? pos - tail : pos + size - tail);
+  uint8_t n = min(left, (uint16_t)NMEA_TRACK_MAX_RECORD);
+  for (uint8_t i = 0; i < n; i++) {
+    rec[i] = buffer[pos++];
+    if (pos >= size)
+      pos = 0;
+  }
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief Go back to the oldest point in the RAM buffer for next(). Call
+    flush() first to include the last fix added.
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_NMEA_Track::rewind(void) {
+  readPos = tail;
+  readLeft = used;
+  reading = first;
+}
+
+/**************************************************************************/
+/*!
+    @brief Read the next point from the RAM buffer, oldest first.
+    @param p Pointer to the point to fill in
+    @return True if there was another point, false at the end
+*/
+/**************************************************************************/
+bool Adafruit_NMEA_Track::next(nmea_track_point_t *p) {
+  if (!buffer || readLeft == 0)
+    return false;
+  uint8_t rec[NMEA_TRACK_MAX_RECORD];
+  uint8_t len = decode(rec, copyOut(readPos, rec), &reading);
+  if (len == 0) {
+    readLeft = 0;
+    return false;
+  }
+  readPos += len;
+  if (readPos >= size)
+    readPos -= size;
+  readLeft -= len;
+  *p = reading;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Encode the difference between two points as a record.
+    @param rec Pointer to NMEA_TRACK_MAX_RECORD bytes for the record
+    @param from Pointer to the point before
+    @param to Pointer to the point to encode
+    @return The length of the record in bytes
+*/
+/**************************************************************************/
+uint8_t Adafruit_NMEA_Track::encode(uint8_t *rec,
+                                    const nmea_track_point_t *from,
+                                    const nmea_track_point_t *to) {
+  // differences wrap around like the decoder's sums, so any two points work
+  uint8_t n = putVarint(rec, (int32_t)(to->time - from->time));
+  n += putVarint(rec + n, (int32_t)((uint32_t)to->lat - from->lat));
+  n += putVarint(rec + n, (int32_t)((uint32_t)to->lon - from->lon));
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief Decode a record and apply it to the point before.
+    @param rec Pointer to the record
+    @param len Bytes available at rec
+    @param p Pointer to the point before, which is changed to the new point
+    @return The length of the record in bytes, or 0 if it is cut short, in
+    which case p is unchanged
+*/
+/**************************************************************************/
+uint8_t Adafruit_NMEA_Track::decode(const uint8_t *rec, uint8_t len,
+                                    nmea_track_point_t *p) {
+  int32_t d[3];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint8_t k = getVarint(rec + n, len - n, &d[i]);
+    if (k == 0)
+      return 0;
+    n += k;
+  }
+  p->time += (uint32_t)d[0];
+  p->lat = (int32_t)((uint32_t)p->lat + (uint32_t)d[1]);
+  p->lon = (int32_t)((uint32_t)p->lon + (uint32_t)d[2]);
+  return n;
+}
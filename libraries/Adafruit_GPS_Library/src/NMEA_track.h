@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*!
+  @file NMEA_track.h
+
+  A track recorder that thins out the fixes as they arrive, keeping only the
+  points needed to stay within a set distance of the path actually travelled,
+  and stores each kept point as a few bytes of difference from the one
+  before. The record format is described in NMEA_track.cpp.
+
+  @copyright BSD license, check license.txt for more information
+  All text above must be included in any redistribution
+*/
+/**************************************************************************/
+#ifndef _NMEA_TRACK_H
+#define _NMEA_TRACK_H
+
+#include <Adafruit_GPS.h>
+
+#ifndef NMEA_TRACK_WINDOW
+#define NMEA_TRACK_WINDOW                                                      \
+  32 ///< most points held back while deciding which to keep
+#endif
+#define NMEA_TRACK_MAX_RECORD 15 ///< longest record, three 5 byte varints
+
+/**************************************************************************/
+/*!
+  Struct for one point on a track.
+ **************************************************************************/
+typedef struct {
+  int32_t lat = 0;   ///< latitude in 1/10000000 degree, like latitude_fixed
+  int32_t lon = 0;   ///< longitude in 1/10000000 degree
+  uint32_t time = 0; ///< seconds since 2000-01-01 00:00 UTC
+} nmea_track_point_t;
+
+/**************************************************************************/
+/*!
+    @brief  Records a simplified track in RAM or to a file
+*/
+/**************************************************************************/
+class Adafruit_NMEA_Track {
+public:
+  void begin(uint8_t *buffer, uint16_t size, nmea_float_t tolerance = 5.0);
+  void begin(Print *out, nmea_float_t tolerance = 5.0);
+  bool add(Adafruit_GPS *gps);
+  bool add(int32_t lat, int32_t lon, uint32_t time);
+  void flush(void);
+  void rewind(void);
+  bool next(nmea_track_point_t *p);
+
+  static uint8_t encode(uint8_t *rec, const nmea_track_point_t *from,
+                        const nmea_track_point_t *to);
+  static uint8_t decode(const uint8_t *rec, uint8_t len,
+                        nmea_track_point_t *p);
+
+  uint32_t points = 0;      ///< points added
+  uint32_t kept = 0;        ///< points written out
+  uint32_t bytes = 0;       ///< bytes written out
+  uint32_t overwritten = 0; ///< points lost off the start of the RAM buffer
+
+private:
+  bool fits(const nmea_track_point_t *p);
+  void keep(const nmea_track_point_t *p);
+  void dropOldest(void);
+  uint8_t copyOut(uint16_t pos, uint8_t *rec);
+
+  nmea_track_point_t window[NMEA_TRACK_WINDOW]; ///< last kept point, then
+                                                ///< the ones held back
+  uint8_t nWindow = 0;      ///< points in window
+  nmea_float_t tolerance2;  ///< squared tolerance in 1/10000000 degree
+  nmea_float_t lonScale;    ///< east-west size of a degree at window[0]
+  nmea_track_point_t last;  ///< last point written, the base for the next
+  nmea_track_point_t first; ///< the base for the oldest record in RAM
+  nmea_track_point_t reading; ///< where next() has got to
+  uint8_t *buffer = NULL;     ///< RAM for the records, or NULL
+  uint16_t size = 0;          ///< bytes in buffer
+  uint16_t tail = 0;          ///< index in buffer of the oldest record
+  uint16_t used = 0;          ///< bytes of buffer holding records
+  uint16_t readPos = 0;       ///< index in buffer of the next to read
+  uint16_t readLeft = 0;      ///< bytes left for next() to read
+  Print *out = NULL;          ///< where to write the records, or NULL
+};
+
+#endif // _NMEA_TRACK_H
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+
+# Decodes a track file written by Adafruit_NMEA_Track (see NMEA_track.cpp for
+# a description of the records) to CSV or GPX on stdout, and prints how many
+# points there were and how much space the encoding saved on stderr.
+#
+# Usage: trackdecode.py [--gpx] [--points N] <track-file> > out.csv
+#
+# --points is the number of fixes that were added while recording, which the
+# sketch can print from the track's points count. With it, the savings are
+# also given against storing every fix.
+
+import argparse
+import datetime
+import sys
+
+EPOCH = datetime.datetime(2000, 1, 1)
+RAW_BYTES = 12  # two int32 coordinates and a uint32 time
+
+
+def varints(data):
+    value = shift = 0
+    for b in data:
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            yield (value >> 1) ^ -(value & 1)  # undo the zig-zag
+            value = shift = 0
+    if shift:
+        sys.stderr.write("trackdecode: last record is cut short\n")
+
+
+def wrap32(v):
+    return (v + 0x80000000) % 0x100000000 - 0x80000000
+
+
+def decode(data):
+    points = []
+    time = lat = lon = 0
+    values = varints(data)
+    for dt in values:
+        try:
+            dlat = next(values)
+            dlon = next(values)
+        except StopIteration:
+            sys.stderr.write("trackdecode: last record is cut short\n")
+            break
+        time = (time + dt) % 0x100000000
+        lat = wrap32(lat + dlat)
+        lon = wrap32(lon + dlon)
+        points.append((EPOCH + datetime.timedelta(seconds=time),
+                       lat / 1e7, lon / 1e7))
+    return points
+
+
+def write_csv(points):
+    print("time,latitude,longitude")
+    for t, lat, lon in points:
+        print("%s,%.7f,%.7f" % (t.isoformat() + "Z", lat, lon))
+
+
+def write_gpx(points):
+    print('<?xml version="1.0" encoding="UTF-8"?>')
+    print('<gpx version="1.1" creator="trackdecode.py" '
+          'xmlns="http://www.topografix.com/GPX/1/1">')
+    print("<trk><trkseg>")
+    for t, lat, lon in points:
+        print('<trkpt lat="%.7f" lon="%.7f"><time>%sZ</time></trkpt>' %
+              (lat, lon, t.isoformat()))
+    print("</trkseg></trk>")
+    print("</gpx>")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a track file")
+    parser.add_argument("--gpx", action="store_true", help="write GPX")
+    parser.add_argument("--points", type=int,
+                        help="fixes added while recording")
+    parser.add_argument("file")
+    args = parser.parse_args()
+
+    data = open(args.file, "rb").read()
+    points = decode(data)
+    if args.gpx:
+        write_gpx(points)
+    else:
+        write_csv(points)
+
+    if points:
+        sys.stderr.write("%d points in %d bytes, %.2f bytes each, %.1fx "
+                         "smaller than raw\n" %
+                         (len(points), len(data), len(data) / len(points),
+                          RAW_BYTES * len(points) / len(data)))
+    if points and args.points:
+        sys.stderr.write("%d fixes recorded, %.1fx smaller than storing "
+                         "every one\n" %
+                         (args.points, RAW_BYTES * args.points / len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,332 @@
+// Generated by rleconvert.py (Adafruit_GFX rleconvert folder) from dragon.h
+// 110x70 pixels, 119 colors. 15400 bytes as raw RGB565, 3937 bytes RLE (25.6%)
+
+const uint8_t dragonRLEData[] PROGMEM = {
+    0xED, 0x76, 0xED, 0x76, 0xED, 0x76, 0xAA, 0x76, 0x00, 0x45, 0x9B, 0x76,
+    0x01, 0x6A, 0x61, 0xA3, 0x76, 0xA7, 0x76, 0x03, 0x74, 0x66, 0x57, 0x5E,
+    0x99, 0x76, 0x03, 0x70, 0x51, 0x47, 0x74, 0x8F, 0x76, 0x00, 0x75, 0x92,
+    0x76, 0xA4, 0x76, 0x06, 0x74, 0x65, 0x56, 0x68, 0x6D, 0x6D, 0x5E, 0x97,
+    0x76, 0x04, 0x75, 0x60, 0x4E, 0x5B, 0x5F, 0x8D, 0x76, 0x03, 0x75, 0x61,
+    0x33, 0x74, 0x92, 0x76, 0x9A, 0x76, 0x01, 0x70, 0x60, 0x82, 0x5E, 0x00,
+    0x59, 0x82, 0x66, 0x08, 0x5A, 0x5D, 0x72, 0x68, 0x2E, 0x5B, 0x72, 0x5E,
+    0x71, 0x95, 0x76, 0x05, 0x67, 0x5D, 0x4E, 0x6D, 0x72, 0x67, 0x8B, 0x76,
+    0x03, 0x71, 0x3F, 0x3A, 0x60, 0x94, 0x76, 0x99, 0x76, 0x01, 0x66, 0x6D,
+    0x87, 0x72, 0x07, 0x4E, 0x72, 0x68, 0x4E, 0x6D, 0x72, 0x69, 0x67, 0x94,
+    0x76, 0x03, 0x73, 0x57, 0x68, 0x4E, 0x82, 0x72, 0x00, 0x6C, 0x88, 0x76,
+    0x05, 0x75, 0x62, 0x32, 0x4E, 0x6D, 0x6E, 0x95, 0x76, 0x94, 0x76, 0x08,
+    0x74, 0x6C, 0x6A, 0x5A, 0x66, 0x63, 0x72, 0x6D, 0x4E, 0x84, 0x72, 0x07,
+    0x6D, 0x72, 0x5B, 0x68, 0x72, 0x72, 0x64, 0x74, 0x93, 0x76, 0x04, 0x75,
+    0x65, 0x68, 0x5B, 0x68, 0x83, 0x72, 0x00, 0x6A, 0x86, 0x76, 0x06, 0x71,
+    0x4D, 0x34, 0x5B, 0x72, 0x6D, 0x6E, 0x96, 0x76, 0x91, 0x76, 0x03, 0x74,
+    0x60, 0x55, 0x68, 0x82, 0x72, 0x06, 0x4E, 0x72, 0x68, 0x34, 0x1A, 0x0F,
+    0x41, 0x82, 0x4E, 0x81, 0x72, 0x04, 0x5B, 0x4E, 0x72, 0x68, 0x74, 0x93,
+    0x76, 0x04, 0x70, 0x63, 0x6D, 0x5B, 0x68, 0x84, 0x72, 0x00, 0x5E, 0x83,
+    0x76, 0x08, 0x75, 0x67, 0x42, 0x47, 0x68, 0x72, 0x72, 0x6D, 0x6E, 0x8D,
+    0x76, 0x00, 0x37, 0x88, 0x76, 0x88, 0x76, 0x01, 0x62, 0x74, 0x85, 0x76,
+    0x01, 0x66, 0x68, 0x83, 0x72, 0x02, 0x6D, 0x5B, 0x4E, 0x82, 0x72, 0x02,
+    0x5E, 0x51, 0x6D, 0x83, 0x72, 0x05, 0x6D, 0x47, 0x4E, 0x4E, 0x47, 0x70,
+    0x91, 0x76, 0x04, 0x75, 0x65, 0x6D, 0x68, 0x5B, 0x87, 0x72, 0x06, 0x5F,
+    0x6B, 0x62, 0x5F, 0x38, 0x4E, 0x68, 0x83, 0x72, 0x00, 0x66, 0x8D, 0x76,
+    0x01, 0x65, 0x5E, 0x88, 0x76, 0x88, 0x76, 0x03, 0x6B, 0x69, 0x66, 0x75,
+    0x82, 0x76, 0x0C, 0x58, 0x4E, 0x4E, 0x5E, 0x5E, 0x4B, 0x68, 0x47, 0x72,
+    0x5B, 0x72, 0x6D, 0x6D, 0x87, 0x72, 0x00, 0x4E, 0x82, 0x72, 0x00, 0x5E,
+    0x90, 0x76, 0x04, 0x73, 0x63, 0x72, 0x5B, 0x68, 0x87, 0x72, 0x05, 0x5B,
+    0x4E, 0x4E, 0x5B, 0x4E, 0x6D, 0x84, 0x72, 0x00, 0x56, 0x8D, 0x76, 0x02,
+    0x6E, 0x6D, 0x5E, 0x88, 0x76, 0x89, 0x76, 0x06, 0x5E, 0x72, 0x5B, 0x60,
+    0x6B, 0x75, 0x71, 0x84, 0x76, 0x08, 0x74, 0x64, 0x72, 0x72, 0x4E, 0x3D,
+    0x6C, 0x67, 0x63, 0x85, 0x72, 0x01, 0x5B, 0x4E, 0x82, 0x72, 0x01, 0x5E,
+    0x6A, 0x8D, 0x76, 0x04, 0x66, 0x68, 0x72, 0x4E, 0x6D, 0x85, 0x72, 0x06,
+    0x6D, 0x4E, 0x4E, 0x6D, 0x5B, 0x4E, 0x6D, 0x86, 0x72, 0x00, 0x65, 0x8C,
+    0x76, 0x03, 0x6F, 0x6D, 0x72, 0x5E, 0x88, 0x76, 0x89, 0x76, 0x01, 0x73,
+    0x68, 0x82, 0x72, 0x02, 0x5B, 0x4B, 0x53, 0x84, 0x76, 0x08, 0x70, 0x3A,
+    0x21, 0x27, 0x74, 0x76, 0x76, 0x71, 0x55, 0x84, 0x72, 0x01, 0x47, 0x68,
+    0x84, 0x72, 0x00, 0x60, 0x8A, 0x76, 0x04, 0x75, 0x5E, 0x72, 0x6D, 0x4E,
+    0x85, 0x72, 0x06, 0x5B, 0x4E, 0x5B, 0x72, 0x4E, 0x4E, 0x6D, 0x88, 0x72,
+    0x00, 0x60, 0x8B, 0x76, 0x04, 0x73, 0x69, 0x72, 0x72, 0x5E, 0x88, 0x76,
+    0x8A, 0x76, 0x05, 0x6E, 0x6D, 0x72, 0x68, 0x38, 0x3E, 0x85, 0x6C, 0x09,
+    0x61, 0x59, 0x4C, 0x60, 0x5E, 0x57, 0x4E, 0x68, 0x5B, 0x6D, 0x84, 0x72,
+    0x00, 0x4E, 0x82, 0x72, 0x02, 0x64, 0x6A, 0x54, 0x89, 0x76, 0x04, 0x70,
+    0x5D, 0x72, 0x6D, 0x5B, 0x83, 0x72, 0x06, 0x6D, 0x4E, 0x4E, 0x6D, 0x72,
+    0x4E, 0x4E, 0x8B, 0x72, 0x01, 0x6D, 0x6E, 0x89, 0x76, 0x01, 0x73, 0x69,
+    0x82, 0x72, 0x00, 0x5E, 0x88, 0x76, 0x8B, 0x76, 0x03, 0x65, 0x72, 0x5B,
+    0x6D, 0x8A, 0x72, 0x05, 0x6D, 0x5B, 0x38, 0x1D, 0x47, 0x47, 0x83, 0x72,
+    0x01, 0x38, 0x4E, 0x82, 0x72, 0x01, 0x5E, 0x70, 0x89, 0x76, 0x04, 0x67,
+    0x6D, 0x72, 0x6D, 0x5B, 0x82, 0x72, 0x06, 0x5B, 0x4E, 0x5B, 0x72, 0x6D,
+    0x4E, 0x4E, 0x8D, 0x72, 0x03, 0x4E, 0x47, 0x18, 0x71, 0x86, 0x76, 0x06,
+    0x73, 0x69, 0x72, 0x72, 0x6D, 0x72, 0x5E, 0x88, 0x76, 0x8C, 0x76, 0x02,
+    0x66, 0x6D, 0x49, 0x83, 0x5E, 0x00, 0x50, 0x82, 0x4E, 0x81, 0x28, 0x0C,
+    0x21, 0x1D, 0x2E, 0x47, 0x6D, 0x4E, 0x2E, 0x6D, 0x68, 0x72, 0x2E, 0x38,
+    0x6D, 0x83, 0x72, 0x01, 0x6D, 0x66, 0x86, 0x76, 0x0E, 0x75, 0x60, 0x72,
+    0x72, 0x6D, 0x5B, 0x72, 0x72, 0x4E, 0x47, 0x6D, 0x72, 0x6D, 0x4E, 0x5B,
+    0x88, 0x72, 0x00, 0x68, 0x82, 0x4E, 0x05, 0x47, 0x28, 0x28, 0x38, 0x36,
+    0x71, 0x86, 0x76, 0x07, 0x73, 0x69, 0x72, 0x4E, 0x6D, 0x4E, 0x72, 0x5E,
+    0x88, 0x76, 0x8D, 0x76, 0x02, 0x6E, 0x5D, 0x70, 0x86, 0x76, 0x00, 0x56,
+    0x83, 0x72, 0x09, 0x63, 0x6A, 0x51, 0x72, 0x4E, 0x4E, 0x28, 0x72, 0x6D,
+    0x6D, 0x82, 0x72, 0x03, 0x5B, 0x6D, 0x5B, 0x75, 0x84, 0x76, 0x01, 0x75,
+    0x64, 0x82, 0x72, 0x08, 0x4E, 0x6D, 0x4E, 0x4E, 0x72, 0x72, 0x6D, 0x4E,
+    0x5B, 0x84, 0x72, 0x00, 0x6D, 0x88, 0x4E, 0x03, 0x5B, 0x72, 0x57, 0x73,
+    0x87, 0x76, 0x08, 0x73, 0x69, 0x72, 0x72, 0x4E, 0x72, 0x4E, 0x72, 0x5E,
+    0x88, 0x76, 0x8E, 0x76, 0x01, 0x74, 0x70, 0x86, 0x76, 0x0B, 0x5E, 0x72,
+    0x6D, 0x72, 0x5F, 0x75, 0x76, 0x4D, 0x68, 0x68, 0x6D, 0x2E, 0x84, 0x72,
+    0x04, 0x63, 0x75, 0x6A, 0x56, 0x6C, 0x84, 0x76, 0x00, 0x5E, 0x82, 0x72,
+    0x0A, 0x38, 0x4E, 0x5B, 0x72, 0x72, 0x6D, 0x4E, 0x5B, 0x72, 0x72, 0x5B,
+    0x83, 0x4E, 0x02, 0x5B, 0x72, 0x68, 0x82, 0x4E, 0x00, 0x68, 0x83, 0x72,
+    0x00, 0x60, 0x88, 0x76, 0x09, 0x73, 0x69, 0x72, 0x72, 0x6D, 0x5B, 0x72,
+    0x4E, 0x72, 0x55, 0x88, 0x76, 0x8B, 0x76, 0x02, 0x45, 0x66, 0x75, 0x88,
+    0x76, 0x0B, 0x6A, 0x72, 0x57, 0x3A, 0x75, 0x76, 0x66, 0x72, 0x68, 0x4E,
+    0x38, 0x4E, 0x84, 0x72, 0x00, 0x5E, 0x87, 0x76, 0x00, 0x6A, 0x82, 0x72,
+    0x04, 0x5B, 0x68, 0x72, 0x72, 0x6D, 0x82, 0x4E, 0x06, 0x47, 0x4E, 0x4E,
+    0x6D, 0x72, 0x72, 0x68, 0x82, 0x4E, 0x00, 0x68, 0x86, 0x72, 0x00, 0x60,
+    0x88, 0x76, 0x01, 0x73, 0x69, 0x82, 0x72, 0x05, 0x4E, 0x72, 0x72, 0x4E,
+    0x72, 0x4E, 0x88, 0x76, 0x8B, 0x76, 0x02, 0x75, 0x63, 0x57, 0x88, 0x76,
+    0x06, 0x6C, 0x72, 0x6A, 0x75, 0x76, 0x76, 0x56, 0x82, 0x72, 0x81, 0x4E,
+    0x84, 0x72, 0x02, 0x6D, 0x66, 0x75, 0x85, 0x76, 0x00, 0x5E, 0x82, 0x72,
+    0x06, 0x4E, 0x72, 0x72, 0x6D, 0x2E, 0x4E, 0x5B, 0x82, 0x72, 0x00, 0x6D,
+    0x82, 0x4E, 0x00, 0x68, 0x89, 0x72, 0x00, 0x5F, 0x89, 0x76, 0x00, 0x58,
+    0x82, 0x5E, 0x07, 0x60, 0x47, 0x72, 0x5B, 0x4E, 0x72, 0x72, 0x6C, 0x87,
+    0x76, 0x86, 0x76, 0x02, 0x75, 0x6C, 0x74, 0x82, 0x76, 0x04, 0x66, 0x68,
+    0x61, 0x76, 0x75, 0x85, 0x76, 0x0B, 0x75, 0x41, 0x75, 0x76, 0x76, 0x75,
+    0x47, 0x72, 0x72, 0x68, 0x68, 0x4E, 0x86, 0x72, 0x01, 0x55, 0x75, 0x84,
+    0x76, 0x03, 0x4E, 0x72, 0x72, 0x4E, 0x86, 0x72, 0x82, 0x4E, 0x00, 0x5B,
+    0x8C, 0x72, 0x01, 0x5D, 0x75, 0x8D, 0x76, 0x07, 0x70, 0x6D, 0x72, 0x57,
+    0x66, 0x72, 0x72, 0x67, 0x87, 0x76, 0x86, 0x76, 0x0B, 0x75, 0x60, 0x68,
+    0x65, 0x76, 0x76, 0x52, 0x68, 0x56, 0x76, 0x52, 0x6F, 0x89, 0x76, 0x06,
+    0x5E, 0x68, 0x4E, 0x4E, 0x38, 0x47, 0x38, 0x84, 0x72, 0x03, 0x57, 0x49,
+    0x72, 0x65, 0x84, 0x76, 0x03, 0x4E, 0x72, 0x72, 0x4E, 0x83, 0x72, 0x82,
+    0x4E, 0x90, 0x72, 0x00, 0x60, 0x85, 0x76, 0x10, 0x74, 0x65, 0x5E, 0x4E,
+    0x4E, 0x57, 0x60, 0x6B, 0x76, 0x5E, 0x72, 0x72, 0x67, 0x76, 0x60, 0x6D,
+    0x5F, 0x87, 0x76, 0x88, 0x76, 0x09, 0x41, 0x4E, 0x51, 0x76, 0x4E, 0x72,
+    0x56, 0x75, 0x5D, 0x66, 0x88, 0x76, 0x01, 0x71, 0x6D, 0x82, 0x72, 0x02,
+    0x47, 0x2E, 0x38, 0x83, 0x72, 0x04, 0x4E, 0x76, 0x76, 0x6A, 0x4C, 0x84,
+    0x76, 0x07, 0x4E, 0x72, 0x68, 0x68, 0x72, 0x72, 0x38, 0x28, 0x83, 0x4E,
+    0x8F, 0x72, 0x00, 0x6B, 0x84, 0x76, 0x01, 0x66, 0x68, 0x86, 0x72, 0x09,
+    0x4B, 0x5B, 0x72, 0x6D, 0x71, 0x76, 0x76, 0x6F, 0x35, 0x75, 0x86, 0x76,
+    0x88, 0x76, 0x09, 0x4E, 0x72, 0x6D, 0x54, 0x6D, 0x72, 0x43, 0x41, 0x72,
+    0x6A, 0x88, 0x76, 0x01, 0x62, 0x6D, 0x82, 0x72, 0x81, 0x4E, 0x00, 0x38,
+    0x83, 0x72, 0x01, 0x68, 0x74, 0x87, 0x76, 0x02, 0x4E, 0x72, 0x4E, 0x88,
+    0x72, 0x86, 0x4E, 0x00, 0x6D, 0x87, 0x72, 0x00, 0x6C, 0x83, 0x76, 0x00,
+    0x67, 0x89, 0x72, 0x02, 0x6D, 0x5B, 0x56, 0x8C, 0x76, 0x88, 0x76, 0x09,
+    0x5E, 0x72, 0x72, 0x32, 0x72, 0x72, 0x47, 0x72, 0x4E, 0x6C, 0x87, 0x76,
+    0x09, 0x73, 0x68, 0x5B, 0x5B, 0x72, 0x72, 0x2E, 0x4E, 0x47, 0x5B, 0x83,
+    0x72, 0x01, 0x5D, 0x67, 0x86, 0x76, 0x02, 0x4E, 0x68, 0x68, 0x82, 0x72,
+    0x87, 0x4E, 0x84, 0x72, 0x00, 0x5B, 0x83, 0x4E, 0x83, 0x72, 0x00, 0x6C,
+    0x83, 0x76, 0x00, 0x55, 0x82, 0x72, 0x03, 0x5B, 0x3A, 0x4E, 0x6D, 0x83,
+    0x72, 0x01, 0x6D, 0x44, 0x8C, 0x76, 0x88, 0x76, 0x09, 0x67, 0x72, 0x72,
+    0x4E, 0x5B, 0x5B, 0x6D, 0x72, 0x5D, 0x75, 0x87, 0x76, 0x09, 0x5F, 0x72,
+    0x72, 0x6D, 0x4E, 0x38, 0x5B, 0x47, 0x6D, 0x38, 0x85, 0x72, 0x00, 0x51,
+    0x84, 0x76, 0x02, 0x75, 0x5B, 0x4E, 0x83, 0x72, 0x81, 0x4E, 0x00, 0x6D,
+    0x83, 0x72, 0x00, 0x6D, 0x87, 0x4E, 0x81, 0x72, 0x82, 0x4E, 0x01, 0x6D,
+    0x60, 0x83, 0x76, 0x08, 0x4E, 0x72, 0x72, 0x49, 0x71, 0x76, 0x76, 0x53,
+    0x4E, 0x83, 0x72, 0x00, 0x60, 0x8C, 0x76, 0x88, 0x76, 0x08, 0x75, 0x55,
+    0x72, 0x72, 0x68, 0x4E, 0x72, 0x64, 0x73, 0x88, 0x76, 0x00, 0x5E, 0x83,
+    0x72, 0x04, 0x4E, 0x2E, 0x5B, 0x47, 0x47, 0x83, 0x72, 0x02, 0x64, 0x66,
+    0x3E, 0x84, 0x76, 0x02, 0x6A, 0x5B, 0x6D, 0x85, 0x72, 0x02, 0x5B, 0x4E,
+    0x6D, 0x8A, 0x72, 0x84, 0x4E, 0x02, 0x2E, 0x38, 0x74, 0x82, 0x76, 0x03,
+    0x4E, 0x72, 0x72, 0x58, 0x83, 0x76, 0x01, 0x33, 0x68, 0x82, 0x72, 0x00,
+    0x4E, 0x8C, 0x76, 0x89, 0x76, 0x06, 0x75, 0x5E, 0x72, 0x72, 0x68, 0x49,
+    0x75, 0x88, 0x76, 0x02, 0x6E, 0x47, 0x6D, 0x82, 0x72, 0x05, 0x4E, 0x38,
+    0x6D, 0x38, 0x47, 0x6D, 0x82, 0x72, 0x00, 0x6C, 0x85, 0x76, 0x02, 0x75,
+    0x2B, 0x6D, 0x82, 0x72, 0x01, 0x47, 0x68, 0x83, 0x72, 0x01, 0x5B, 0x4E,
+    0x8C, 0x72, 0x04, 0x5D, 0x5F, 0x66, 0x40, 0x46, 0x82, 0x76, 0x09, 0x5F,
+    0x72, 0x72, 0x5B, 0x58, 0x66, 0x66, 0x41, 0x6D, 0x4E, 0x82, 0x72, 0x01,
+    0x6D, 0x71, 0x8B, 0x76, 0x8A, 0x76, 0x00, 0x66, 0x82, 0x72, 0x01, 0x69,
+    0x74, 0x88, 0x76, 0x02, 0x55, 0x72, 0x5B, 0x82, 0x4E, 0x81, 0x47, 0x03,
+    0x5B, 0x4E, 0x5B, 0x4E, 0x82, 0x72, 0x07, 0x65, 0x76, 0x75, 0x6C, 0x66,
+    0x5F, 0x56, 0x5B, 0x82, 0x72, 0x06, 0x6D, 0x72, 0x68, 0x47, 0x4E, 0x4E,
+    0x6D, 0x82, 0x72, 0x01, 0x4E, 0x68, 0x88, 0x72, 0x02, 0x69, 0x67, 0x75,
+    0x86, 0x76, 0x01, 0x73, 0x69, 0x86, 0x72, 0x00, 0x4E, 0x83, 0x72, 0x00,
+    0x6C, 0x8B, 0x76, 0x8A, 0x76, 0x00, 0x5F, 0x83, 0x72, 0x00, 0x65, 0x87,
+    0x76, 0x01, 0x74, 0x68, 0x84, 0x72, 0x0B, 0x38, 0x4E, 0x68, 0x38, 0x6D,
+    0x28, 0x72, 0x72, 0x4E, 0x55, 0x50, 0x5B, 0x87, 0x72, 0x0D, 0x38, 0x68,
+    0x72, 0x6D, 0x5B, 0x72, 0x5B, 0x4E, 0x4E, 0x72, 0x72, 0x68, 0x4E, 0x6D,
+    0x85, 0x72, 0x01, 0x64, 0x74, 0x89, 0x76, 0x08, 0x74, 0x60, 0x4E, 0x6D,
+    0x72, 0x6D, 0x4E, 0x42, 0x5B, 0x82, 0x72, 0x01, 0x5B, 0x75, 0x8B, 0x76,
+    0x8A, 0x76, 0x00, 0x5E, 0x83, 0x72, 0x00, 0x56, 0x87, 0x76, 0x00, 0x6C,
+    0x85, 0x72, 0x07, 0x2E, 0x6D, 0x28, 0x72, 0x2E, 0x6D, 0x47, 0x4E, 0x89,
+    0x72, 0x07, 0x5B, 0x72, 0x4E, 0x68, 0x68, 0x72, 0x6D, 0x5B, 0x82, 0x72,
+    0x81, 0x4E, 0x03, 0x6D, 0x72, 0x5B, 0x5B, 0x83, 0x72, 0x01, 0x5B, 0x53,
+    0x83, 0x6C, 0x89, 0x76, 0x04, 0x71, 0x6C, 0x71, 0x75, 0x5F, 0x83, 0x72,
+    0x00, 0x57, 0x8C, 0x76, 0x8A, 0x76, 0x00, 0x56, 0x83, 0x72, 0x01, 0x68,
+    0x74, 0x86, 0x76, 0x01, 0x6F, 0x38, 0x84, 0x72, 0x13, 0x28, 0x47, 0x4E,
+    0x5B, 0x5B, 0x47, 0x68, 0x72, 0x72, 0x68, 0x4E, 0x38, 0x6D, 0x72, 0x72,
+    0x68, 0x72, 0x5B, 0x47, 0x72, 0x82, 0x68, 0x03, 0x5B, 0x72, 0x68, 0x68,
+    0x83, 0x72, 0x04, 0x5B, 0x4E, 0x68, 0x6D, 0x4E, 0x82, 0x72, 0x00, 0x4E,
+    0x84, 0x72, 0x81, 0x4E, 0x03, 0x57, 0x60, 0x6A, 0x71, 0x84, 0x76, 0x02,
+    0x71, 0x67, 0x63, 0x84, 0x72, 0x00, 0x6A, 0x8C, 0x76, 0x8A, 0x76, 0x00,
+    0x4E, 0x84, 0x72, 0x00, 0x6C, 0x86, 0x76, 0x01, 0x56, 0x72, 0x87, 0x4E,
+    0x18, 0x2E, 0x4E, 0x72, 0x72, 0x5B, 0x4E, 0x68, 0x72, 0x4E, 0x72, 0x6D,
+    0x2E, 0x72, 0x72, 0x4E, 0x6D, 0x5B, 0x72, 0x4E, 0x72, 0x6D, 0x5B, 0x72,
+    0x5B, 0x6D, 0x84, 0x72, 0x05, 0x6D, 0x4E, 0x47, 0x4E, 0x6D, 0x4E, 0x8A,
+    0x72, 0x00, 0x6D, 0x84, 0x4E, 0x00, 0x68, 0x85, 0x72, 0x00, 0x57, 0x8D,
+    0x76, 0x89, 0x76, 0x02, 0x6E, 0x6D, 0x5B, 0x83, 0x72, 0x00, 0x62, 0x86,
+    0x76, 0x00, 0x4E, 0x85, 0x72, 0x1B, 0x47, 0x38, 0x4E, 0x5B, 0x72, 0x5B,
+    0x4E, 0x6D, 0x72, 0x72, 0x5B, 0x6D, 0x6D, 0x5B, 0x4E, 0x72, 0x5B, 0x6D,
+    0x72, 0x4E, 0x72, 0x4E, 0x72, 0x72, 0x68, 0x68, 0x72, 0x4E, 0x87, 0x72,
+    0x02, 0x4E, 0x38, 0x38, 0x83, 0x72, 0x01, 0x4E, 0x5B, 0x90, 0x72, 0x01,
+    0x69, 0x74, 0x8D, 0x76, 0x88, 0x04, 0x09, 0x02, 0x68, 0x72, 0x14, 0x6D,
+    0x72, 0x72, 0x4E, 0x68, 0x12, 0x85, 0x04, 0x00, 0x4E, 0x85, 0x72, 0x05,
+    0x28, 0x4E, 0x5B, 0x68, 0x4E, 0x6D, 0x83, 0x72, 0x0B, 0x4E, 0x6D, 0x5B,
+    0x72, 0x4E, 0x72, 0x4E, 0x72, 0x72, 0x5B, 0x6D, 0x4E, 0x82, 0x72, 0x03,
+    0x6D, 0x5B, 0x68, 0x68, 0x87, 0x72, 0x02, 0x6D, 0x38, 0x38, 0x84, 0x72,
+    0x01, 0x4E, 0x6D, 0x8D, 0x72, 0x01, 0x3C, 0x08, 0x8E, 0x04, 0x87, 0x04,
+    0x0A, 0x03, 0x3C, 0x72, 0x4A, 0x03, 0x3B, 0x72, 0x72, 0x4E, 0x72, 0x4E,
+    0x85, 0x04, 0x00, 0x3B, 0x85, 0x72, 0x03, 0x38, 0x68, 0x4E, 0x68, 0x84,
+    0x72, 0x07, 0x5B, 0x6D, 0x4E, 0x72, 0x72, 0x4E, 0x6D, 0x5B, 0x82, 0x72,
+    0x81, 0x4E, 0x83, 0x72, 0x02, 0x6D, 0x5B, 0x4E, 0x84, 0x72, 0x05, 0x5B,
+    0x4E, 0x4E, 0x2E, 0x4E, 0x5B, 0x85, 0x72, 0x01, 0x5B, 0x6D, 0x8A, 0x72,
+    0x02, 0x6D, 0x26, 0x03, 0x8F, 0x04, 0x87, 0x04, 0x0C, 0x12, 0x68, 0x72,
+    0x12, 0x04, 0x0D, 0x72, 0x72, 0x68, 0x68, 0x4E, 0x2D, 0x0D, 0x83, 0x04,
+    0x01, 0x07, 0x4E, 0x83, 0x72, 0x02, 0x47, 0x38, 0x4E, 0x86, 0x72, 0x81,
+    0x4E, 0x82, 0x72, 0x81, 0x4E, 0x83, 0x72, 0x81, 0x4E, 0x84, 0x72, 0x0A,
+    0x68, 0x5B, 0x5B, 0x72, 0x72, 0x5B, 0x4E, 0x6D, 0x72, 0x72, 0x4E, 0x88,
+    0x72, 0x01, 0x5B, 0x6D, 0x88, 0x72, 0x01, 0x3B, 0x07, 0x91, 0x04, 0x87,
+    0x04, 0x12, 0x0D, 0x6D, 0x38, 0x02, 0x04, 0x04, 0x3B, 0x72, 0x72, 0x4E,
+    0x5B, 0x72, 0x72, 0x0B, 0x00, 0x04, 0x04, 0x1C, 0x6D, 0x83, 0x4E, 0x05,
+    0x38, 0x5B, 0x72, 0x72, 0x6D, 0x5B, 0x83, 0x72, 0x01, 0x2E, 0x6D, 0x82,
+    0x72, 0x81, 0x4E, 0x83, 0x72, 0x81, 0x5B, 0x00, 0x68, 0x84, 0x72, 0x04,
+    0x68, 0x38, 0x72, 0x5B, 0x6D, 0x83, 0x72, 0x01, 0x6D, 0x5B, 0x88, 0x72,
+    0x00, 0x4E, 0x85, 0x72, 0x02, 0x5B, 0x26, 0x06, 0x93, 0x04, 0x85, 0x04,
+    0x04, 0x03, 0x16, 0x4F, 0x31, 0x02, 0x82, 0x04, 0x0B, 0x0E, 0x6D, 0x72,
+    0x72, 0x4E, 0x72, 0x72, 0x4E, 0x72, 0x31, 0x1E, 0x39, 0x84, 0x72, 0x05,
+    0x4E, 0x2E, 0x4E, 0x4E, 0x68, 0x4E, 0x82, 0x72, 0x01, 0x38, 0x5B, 0x83,
+    0x72, 0x01, 0x47, 0x5B, 0x84, 0x72, 0x81, 0x4E, 0x85, 0x72, 0x02, 0x4E,
+    0x38, 0x6D, 0x85, 0x72, 0x01, 0x5B, 0x6D, 0x88, 0x72, 0x06, 0x47, 0x5B,
+    0x4E, 0x2D, 0x1C, 0x0D, 0x03, 0x95, 0x04, 0x86, 0x04, 0x81, 0x01, 0x85,
+    0x04, 0x00, 0x20, 0x82, 0x72, 0x81, 0x4E, 0x04, 0x6D, 0x72, 0x72, 0x4E,
+    0x4E, 0x85, 0x72, 0x00, 0x4E, 0x82, 0x72, 0x04, 0x4E, 0x72, 0x68, 0x4E,
+    0x1D, 0x84, 0x72, 0x00, 0x28, 0x85, 0x72, 0x81, 0x4E, 0x03, 0x72, 0x6D,
+    0x4E, 0x38, 0x82, 0x4E, 0x00, 0x38, 0x87, 0x72, 0x01, 0x5B, 0x4E, 0x88,
+    0x72, 0x02, 0x5C, 0x17, 0x03, 0x98, 0x04, 0x8F, 0x04, 0x00, 0x20, 0x82,
+    0x72, 0x05, 0x5B, 0x4E, 0x68, 0x72, 0x4E, 0x4E, 0x84, 0x72, 0x00, 0x4E,
+    0x83, 0x72, 0x04, 0x4E, 0x5B, 0x68, 0x72, 0x38, 0x84, 0x72, 0x0C, 0x28,
+    0x72, 0x47, 0x4E, 0x47, 0x4E, 0x68, 0x4E, 0x4E, 0x68, 0x5B, 0x72, 0x4E,
+    0x82, 0x72, 0x01, 0x5B, 0x68, 0x86, 0x72, 0x05, 0x6D, 0x4E, 0x5B, 0x4E,
+    0x47, 0x5B, 0x86, 0x72, 0x01, 0x4F, 0x17, 0x97, 0x04, 0x90, 0x04, 0x01,
+    0x17, 0x6D, 0x82, 0x72, 0x04, 0x68, 0x4E, 0x38, 0x4E, 0x38, 0x83, 0x72,
+    0x00, 0x4E, 0x83, 0x72, 0x14, 0x4E, 0x6D, 0x5B, 0x4E, 0x4E, 0x5B, 0x4E,
+    0x47, 0x4E, 0x72, 0x28, 0x4E, 0x6D, 0x5B, 0x72, 0x72, 0x68, 0x38, 0x2E,
+    0x68, 0x72, 0x84, 0x4E, 0x01, 0x5B, 0x68, 0x82, 0x4E, 0x00, 0x5B, 0x82,
+    0x72, 0x09, 0x47, 0x72, 0x72, 0x6D, 0x5B, 0x6D, 0x4E, 0x4E, 0x47, 0x4E,
+    0x84, 0x72, 0x01, 0x3B, 0x0E, 0x95, 0x04, 0x91, 0x04, 0x00, 0x1C, 0x86,
+    0x72, 0x00, 0x4E, 0x83, 0x72, 0x81, 0x68, 0x83, 0x72, 0x0C, 0x47, 0x2E,
+    0x72, 0x38, 0x47, 0x72, 0x72, 0x47, 0x4E, 0x28, 0x72, 0x72, 0x4E, 0x82,
+    0x72, 0x05, 0x4E, 0x72, 0x72, 0x68, 0x5B, 0x4E, 0x86, 0x72, 0x04, 0x2D,
+    0x02, 0x20, 0x39, 0x5B, 0x82, 0x72, 0x00, 0x4E, 0x82, 0x72, 0x0B, 0x4E,
+    0x72, 0x72, 0x4E, 0x38, 0x4E, 0x6D, 0x72, 0x72, 0x6D, 0x2D, 0x08, 0x93,
+    0x04, 0x92, 0x04, 0x00, 0x20, 0x85, 0x72, 0x00, 0x4E, 0x83, 0x72, 0x12,
+    0x5B, 0x47, 0x68, 0x5B, 0x4E, 0x47, 0x4E, 0x68, 0x47, 0x6D, 0x4E, 0x72,
+    0x72, 0x4E, 0x72, 0x5B, 0x72, 0x72, 0x4E, 0x82, 0x72, 0x05, 0x4E, 0x6D,
+    0x4E, 0x68, 0x72, 0x4E, 0x85, 0x72, 0x09, 0x20, 0x03, 0x04, 0x04, 0x0E,
+    0x5C, 0x72, 0x72, 0x68, 0x68, 0x82, 0x72, 0x00, 0x4E, 0x82, 0x72, 0x03,
+    0x4E, 0x72, 0x4E, 0x68, 0x82, 0x72, 0x01, 0x68, 0x17, 0x92, 0x04, 0x92,
+    0x04, 0x01, 0x03, 0x3C, 0x84, 0x72, 0x12, 0x6D, 0x5B, 0x72, 0x72, 0x68,
+    0x68, 0x72, 0x68, 0x38, 0x68, 0x5B, 0x38, 0x5B, 0x72, 0x72, 0x4E, 0x72,
+    0x72, 0x4E, 0x83, 0x72, 0x09, 0x4E, 0x72, 0x72, 0x38, 0x2E, 0x2E, 0x6D,
+    0x72, 0x6D, 0x5B, 0x84, 0x72, 0x00, 0x2D, 0x84, 0x04, 0x03, 0x02, 0x12,
+    0x17, 0x2C, 0x82, 0x72, 0x0F, 0x4E, 0x6D, 0x72, 0x72, 0x4E, 0x72, 0x72,
+    0x4E, 0x68, 0x68, 0x72, 0x6D, 0x68, 0x72, 0x31, 0x08, 0x90, 0x04, 0x93,
+    0x04, 0x01, 0x08, 0x68, 0x84, 0x72, 0x03, 0x5B, 0x6D, 0x72, 0x4E, 0x82,
+    0x72, 0x02, 0x47, 0x68, 0x47, 0x82, 0x72, 0x04, 0x6D, 0x5B, 0x72, 0x72,
+    0x4E, 0x82, 0x72, 0x09, 0x68, 0x5B, 0x72, 0x68, 0x68, 0x72, 0x72, 0x68,
+    0x4E, 0x2E, 0x85, 0x72, 0x00, 0x17, 0x88, 0x04, 0x13, 0x00, 0x12, 0x06,
+    0x06, 0x31, 0x4E, 0x48, 0x23, 0x72, 0x68, 0x68, 0x72, 0x4E, 0x72, 0x72,
+    0x0A, 0x5C, 0x72, 0x5C, 0x08, 0x8F, 0x04, 0x94, 0x04, 0x00, 0x17, 0x83,
+    0x72, 0x0A, 0x5B, 0x48, 0x19, 0x2D, 0x24, 0x47, 0x72, 0x68, 0x68, 0x47,
+    0x4E, 0x82, 0x72, 0x03, 0x4E, 0x72, 0x72, 0x4E, 0x82, 0x72, 0x04, 0x5C,
+    0x0D, 0x00, 0x00, 0x47, 0x84, 0x72, 0x00, 0x4E, 0x85, 0x72, 0x00, 0x20,
+    0x90, 0x04, 0x0B, 0x00, 0x0B, 0x72, 0x72, 0x4E, 0x72, 0x72, 0x1C, 0x02,
+    0x26, 0x4E, 0x1B, 0x8F, 0x04, 0x94, 0x04, 0x05, 0x03, 0x4F, 0x72, 0x72,
+    0x11, 0x03, 0x82, 0x04, 0x03, 0x12, 0x72, 0x5B, 0x38, 0x85, 0x72, 0x07,
+    0x4E, 0x72, 0x72, 0x47, 0x72, 0x68, 0x2D, 0x02, 0x82, 0x04, 0x00, 0x48,
+    0x84, 0x72, 0x01, 0x5B, 0x6D, 0x84, 0x72, 0x01, 0x68, 0x06, 0x91, 0x04,
+    0x05, 0x11, 0x5B, 0x47, 0x4E, 0x72, 0x2D, 0x93, 0x04, 0x95, 0x04, 0x03,
+    0x20, 0x72, 0x4F, 0x03, 0x82, 0x04, 0x04, 0x03, 0x19, 0x4E, 0x47, 0x68,
+    0x82, 0x72, 0x08, 0x4E, 0x72, 0x72, 0x4E, 0x72, 0x31, 0x06, 0x00, 0x02,
+    0x84, 0x04, 0x00, 0x17, 0x85, 0x72, 0x00, 0x47, 0x86, 0x72, 0x02, 0x48,
+    0x1C, 0x02, 0x8E, 0x04, 0x05, 0x00, 0x72, 0x72, 0x4E, 0x72, 0x2D, 0x93,
+    0x04, 0x95, 0x04, 0x02, 0x0D, 0x72, 0x20, 0x83, 0x04, 0x03, 0x20, 0x72,
+    0x72, 0x4E, 0x82, 0x72, 0x05, 0x3C, 0x05, 0x72, 0x72, 0x5B, 0x17, 0x89,
+    0x04, 0x02, 0x12, 0x4F, 0x6D, 0x82, 0x4E, 0x02, 0x6D, 0x4E, 0x5B, 0x86,
+    0x72, 0x03, 0x5B, 0x3B, 0x26, 0x07, 0x8B, 0x04, 0x05, 0x01, 0x6D, 0x72,
+    0x47, 0x72, 0x2D, 0x93, 0x04, 0x95, 0x04, 0x02, 0x00, 0x4F, 0x03, 0x83,
+    0x04, 0x0B, 0x26, 0x72, 0x68, 0x68, 0x72, 0x72, 0x5C, 0x08, 0x03, 0x4F,
+    0x72, 0x48, 0x8B, 0x04, 0x01, 0x03, 0x30, 0x83, 0x72, 0x00, 0x6D, 0x82,
+    0x4E, 0x02, 0x47, 0x4E, 0x6D, 0x84, 0x72, 0x01, 0x6D, 0x0E, 0x8B, 0x04,
+    0x04, 0x2A, 0x47, 0x4E, 0x72, 0x2D, 0x93, 0x04, 0x95, 0x04, 0x01, 0x01,
+    0x0E, 0x83, 0x04, 0x0C, 0x08, 0x48, 0x5B, 0x47, 0x72, 0x72, 0x5C, 0x08,
+    0x04, 0x04, 0x17, 0x72, 0x20, 0x8C, 0x04, 0x12, 0x08, 0x31, 0x4E, 0x4E,
+    0x5B, 0x5B, 0x72, 0x72, 0x4E, 0x72, 0x72, 0x4E, 0x72, 0x72, 0x48, 0x3B,
+    0x6D, 0x72, 0x31, 0x8B, 0x04, 0x04, 0x4E, 0x72, 0x4E, 0x72, 0x2D, 0x93,
+    0x04, 0x9B, 0x04, 0x06, 0x3B, 0x72, 0x68, 0x68, 0x72, 0x5C, 0x08, 0x82,
+    0x04, 0x02, 0x03, 0x47, 0x02, 0x90, 0x04, 0x0E, 0x1C, 0x68, 0x5B, 0x4E,
+    0x6D, 0x72, 0x5B, 0x6D, 0x72, 0x6D, 0x07, 0x04, 0x01, 0x1C, 0x23, 0x8B,
+    0x04, 0x04, 0x4E, 0x72, 0x4E, 0x72, 0x1C, 0x93, 0x04, 0x9B, 0x04, 0x05,
+    0x4E, 0x72, 0x4E, 0x72, 0x5C, 0x08, 0x84, 0x04, 0x00, 0x00, 0x84, 0x04,
+    0x02, 0x00, 0x02, 0x12, 0x89, 0x04, 0x01, 0x08, 0x3B, 0x82, 0x4E, 0x04,
+    0x38, 0x68, 0x72, 0x72, 0x17, 0x8F, 0x04, 0x05, 0x1C, 0x5B, 0x2E, 0x68,
+    0x72, 0x12, 0x93, 0x04, 0x9A, 0x04, 0x05, 0x13, 0x4E, 0x68, 0x68, 0x5C,
+    0x08, 0x89, 0x04, 0x06, 0x03, 0x2F, 0x5B, 0x38, 0x72, 0x31, 0x03, 0x86,
+    0x04, 0x09, 0x02, 0x15, 0x72, 0x72, 0x6D, 0x4E, 0x6D, 0x72, 0x72, 0x20,
+    0x85, 0x04, 0x03, 0x0D, 0x17, 0x2A, 0x13, 0x86, 0x04, 0x05, 0x4E, 0x72,
+    0x4E, 0x72, 0x6D, 0x01, 0x93, 0x04, 0x8E, 0x04, 0x04, 0x12, 0x2D, 0x26,
+    0x11, 0x01, 0x85, 0x04, 0x05, 0x08, 0x5C, 0x5B, 0x5B, 0x72, 0x12, 0x8A,
+    0x04, 0x07, 0x06, 0x07, 0x08, 0x47, 0x72, 0x72, 0x3C, 0x02, 0x84, 0x04,
+    0x05, 0x07, 0x68, 0x6D, 0x4E, 0x47, 0x5B, 0x82, 0x72, 0x00, 0x20, 0x85,
+    0x04, 0x05, 0x11, 0x30, 0x68, 0x4E, 0x6D, 0x13, 0x85, 0x04, 0x04, 0x24,
+    0x4E, 0x5B, 0x72, 0x4E, 0x94, 0x04, 0x8E, 0x04, 0x0B, 0x15, 0x11, 0x4E,
+    0x5B, 0x6D, 0x2D, 0x06, 0x03, 0x04, 0x03, 0x17, 0x68, 0x82, 0x72, 0x00,
+    0x3B, 0x8E, 0x04, 0x09, 0x07, 0x20, 0x3B, 0x72, 0x68, 0x20, 0x06, 0x11,
+    0x2D, 0x48, 0x82, 0x4E, 0x00, 0x47, 0x82, 0x72, 0x01, 0x68, 0x12, 0x86,
+    0x04, 0x07, 0x02, 0x04, 0x0C, 0x6D, 0x72, 0x6D, 0x1C, 0x03, 0x82, 0x04,
+    0x00, 0x20, 0x83, 0x72, 0x00, 0x26, 0x94, 0x04, 0x90, 0x04, 0x07, 0x2E,
+    0x5B, 0x72, 0x72, 0x68, 0x2E, 0x28, 0x4E, 0x84, 0x72, 0x00, 0x0D, 0x8A,
+    0x04, 0x0A, 0x03, 0x17, 0x16, 0x2D, 0x26, 0x02, 0x04, 0x20, 0x6D, 0x4E,
+    0x5B, 0x87, 0x72, 0x02, 0x6D, 0x2D, 0x02, 0x88, 0x04, 0x09, 0x08, 0x26,
+    0x29, 0x4E, 0x4E, 0x72, 0x4F, 0x1C, 0x17, 0x2C, 0x84, 0x72, 0x00, 0x12,
+    0x94, 0x04, 0x8C, 0x04, 0x08, 0x03, 0x17, 0x2D, 0x2C, 0x6D, 0x6D, 0x4E,
+    0x4E, 0x68, 0x86, 0x72, 0x01, 0x5B, 0x03, 0x89, 0x04, 0x09, 0x03, 0x3B,
+    0x4E, 0x4E, 0x72, 0x72, 0x68, 0x2D, 0x2D, 0x47, 0x87, 0x72, 0x02, 0x5B,
+    0x26, 0x07, 0x88, 0x04, 0x03, 0x03, 0x2D, 0x5B, 0x5B, 0x82, 0x72, 0x01,
+    0x4E, 0x68, 0x87, 0x72, 0x00, 0x2D, 0x94, 0x04, 0x8C, 0x04, 0x04, 0x16,
+    0x31, 0x2D, 0x4E, 0x47, 0x82, 0x4E, 0x00, 0x5B, 0x87, 0x72, 0x03, 0x48,
+    0x2D, 0x1C, 0x0E, 0x86, 0x04, 0x06, 0x01, 0x12, 0x02, 0x48, 0x6D, 0x4E,
+    0x47, 0x83, 0x4E, 0x85, 0x72, 0x03, 0x23, 0x16, 0x0D, 0x03, 0x88, 0x04,
+    0x81, 0x1B, 0x05, 0x16, 0x2E, 0x20, 0x17, 0x1F, 0x4E, 0x89, 0x72, 0x02,
+    0x31, 0x0D, 0x03, 0x91, 0x04, 0x8C, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02,
+    0x3B, 0x87, 0x72, 0x03, 0x6D, 0x31, 0x1F, 0x68, 0x82, 0x72, 0x02, 0x47,
+    0x4E, 0x17, 0x87, 0x04, 0x0D, 0x01, 0x22, 0x5B, 0x72, 0x72, 0x6D, 0x4E,
+    0x31, 0x2D, 0x16, 0x3B, 0x31, 0x17, 0x30, 0x82, 0x72, 0x02, 0x2A, 0x1C,
+    0x02, 0x86, 0x04, 0x00, 0x00, 0x82, 0x04, 0x06, 0x03, 0x2D, 0x4E, 0x72,
+    0x72, 0x5B, 0x4E, 0x82, 0x72, 0x07, 0x68, 0x3B, 0x39, 0x6D, 0x72, 0x72,
+    0x23, 0x17, 0x90, 0x04, 0x8E, 0x04, 0x03, 0x08, 0x48, 0x5B, 0x5B, 0x82,
+    0x72, 0x0E, 0x2D, 0x06, 0x00, 0x11, 0x07, 0x04, 0x04, 0x08, 0x31, 0x6D,
+    0x72, 0x2F, 0x1C, 0x23, 0x03, 0x86, 0x04, 0x05, 0x26, 0x5B, 0x47, 0x4E,
+    0x20, 0x01, 0x87, 0x04, 0x06, 0x0D, 0x4F, 0x72, 0x47, 0x31, 0x38, 0x02,
+    0x88, 0x04, 0x13, 0x0E, 0x31, 0x4E, 0x72, 0x4F, 0x12, 0x03, 0x03, 0x17,
+    0x2D, 0x17, 0x02, 0x04, 0x04, 0x07, 0x25, 0x5B, 0x4E, 0x4E, 0x17, 0x8F,
+    0x04, 0x8E, 0x04, 0x06, 0x1F, 0x26, 0x11, 0x30, 0x4E, 0x31, 0x0D, 0x88,
+    0x04, 0x05, 0x01, 0x00, 0x03, 0x04, 0x03, 0x03, 0x86, 0x04, 0x03, 0x10,
+    0x03, 0x03, 0x01, 0x8A, 0x04, 0x05, 0x03, 0x00, 0x01, 0x04, 0x08, 0x01,
+    0x87, 0x04, 0x05, 0x03, 0x48, 0x3B, 0x1B, 0x15, 0x03, 0x8A, 0x04, 0x03,
+    0x00, 0x04, 0x03, 0x09, 0x8F, 0x04, 0x8E, 0x04, 0x00, 0x05, 0xB8, 0x04,
+    0x01, 0x02, 0x0E, 0xA2, 0x04, 0xED, 0x04, 0xED, 0x04, 0xED, 0x04, 0xED,
+    0x04, 0xED, 0x04};
+
+const uint16_t dragonRLEPalette[] PROGMEM = {
+    0x0405, 0x0445, 0x04A6, 0x0506, 0x0547, 0x0B64, 0x0BA5, 0x0C05, 0x0C66,
+    0x1A03, 0x1A63, 0x1AC4, 0x1B04, 0x1B65, 0x1BC5, 0x2104, 0x2264, 0x22C4,
+    0x2305, 0x2365, 0x31C3, 0x3224, 0x3264, 0x32C5, 0x3986, 0x4183, 0x4208,
+    0x4224, 0x4285, 0x4822, 0x4984, 0x49C4, 0x4A25, 0x5822, 0x5883, 0x58E3,
+    0x5924, 0x5984, 0x59E5, 0x5A08, 0x6843, 0x6883, 0x68E4, 0x6926, 0x6944,
+    0x6985, 0x7043, 0x70A4, 0x70E4, 0x7145, 0x71A8, 0x728B, 0x78C5, 0x7926,
+    0x7B0C, 0x7B8E, 0x8044, 0x80A4, 0x80C5, 0x80E5, 0x8145, 0x822A, 0x82AB,
+    0x830D, 0x8410, 0x8947, 0x89A8, 0x8A2A, 0x8B8E, 0x8C10, 0x8C71, 0x9044,
+    0x90A4, 0x90C6, 0x9105, 0x9147, 0x92AC, 0x932D, 0x9864, 0x98A5, 0x99C9,
+    0x9A2A, 0x9AAC, 0x9C92, 0x9CF3, 0xA0C6, 0xA148, 0xA1C9, 0xA32E, 0xA3AF,
+    0xA411, 0xA865, 0xA8C5, 0xA8E6, 0xAA4B, 0xAAAC, 0xAB2E, 0xAC92, 0xAD14,
+    0xB148, 0xB1CA, 0xB3B0, 0xB431, 0xB493, 0xB865, 0xB8E7, 0xBD14, 0xBD96,
+    0xBDF7, 0xC066, 0xC515, 0xCD96, 0xCE18, 0xCE79, 0xD086, 0xDE9A, 0xDEFB,
+    0xEF7D, 0xFFFF};
+
+const GFXrleBitmap dragonRLE PROGMEM = {
+    (uint8_t *)dragonRLEData, (uint16_t *)dragonRLEPalette, 110, 70};
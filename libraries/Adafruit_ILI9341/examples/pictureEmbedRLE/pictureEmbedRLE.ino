@@ -0,0 +1,104 @@
+// ILI9341 example comparing a raw RGB565 embedded bitmap against the same
+// image in GFX's palette + RLE compressed format (drawRLEBitmap()).
+// WILL NOT FIT ON ARDUINO UNO OR OTHER AVR BOARDS; the raw image alone
+// is 15,400 bytes.
+//
+// dragon_rle.h was made from dragon.h with the rleconvert tool in the
+// Adafruit_GFX library folder:
+//   python3 rleconvert/rleconvert.py --name dragonRLE dragon.h > dragon_rle.h
+//
+// Prints the flash used by each format, the number of bytes each has to
+// read from flash per draw, and the time for a series of draws.
+
+#include "SPI.h"
+#include <Adafruit_ILI9341.h>
+#include "dragon.h"
+#include "dragon_rle.h"
+
+// Feather 32u4 or M0 with TFT FeatherWing:
+#define TFT_DC 10
+#define TFT_CS  9
+
+Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC);
+
+#define DRAWS 20 // Number of draws per timing pass
+
+// Count the bytes drawRLEBitmap() reads from flash for one full (unclipped)
+// draw: every packet header and index byte, plus one 16-bit palette read
+// per run and per literal pixel.
+uint32_t rleBytesRead(const uint8_t *data, uint16_t w, uint16_t h) {
+  uint32_t total = 0;
+  for(uint16_t j=0; j<h; j++) {
+    for(uint16_t i=0; i<w; ) {
+      uint8_t hdr = pgm_read_byte(data++), n = (hdr & 0x7F) + 1;
+      if(hdr & GFX_RLE_RUN) {
+        data  += 1;
+        total += 2 + 2;     // Header + index, one palette entry
+      } else {
+        data  += n;
+        total += 1 + n * 3; // Header + n indices, n palette entries
+      }
+      i += n;
+    }
+  }
+  return total;
+}
+
+uint32_t timeRaw() {
+  uint32_t start = micros();
+  for(uint8_t j=0; j<DRAWS; j++) {
+    tft.drawRGBBitmap((j * 37) % (tft.width()  - DRAGON_WIDTH),
+                      (j * 53) % (tft.height() - DRAGON_HEIGHT),
+#if defined(__AVR__) || defined(ESP8266)
+                      dragonBitmap,
+#else
+                      (uint16_t *)dragonBitmap,
+#endif
+                      DRAGON_WIDTH, DRAGON_HEIGHT);
+  }
+  return micros() - start;
+}
+
+uint32_t timeRLE() {
+  uint32_t start = micros();
+  for(uint8_t j=0; j<DRAWS; j++) {
+    tft.drawRLEBitmap((j * 37) % (tft.width()  - DRAGON_WIDTH),
+                      (j * 53) % (tft.height() - DRAGON_HEIGHT),
+                      &dragonRLE);
+  }
+  return micros() - start;
+}
+
+void setup() {
+  Serial.begin(9600);
+  while(!Serial) delay(10);
+
+  tft.begin();
+  tft.fillScreen(ILI9341_BLACK);
+
+  Serial.println(F("Format      Flash bytes  Bytes read/draw  Time (us)"));
+  delay(10);
+
+  uint32_t t = timeRaw();
+  Serial.print(F("Raw RGB565  "));
+  Serial.print((uint32_t)sizeof(dragonBitmap));
+  Serial.print(F("        "));
+  Serial.print((uint32_t)sizeof(dragonBitmap));
+  Serial.print(F("            "));
+  Serial.println(t);
+  delay(500);
+
+  tft.fillScreen(ILI9341_BLACK);
+  t = timeRLE();
+  Serial.print(F("RLE         "));
+  Serial.print((uint32_t)(sizeof(dragonRLEData) + sizeof(dragonRLEPalette)));
+  Serial.print(F("         "));
+  Serial.print(rleBytesRead(dragonRLEData, DRAGON_WIDTH, DRAGON_HEIGHT));
+  Serial.print(F("            "));
+  Serial.println(t);
+
+  Serial.println(F("Done!"));
+}
+
+void loop(void) {
+}
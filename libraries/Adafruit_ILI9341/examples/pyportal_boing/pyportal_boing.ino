@@ -1,5 +1,6 @@
 // 'Boing' ball demo for PyPortal.
-// Requires Adafruit_GFX 1.4.5 or later and Adafruit_DMA
+// Requires Adafruit_GFX 1.4.5 or later (with streamScanlines()) and
+// Adafruit_DMA
 
 #include "Adafruit_GFX.h"
 #include "Adafruit_ILI9341.h"
@@ -41,8 +42,47 @@ uint16_t renderbuf[2][SCREENWIDTH];
 
 uint16_t palette[16]; // Color table for ball rotation effect
 
+// Top-left of the changed rectangle, relative to the ball and background
+// bitmaps. Passed to renderLine() through streamScanlines()' userData.
+struct BallBounds {
+  int16_t bx, by, bgx, bgy;
+} bounds;
+
 uint32_t startTime, frame = 0; // For frames-per-second estimate
 
+// Render one row of the changed rectangle into 'buf'. Called by
+// streamScanlines() while the previous row is being transferred.
+void renderLine(int16_t row, uint16_t *buf, uint16_t width, void *userData) {
+  const BallBounds *b = (const BallBounds *)userData;
+  int16_t  by  = b->by  + row,  // Y relative to ball bitmap
+           bgy = b->bgy + row,  // Y relative to background bitmap
+           bx1 = b->bx,         // X counters, incremented in loop below
+           bgx1 = b->bgx;
+  uint16_t c;
+  uint8_t  p;                   // 'packed' value of 2 ball pixels
+
+  for(uint16_t x=0; x<width; x++) {
+    if((bx1 >= 0) && (bx1 < BALLWIDTH) &&  // Is current pixel row/column
+       (by  >= 0) && (by  < BALLHEIGHT)) { // inside the ball bitmap area?
+      // Yes, do ball compositing math...
+      p = ball[by][bx1 / 2];                // Get packed value (2 pixels)
+      c = (bx1 & 1) ? (p & 0xF) : (p >> 4); // Unpack high or low nybble
+      if(c == 0) { // Outside ball - just draw grid
+        c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDCOLOR : BGCOLOR;
+      } else if(c > 1) { // In ball area...
+        c = palette[c];
+      } else { // In shadow area...
+        c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDSHADOW : BGSHADOW;
+      }
+    } else { // Outside ball bitmap, just draw background bitmap...
+      c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDCOLOR : BGCOLOR;
+    }
+    *buf++ = c; // Store pixel color
+    bx1++;  // Increment bitmap position counters (X axis)
+    bgx1++;
+  }
+}
+
 void setup() {
   Serial.begin(9600);
 //  while(!Serial);
@@ -58,6 +98,11 @@ void setup() {
   tft.drawBitmap(0, 0, (uint8_t *)background,
     SCREENWIDTH, SCREENHEIGHT, GRIDCOLOR, BGCOLOR);
 
+  // The display is only ever drawn by streamScanlines() from here on, so
+  // the transaction stays open and each frame's last line can still be
+  // going out while the next frame is worked out.
+  tft.startWrite();
+
   startTime = millis();
 }
 
@@ -104,52 +149,18 @@ void loop() {
     // Palette entries 0 and 1 aren't used (clear and shadow, respectively)
   }
 
-  // Only the changed rectangle is drawn into the 'renderbuf' array...
-  uint16_t c, *destPtr;
-  int16_t  bx  = minx - (int)ballx, // X relative to ball bitmap (can be negative)
-           by  = miny - (int)bally, // Y relative to ball bitmap (can be negative)
-           bgx = minx,              // X relative to background bitmap (>= 0)
-           bgy = miny,              // Y relative to background bitmap (>= 0)
-           x, y, bx1, bgx1;         // Loop counters and working vars
-  uint8_t  p;                       // 'packed' value of 2 ball pixels
-  int8_t bufIdx = 0;
-
-  tft.dmaWait();  // Wait for last line from prior call to complete
-  tft.endWrite();
-
-  tft.startWrite();
-  tft.setAddrWindow(minx, miny, width, height);
-
-  for(y=0; y<height; y++) { // For each row...
-    destPtr = &renderbuf[bufIdx][0];
-    bx1  = bx;  // Need to keep the original bx and bgx values,
-    bgx1 = bgx; // so copies of them are made here (and changed in loop below)
-    for(x=0; x<width; x++) {
-      if((bx1 >= 0) && (bx1 < BALLWIDTH) &&  // Is current pixel row/column
-         (by  >= 0) && (by  < BALLHEIGHT)) { // inside the ball bitmap area?
-        // Yes, do ball compositing math...
-        p = ball[by][bx1 / 2];                // Get packed value (2 pixels)
-        c = (bx1 & 1) ? (p & 0xF) : (p >> 4); // Unpack high or low nybble
-        if(c == 0) { // Outside ball - just draw grid
-          c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDCOLOR : BGCOLOR;
-        } else if(c > 1) { // In ball area...
-          c = palette[c];
-        } else { // In shadow area...
-          c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDSHADOW : BGSHADOW;
-        }
-      } else { // Outside ball bitmap, just draw background bitmap...
-        c = background[bgy][bgx1 / 8] & (0x80 >> (bgx1 & 7)) ? GRIDCOLOR : BGCOLOR;
-      }
-      *destPtr++ = c; // Store pixel color
-      bx1++;  // Increment bitmap position counters (X axis)
-      bgx1++;
-    }
-    tft.dmaWait(); // Wait for prior line to complete
-    tft.writePixels(&renderbuf[bufIdx][0], width, false); // Non-blocking write
-    bufIdx = 1 - bufIdx;
-    by++; // Increment bitmap position counters (Y axis)
-    bgy++;
-  }
+  // Only the changed rectangle is drawn, one scanline at a time, into
+  // the 'renderbuf' array. streamScanlines() calls renderLine() for each
+  // row, rendering the next line while the prior one is sent via DMA.
+  // It returns with the last line still in flight and waits for it in the
+  // next frame, after rendering that frame's first line.
+  bounds.bx  = minx - (int)ballx; // X relative to ball bitmap (can be negative)
+  bounds.by  = miny - (int)bally; // Y relative to ball bitmap (can be negative)
+  bounds.bgx = minx;              // X relative to background bitmap (>= 0)
+  bounds.bgy = miny;              // Y relative to background bitmap (>= 0)
+
+  tft.streamScanlines(minx, miny, width, height, &renderbuf[0][0],
+    renderLine, &bounds);
 
   // Show approximate frame rate
   if(!(++frame & 255)) { // Every 256 frames...
@@ -304,24 +304,118 @@ bool Adafruit_LEDBackpack::begin(uint8_t _addr, TwoWire *theWire) {
 }
 
 void Adafruit_LEDBackpack::writeDisplay(void) {
+  writeRows(0, 8);
+  sentValid = true;
+}
+
+void Adafruit_LEDBackpack::writeRows(uint8_t first, uint8_t count) {
   uint8_t buffer[17];
 
-  buffer[0] = 0x00; // start at address $00
+  buffer[0] = first * 2; // display RAM address, auto-increments
 
-  for (uint8_t i = 0; i < 8; i++) {
-    buffer[1 + 2 * i] = displaybuffer[i] & 0xFF;
-    buffer[2 + 2 * i] = displaybuffer[i] >> 8;
+  for (uint8_t i = 0; i < count; i++) {
+    uint16_t row = displaybuffer[first + i];
+    buffer[1 + 2 * i] = row & 0xFF;
+    buffer[2 + 2 * i] = row >> 8;
+    sentbuffer[first + i] = row;
   }
 
-  i2c_dev->write(buffer, 17);
+  i2c_dev->write(buffer, 1 + 2 * count);
+}
+
+uint8_t Adafruit_LEDBackpack::diffRows(const uint16_t *current,
+                                       const uint16_t *sent, uint8_t *first,
+                                       uint8_t *last) {
+  int8_t lo = 0, hi = 7;
+  while ((lo < 8) && (current[lo] == sent[lo]))
+    lo++;
+  if (lo == 8)
+    return 0;
+  while (current[hi] == sent[hi])
+    hi--; // stops at lo at the latest
+  *first = lo;
+  *last = hi;
+  return hi - lo + 1;
+}
+
+uint8_t Adafruit_LEDBackpack::pendingBytes(void) const {
+  uint8_t first, last, rows = 8;
+  if (sentValid)
+    rows = diffRows(displaybuffer, sentbuffer, &first, &last);
+  // I2C address + RAM address + 2 bytes per row
+  return rows ? 2 + 2 * rows : 0;
+}
+
+uint8_t Adafruit_LEDBackpack::writeDisplayDiff(void) {
+  uint8_t first = 0, last = 7, rows = 8;
+  if (sentValid) {
+    rows = diffRows(displaybuffer, sentbuffer, &first, &last);
+    if (!rows)
+      return 0;
+  }
+  writeRows(first, rows);
+  sentValid = true;
+  return 2 + 2 * rows;
 }
 
+void Adafruit_LEDBackpack::invalidate(void) { sentValid = false; }
+
 void Adafruit_LEDBackpack::clear(void) {
   for (uint8_t i = 0; i < 8; i++) {
     displaybuffer[i] = 0;
   }
 }
 
+/******************************* BACKPACK SCHEDULER OBJECT */
+
+Adafruit_LEDBackpackScheduler::Adafruit_LEDBackpackScheduler(uint32_t busHz)
+    : hz(busHz), count(0), next(0) {}
+
+bool Adafruit_LEDBackpackScheduler::add(Adafruit_LEDBackpack *backpack) {
+  if (count >= LEDBACKPACK_SCHEDULER_MAX)
+    return false;
+  devices[count++] = backpack;
+  return true;
+}
+
+uint32_t Adafruit_LEDBackpackScheduler::busTime(uint8_t bytes) const {
+  // 9 clocks per byte (8 data + ACK), plus START and STOP
+  uint32_t clocks = (uint32_t)bytes * 9 + 2;
+  return (clocks * 1000000UL + hz - 1) / hz;
+}
+
+uint8_t Adafruit_LEDBackpackScheduler::update(uint32_t budgetUs) {
+  uint8_t written = 0, start = next;
+  uint32_t spent = 0;
+
+  // One lap at most, starting after whichever device was written last
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t d = start + i;
+    if (d >= count)
+      d -= count;
+    uint8_t bytes = devices[d]->pendingBytes();
+    if (!bytes)
+      continue;
+    uint32_t t = busTime(bytes);
+    if (written && (spent + t > budgetUs))
+      break; // Out of time; resume with this device next call
+    devices[d]->writeDisplayDiff();
+    spent += t;
+    written++;
+    next = (d + 1 < count) ? d + 1 : 0;
+  }
+
+  return written;
+}
+
+bool Adafruit_LEDBackpackScheduler::idle(void) const {
+  for (uint8_t i = 0; i < count; i++) {
+    if (devices[i]->pendingBytes())
+      return false;
+  }
+  return true;
+}
+
 /******************************* QUAD ALPHANUM OBJECT */
 
 Adafruit_AlphaNum4::Adafruit_AlphaNum4(void) {}
@@ -50,6 +50,8 @@
 
 #define SEVENSEG_DIGITS 5 ///< # Digits in 7-seg displays, plus NUL end
 
+#define LEDBACKPACK_SCHEDULER_MAX 8 ///< Max backpacks per scheduler
+
 /*!
     @brief  Class encapsulating the raw HT16K33 controller device.
 */
@@ -92,6 +94,41 @@ public:
   */
   void writeDisplay(void);
 
+  /*!
+    @brief  Issue only the rows of displaybuffer that changed since the
+            last write to the display, as one I2C transfer covering the
+            first through last changed row. Does nothing if no rows
+            changed.
+    @return  Number of bytes sent over I2C (0 if display was current).
+  */
+  uint8_t writeDisplayDiff(void);
+
+  /*!
+    @brief  Number of bytes writeDisplayDiff() would send right now,
+            including the I2C address and register bytes.
+    @return  Byte count, or 0 if the display is current.
+  */
+  uint8_t pendingBytes(void) const;
+
+  /*!
+    @brief  Forget what is on the display, so the next writeDisplayDiff()
+            sends all rows (e.g. after the device was power cycled).
+  */
+  void invalidate(void);
+
+  /*!
+    @brief  Find the range of rows that differ between two 8-row buffers.
+            No I2C access, so it can be used on its own.
+    @param  current  Rows as they should be.
+    @param  sent     Rows as last written to the device.
+    @param  first    Set to the first differing row.
+    @param  last     Set to the last differing row.
+    @return  Number of rows in the range first..last, 0 if none differ
+             (first and last are then left unchanged).
+  */
+  static uint8_t diffRows(const uint16_t *current, const uint16_t *sent,
+                          uint8_t *first, uint8_t *last);
+
   /*!
     @brief  Clear display.
   */
@@ -101,6 +138,67 @@ public:
 
 protected:
   Adafruit_I2CDevice *i2c_dev = NULL; ///< Pointer to I2C bus interface
+  uint16_t sentbuffer[8];             ///< Rows last written to the device
+  bool sentValid = false;             ///< sentbuffer matches the device
+
+private:
+  void writeRows(uint8_t first, uint8_t count);
+};
+
+/*!
+    @brief  Spreads writeDisplayDiff() calls for several backpacks across
+            loop() iterations, spending at most a given amount of I2C bus
+            time per call to update(). Devices are serviced round-robin so
+            a busy display can't starve the others.
+*/
+class Adafruit_LEDBackpackScheduler {
+public:
+  /*!
+    @brief  Constructor for backpack update scheduler.
+    @param  busHz  I2C clock rate, used to estimate time per transfer.
+  */
+  Adafruit_LEDBackpackScheduler(uint32_t busHz = 100000);
+
+  /*!
+    @brief  Add a backpack to the schedule.
+    @param  backpack  Backpack that has already had begin() called.
+    @return  true if added, false if LEDBACKPACK_SCHEDULER_MAX reached.
+  */
+  bool add(Adafruit_LEDBackpack *backpack);
+
+  /*!
+    @brief  Set I2C clock rate used for bus time estimates.
+    @param  busHz  I2C clock rate in Hz.
+  */
+  void setBusClock(uint32_t busHz) { hz = busHz; }
+
+  /*!
+    @brief  Write changed rows to as many backpacks as fit in the budget.
+            At least one pending backpack is always written, so progress
+            is made even if a single transfer exceeds the budget.
+    @param  budgetUs  Bus time allowed for this call, in microseconds.
+    @return  Number of backpacks written.
+  */
+  uint8_t update(uint32_t budgetUs);
+
+  /*!
+    @brief  Estimated I2C bus time for a transfer.
+    @param  bytes  Bytes in the transfer, including the address byte.
+    @return  Time in microseconds.
+  */
+  uint32_t busTime(uint8_t bytes) const;
+
+  /*!
+    @brief  Check whether every backpack is current.
+    @return  true if nothing is waiting to be written.
+  */
+  bool idle(void) const;
+
+private:
+  Adafruit_LEDBackpack *devices[LEDBACKPACK_SCHEDULER_MAX];
+  uint32_t hz;
+  uint8_t count;
+  uint8_t next;
 };
 
 /*!
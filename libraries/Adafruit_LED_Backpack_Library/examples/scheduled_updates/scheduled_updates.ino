@@ -0,0 +1,56 @@
+/***************************************************
+  This is a library for our I2C LED Backpacks
+
+  Drives several 7-segment backpacks (e.g. score and credit displays) from
+  one loop(). Each loop only changes the numbers in RAM; a scheduler then
+  writes just the changed digits of each display, limited to a fixed
+  amount of I2C bus time per loop so the rest of the sketch stays responsive.
+
+  Set the four backpacks to addresses 0x70 thru 0x73.
+
+  Adafruit invests time and resources providing this open source code,
+  please support Adafruit and open-source hardware by purchasing
+  products from Adafruit!
+
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include "Adafruit_LEDBackpack.h"
+
+#define NUM_DISPLAYS 4
+#define BUS_BUDGET_US 2000 // I2C time allowed per loop()
+
+Adafruit_7segment displays[NUM_DISPLAYS];
+Adafruit_LEDBackpackScheduler scheduler(100000); // Wire default clock
+
+uint16_t score[NUM_DISPLAYS];
+
+void setup() {
+  Serial.begin(9600);
+  Serial.println("Scheduled backpack updates");
+
+  for (uint8_t i = 0; i < NUM_DISPLAYS; i++) {
+    displays[i].begin(0x70 + i);
+    scheduler.add(&displays[i]);
+  }
+}
+
+void loop() {
+  // Pretend game logic: each display changes at a different rate
+  for (uint8_t i = 0; i < NUM_DISPLAYS; i++) {
+    if (random(4 << i) == 0) {
+      score[i]++;
+      displays[i].print(score[i]);
+    }
+  }
+
+  uint8_t written = scheduler.update(BUS_BUDGET_US);
+  if (written) {
+    Serial.print("Displays written: ");
+    Serial.println(written);
+  }
+
+  delay(10);
+}
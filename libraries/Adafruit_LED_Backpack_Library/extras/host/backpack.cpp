@@ -0,0 +1,185 @@
+// Runs the partial display updates against a TwoWire that keeps what it is
+// sent.  Checks diffRows() against a plain search for changed rows, then
+// that each writeDisplayDiff() sends one transfer of just the rows from
+// the first to the last changed, which leaves a model of the HT16K33's RAM
+// matching displaybuffer.  Last, checks the scheduler stays within its
+// bus time budget, takes the backpacks in turn and gets them all current.
+// Prints the number of failures and exits non-zero if there were any.
+//
+// Usage: backpack
+#include <Adafruit_LEDBackpack.h>
+
+TwoWire Wire;
+unsigned long millis(void) { return 0; }
+unsigned long micros(void) { return 0; }
+void delay(unsigned long) {}
+void yield(void) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return 0; }
+
+#define BACKPACKS 4
+
+static int bad = 0;
+
+static void fail(const char *what, int i) {
+  if (bad++ < 20)
+    printf("%s (%d)\n", what, i);
+}
+
+// display RAM of each backpack, as the transfers left it
+static uint8_t ram[BACKPACKS][16];
+
+// applies the transfers since 'from' to the RAM models, returning the bus
+// time they took
+static uint32_t apply(unsigned from, Adafruit_LEDBackpackScheduler &s) {
+  uint32_t us = 0;
+  for (unsigned t = from; t < Wire.count && t < WIRE_LOG_MAX; t++) {
+    WireTransfer &w = Wire.log[t];
+    int b = w.addr - 0x70;
+    if (b < 0 || b >= BACKPACKS) {
+      fail("transfer to an unknown address", w.addr);
+      continue;
+    }
+    // writes to display RAM start with its address, single bytes are
+    // commands
+    for (int i = 1; i < w.len && w.data[0] < 16; i++)
+      ram[b][(w.data[0] + i - 1) & 15] = w.data[i];
+    us += s.busTime(w.len + 1); // and the address byte
+  }
+  return us;
+}
+
+static bool current(Adafruit_LEDBackpack &p, int b) {
+  for (int r = 0; r < 8; r++)
+    if (ram[b][2 * r] != (p.displaybuffer[r] & 0xFF) ||
+        ram[b][2 * r + 1] != p.displaybuffer[r] >> 8)
+      return false;
+  return true;
+}
+
+// changes a random few rows, sometimes none
+static void scribble(Adafruit_LEDBackpack &p) {
+  for (int k = rand() % 4; k > 0; k--)
+    p.displaybuffer[rand() % 8] = rand();
+}
+
+int main(void) {
+  srand(1);
+
+  // diffRows() against a plain search
+  for (int i = 0; i < 100000; i++) {
+    uint16_t cur[8], sent[8];
+    for (int r = 0; r < 8; r++)
+      cur[r] = sent[r] = rand();
+    for (int k = rand() % 4; k > 0; k--)
+      cur[rand() % 8] ^= 1 << rand() % 16;
+    int lo = -1, hi = -1;
+    for (int r = 0; r < 8; r++)
+      if (cur[r] != sent[r]) {
+        if (lo < 0)
+          lo = r;
+        hi = r;
+      }
+    uint8_t first = 99, last = 99;
+    uint8_t rows = Adafruit_LEDBackpack::diffRows(cur, sent, &first, &last);
+    if (lo < 0 ? rows != 0 || first != 99 || last != 99
+               : rows != hi - lo + 1 || first != lo || last != hi)
+      fail("diffRows() range", i);
+  }
+
+  Adafruit_LEDBackpack p[BACKPACKS];
+  Adafruit_LEDBackpackScheduler sched(100000);
+  for (int b = 0; b < BACKPACKS; b++) {
+    p[b].begin(0x70 + b);
+    sched.add(&p[b]);
+  }
+  memset(ram, 0xAA, sizeof(ram)); // RAM powers up with garbage
+  Wire.count = 0;
+  for (int b = 0; b < BACKPACKS; b++)
+    p[b].invalidate();
+
+  // one backpack at a time: one transfer of just the changed rows
+  for (int i = 0; i < 20000; i++) {
+    Adafruit_LEDBackpack &d = p[0];
+    if (i % 1000 == 0)
+      d.invalidate();
+    scribble(d);
+    uint8_t pending = d.pendingBytes();
+    Wire.count = 0;
+    uint8_t sent = d.writeDisplayDiff();
+    apply(0, sched);
+    if (sent != pending)
+      fail("writeDisplayDiff() sent a different count than pendingBytes()", i);
+    if (!sent ? Wire.count != 0
+              : Wire.count != 1 || Wire.log[0].len + 1 != sent ||
+                    Wire.log[0].data[0] & 1)
+      fail("not one transfer of whole rows", i);
+    if (!current(d, 0))
+      fail("display RAM doesn't match displaybuffer", i);
+    if (d.pendingBytes())
+      fail("rows still pending after writeDisplayDiff()", i);
+  }
+  for (int b = 1; b < BACKPACKS; b++)
+    p[b].writeDisplayDiff();
+  apply(0, sched);
+
+  // the scheduler: at most one lap per call, within the budget unless it
+  // wrote only one backpack, and in turn
+  unsigned long calls = 0, writes = 0;
+  int next = 0; // backpack after the one last written
+  for (int i = 0; i < 20000; i++) {
+    for (int b = 0; b < BACKPACKS; b++)
+      if (rand() % 3 == 0)
+        scribble(p[b]);
+    // those with rows pending, in the order update() should take them
+    int order[BACKPACKS], pending = 0;
+    for (int k = 0; k < BACKPACKS; k++)
+      if (p[(next + k) % BACKPACKS].pendingBytes())
+        order[pending++] = (next + k) % BACKPACKS;
+    uint32_t budget = rand() % 2 ? 4000 : 500;
+    Wire.count = 0;
+    uint8_t written = sched.update(budget);
+    uint32_t us = apply(0, sched);
+    calls++;
+    writes += written;
+    if (written != Wire.count || written > pending || (pending && !written))
+      fail("update() count differs from the transfers", i);
+    if (written > 1 && us > budget)
+      fail("update() went over its budget", i);
+    for (unsigned t = 0; t < Wire.count && t < (unsigned)pending; t++)
+      if (Wire.log[t].addr != 0x70 + order[t])
+        fail("backpacks not taken in turn", i);
+    if (written)
+      next = (order[written - 1] + 1) % BACKPACKS;
+  }
+  for (int i = 0; i < BACKPACKS && !sched.idle(); i++) {
+    Wire.count = 0;
+    sched.update(500);
+    apply(0, sched);
+  }
+  if (!sched.idle())
+    fail("scheduler never got idle", 0);
+  for (int b = 0; b < BACKPACKS; b++)
+    if (!current(p[b], b))
+      fail("display RAM doesn't match displaybuffer after scheduling", b);
+
+  // a backpack with rows pending is written within one lap even when
+  // the budget fits one transfer per call
+  for (int b = 0; b < BACKPACKS; b++)
+    p[b].displaybuffer[b] ^= 1;
+  int seen = 0;
+  for (int i = 0; i < BACKPACKS; i++) {
+    Wire.count = 0;
+    sched.update(1);
+    apply(0, sched);
+    if (Wire.count == 1)
+      seen |= 1 << (Wire.log[0].addr - 0x70);
+  }
+  if (seen != (1 << BACKPACKS) - 1)
+    fail("a backpack was skipped", seen);
+
+  printf("%lu scheduler calls wrote %lu backpacks\n", calls, writes);
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
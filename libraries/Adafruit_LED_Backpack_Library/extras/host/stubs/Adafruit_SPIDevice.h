@@ -0,0 +1,4 @@
+// The GFX core includes this but the backpacks only use I2C
+#ifndef Adafruit_SPIDevice_h
+#define Adafruit_SPIDevice_h
+#endif // Adafruit_SPIDevice_h
@@ -0,0 +1,58 @@
+// Just enough of the Arduino core to build the LED backpack library on a PC
+#ifndef Arduino_h
+#define Arduino_h
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define F(s) ((const __FlashStringHelper *)(s))
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define pgm_read_dword(a) (*(const uint32_t *)(a))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LSBFIRST 0
+#define MSBFIRST 1
+#define DEC 10
+#define HEX 16
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+typedef bool boolean;
+typedef uint8_t byte;
+class __FlashStringHelper;
+
+/** Just the parts of String that print() and getTextBounds() use */
+class String {
+public:
+  String(const char *s = "") : s(s) {}
+  const char *c_str(void) const { return s; }
+  unsigned int length(void) const { return strlen(s); }
+
+private:
+  const char *s;
+};
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void yield(void);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+#include "Print.h"
+#endif // Arduino_h
@@ -0,0 +1,50 @@
+#ifndef Print_h
+#define Print_h
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+class __FlashStringHelper;
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) {
+    size_t r = 0;
+    while (n--)
+      r += write(*b++);
+    return r;
+  }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t write(const char *b, size_t n) {
+    return write((const uint8_t *)b, n);
+  }
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(long n, int base = 10) {
+    char b[24];
+    snprintf(b, sizeof(b), base == 16 ? "%lx" : "%ld", n);
+    return write(b);
+  }
+  size_t print(int n, int base = 10) { return print((long)n, base); }
+  size_t print(unsigned long n, int base = 10) {
+    char b[24];
+    snprintf(b, sizeof(b), base == 16 ? "%lx" : "%lu", n);
+    return write(b);
+  }
+  size_t print(unsigned int n, int base = 10) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(double d, int digits = 2) {
+    char b[40];
+    snprintf(b, sizeof(b), "%.*f", digits, d);
+    return write(b);
+  }
+  size_t println(void) { return write("\r\n"); }
+  template <class T> size_t println(T t) { return print(t) + println(); }
+  template <class T> size_t println(T t, int x) {
+    return print(t, x) + println();
+  }
+  virtual void flush(void) {}
+};
+#endif // Print_h
@@ -0,0 +1,53 @@
+// A TwoWire that keeps every transmission instead of sending it
+#ifndef Wire_h
+#define Wire_h
+#include "Arduino.h"
+
+#define WIRE_LOG_MAX 64
+
+/** One transmission, from beginTransmission() to endTransmission() */
+struct WireTransfer {
+  uint8_t addr;
+  uint8_t len;
+  uint8_t data[32];
+};
+
+class TwoWire {
+public:
+  void begin(void) {}
+  void end(void) {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t addr) {
+    cur.addr = addr;
+    cur.len = 0;
+  }
+  size_t write(uint8_t b) {
+    if (cur.len >= sizeof(cur.data))
+      return 0;
+    cur.data[cur.len++] = b;
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t n) {
+    size_t r = 0;
+    while (n-- && write(*b++))
+      r++;
+    return r;
+  }
+  uint8_t endTransmission(bool = true) {
+    if (count < WIRE_LOG_MAX)
+      log[count] = cur;
+    count++;
+    return 0;
+  }
+  uint8_t requestFrom(uint8_t, uint8_t, uint8_t = 1) { return 0; }
+  int available(void) { return 0; }
+  int read(void) { return -1; }
+
+  WireTransfer log[WIRE_LOG_MAX]; ///< First WIRE_LOG_MAX transmissions
+  unsigned count = 0;             ///< Transmissions since last cleared
+
+private:
+  WireTransfer cur;
+};
+extern TwoWire Wire;
+#endif // Wire_h
@@ -49,6 +49,15 @@
 
 #define ZERO_FFT_MAX 4096 ///< the maximum allowed FFT size
 
+// ZeroFFT() and ZeroFFTReal() use a radix-4 kernel (with DSP instructions on
+// Cortex-M4). Uncomment to go back to the original radix-2 kernel.
+// #define ZERO_FFT_RADIX2
+
+#define ZERO_FFT_WINDOW_NONE 0     ///< no window (rectangular)
+#define ZERO_FFT_WINDOW_HANN 1     ///< periodic Hann window
+#define ZERO_FFT_WINDOW_HAMMING 2  ///< periodic Hamming window
+#define ZERO_FFT_WINDOW_BLACKMAN 3 ///< periodic Blackman window
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -67,6 +76,37 @@ extern "C" {
 /**************************************************************************/
 extern int ZeroFFT(q15_t *source, uint16_t length);
 
+/**************************************************************************/
+/*!
+    @brief  run an FFT on real-valued int16_t data, about twice as fast as
+   ZeroFFT() because it runs a length/2 complex FFT plus a split step. This
+   is run in place.
+    @param source the data to FFT. Must be 4-byte aligned (declare it ALIGN4)
+    @param length the length of the data. This must be a power of 2 from 32
+   to ZERO_FFT_MAX
+    @param window one of the ZERO_FFT_WINDOW_* values, applied to the input
+    @return 0 on success, -1 on failure
+    @note On return source holds complex bins 0 to length/2-1 as (real,
+   imaginary) pairs, scaled by 1/(2*length) like ZeroFFT(). Bins above
+   length/2 are the mirror image and are not stored. Bin 0 has no imaginary
+   part, so its place holds the real value of bin length/2 instead.
+*/
+/**************************************************************************/
+extern int ZeroFFTReal(q15_t *source, uint16_t length, uint8_t window);
+
+/**************************************************************************/
+/*!
+    @brief  apply a window to an int16_t array in place. Coefficients are
+   derived from the shared FFT cosine table, so no per-size window tables
+   are needed.
+    @param source the data to window
+    @param length the length of the data. This must be a power of 2 from 2
+   to ZERO_FFT_MAX
+    @param window one of the ZERO_FFT_WINDOW_* values
+*/
+/**************************************************************************/
+extern void ZeroFFTWindow(q15_t *source, uint16_t length, uint8_t window);
+
 extern const q15_t window_hanning_16[];   ///< a hanning window of length 16
 extern const q15_t window_hanning_32[];   ///< a hanning window of length 32
 extern const q15_t window_hanning_64[];   ///< a hanning window of length 64
@@ -0,0 +1,242 @@
+/*!
+ * @file Adafruit_ZeroSpectrum.cpp
+ *
+ * Streaming spectrum analyzer built on ZeroFFTReal().
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+
+#include "Adafruit_ZeroSpectrum.h"
+#include <math.h>
+#include <string.h>
+
+/**************************************************************************/
+/*!
+    @brief  create an analyzer; call begin() before use
+*/
+/**************************************************************************/
+Adafruit_ZeroSpectrum::Adafruit_ZeroSpectrum(void)
+    : history(NULL), work(NULL), frameLen(0), hop(0), pos(0), sinceFrame(0),
+      nBands(0), gainShift(0), magMode(ZERO_SPECTRUM_MAG_APPROX),
+      smoothShift(2), peakShift(4) {}
+
+// Frequency at fraction t (0 to 1) of the way from fMin to fMax on a scale
+static float bandFreq(float t, uint8_t scale, float fMin, float fMax) {
+  if (scale == ZERO_SPECTRUM_LINEAR)
+    return fMin + t * (fMax - fMin);
+  if (scale == ZERO_SPECTRUM_BARK) { // Traunmueller's Bark approximation
+    float zMin = 26.81 * fMin / (1960 + fMin) - 0.53,
+          zMax = 26.81 * fMax / (1960 + fMax) - 0.53,
+          z = zMin + t * (zMax - zMin);
+    return 1960 * (z + 0.53) / (26.28 - z);
+  }
+  return fMin * pow(fMax / fMin, t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  set up the analyzer
+    @param storage 2 * frameLen samples of caller-supplied memory, 4-byte
+    aligned (declare it ALIGN4). Must stay valid while the analyzer is used.
+    @param frameLen FFT size: a power of 2 from 32 to ZERO_FFT_MAX
+    @param overlap frames per frame length: 1 (no overlap), 2 (50%) or
+    4 (75%). A new frame is analyzed every frameLen / overlap samples.
+    @param sampleRateHz rate of the samples given to write()
+    @param nBands number of bands, 1 to ZERO_SPECTRUM_MAX_BANDS
+    @param scale band spacing: ZERO_SPECTRUM_LOG (octave or third-octave
+    bands, depending on nBands), ZERO_SPECTRUM_BARK or ZERO_SPECTRUM_LINEAR
+    @param fMin low edge of the lowest band, Hz
+    @param fMax high edge of the highest band, Hz. Capped just below half
+    the sample rate.
+    @return true on success, false if an argument is out of range or there
+    are too few FFT bins between fMin and fMax to give each band one
+*/
+/**************************************************************************/
+bool Adafruit_ZeroSpectrum::begin(q15_t *storage, uint16_t frameLen,
+                                  uint8_t overlap, uint16_t sampleRateHz,
+                                  uint8_t nBands, uint8_t scale,
+                                  uint16_t fMin, uint16_t fMax) {
+  this->nBands = 0; // Invalid until everything checks out
+  if (!storage || ((uintptr_t)storage & 3) || (frameLen < 32) ||
+      (frameLen > ZERO_FFT_MAX) || (frameLen & (frameLen - 1)) ||
+      ((overlap != 1) && (overlap != 2) && (overlap != 4)) || !sampleRateHz ||
+      !nBands || (nBands > ZERO_SPECTRUM_MAX_BANDS) || !fMin || (fMax <= fMin))
+    return false;
+
+  // Band edges as FFT bins. Each band gets at least one bin, so narrow low
+  // bands are pushed up; bins 0 (DC) and frameLen/2 are never used.
+  uint16_t maxBin = frameLen / 2;
+  float binHz = (float)sampleRateHz / frameLen;
+  for (uint8_t b = 0; b <= nBands; b++) {
+    float k = bandFreq((float)b / nBands, scale, fMin, fMax) / binHz + 0.5;
+    uint16_t e = (k < maxBin) ? (uint16_t)k : maxBin;
+    if (b == 0)
+      e = e ? e : 1;
+    else if (e <= edge[b - 1])
+      e = edge[b - 1] + 1;
+    edge[b] = e;
+  }
+  if (edge[nBands] > maxBin)
+    return false;
+
+  history = storage;
+  work = storage + frameLen;
+  this->frameLen = frameLen;
+  hop = frameLen / overlap;
+  this->nBands = nBands;
+  reset();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  forget all input and band history
+*/
+/**************************************************************************/
+void Adafruit_ZeroSpectrum::reset(void) {
+  if (history)
+    memset(history, 0, frameLen * sizeof(q15_t));
+  pos = 0;
+  sinceFrame = 0;
+  memset(bandLevel, 0, sizeof(bandLevel));
+  memset(bandPeak, 0, sizeof(bandPeak));
+}
+
+/**************************************************************************/
+/*!
+    @brief  feed samples to the analyzer. Every time a hop's worth of new
+    samples has arrived the latest frame is analyzed and the band levels and
+    peaks are updated, so this takes one FFT per hop and only a copy
+    otherwise.
+    @param samples the samples, e.g. a block from Adafruit_CPlay_Mic
+    readBlock() or from a WAV file
+    @param len the number of samples; any length works
+    @return the number of frames analyzed (0 if the bands did not change)
+*/
+/**************************************************************************/
+uint8_t Adafruit_ZeroSpectrum::write(const int16_t *samples, uint16_t len) {
+  uint8_t frames = 0;
+  if (!nBands)
+    return 0;
+
+  while (len) {
+    // Copy up to the next frame boundary or the end of the ring
+    uint16_t n = hop - sinceFrame;
+    if (n > frameLen - pos)
+      n = frameLen - pos;
+    if (n > len)
+      n = len;
+    memcpy(&history[pos], samples, n * sizeof(q15_t));
+    samples += n;
+    len -= n;
+    pos += n;
+    if (pos == frameLen)
+      pos = 0;
+    sinceFrame += n;
+    if (sinceFrame == hop) {
+      sinceFrame = 0;
+      frame();
+      if (frames < 255)
+        frames++;
+    }
+  }
+  return frames;
+}
+
+// Analyze the last frameLen samples written
+void Adafruit_ZeroSpectrum::frame(void) {
+  // Unroll the ring, oldest sample first
+  uint16_t older = frameLen - pos;
+  memcpy(work, &history[pos], older * sizeof(q15_t));
+  memcpy(&work[older], history, pos * sizeof(q15_t));
+
+  // Remove DC (it would leak into the low bins through the window) and
+  // apply the gain, saturating
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < frameLen; i++)
+    sum += work[i];
+  int32_t dc = sum / frameLen;
+  for (uint16_t i = 0; i < frameLen; i++) {
+    int32_t v = ((int32_t)work[i] - dc) << gainShift;
+    work[i] = (v > 32767) ? 32767 : (v < -32768) ? -32768 : v;
+  }
+
+  ZeroFFTReal(work, frameLen, ZERO_FFT_WINDOW_HANN);
+
+  uint16_t k = edge[0];
+  for (uint8_t b = 0; b < nBands; b++) {
+    uint32_t total = 0;
+    for (; k < edge[b + 1]; k++) {
+      int32_t re = work[2 * k], im = work[2 * k + 1];
+      if (magMode == ZERO_SPECTRUM_MAG_SQRT) {
+        total += isqrt((uint32_t)(re * re) + (uint32_t)(im * im));
+      } else {
+        // max(hi, 7/8 hi + 1/2 lo): within 3% of the true magnitude
+        uint32_t hi = re < 0 ? -re : re, lo = im < 0 ? -im : im;
+        if (lo > hi) {
+          uint32_t t = hi;
+          hi = lo;
+          lo = t;
+        }
+        uint32_t m = hi - (hi >> 3) + (lo >> 1);
+        total += (m > hi) ? m : hi;
+      }
+    }
+    uint16_t now = (total > 0xFFFF) ? 0xFFFF : total;
+
+    uint16_t lvl = bandLevel[b];
+    if (now >= lvl)
+      lvl = now; // Instant attack
+    else
+      lvl -= (uint16_t)((lvl - now + (1 << smoothShift) - 1) >> smoothShift);
+    bandLevel[b] = lvl;
+
+    uint16_t pk = bandPeak[b];
+    pk -= (pk + (1 << peakShift) - 1) >> peakShift;
+    bandPeak[b] = (pk > lvl) ? pk : lvl;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  log scale for visualizers: 16 * log2(v), with the fraction
+    linearly interpolated
+    @param v a level() or peak() value
+    @return 0 (for 0 or 1) to 255 (for 65535); 16 steps per doubling, so
+    each step is about 0.38 dB
+*/
+/**************************************************************************/
+uint8_t Adafruit_ZeroSpectrum::log8(uint16_t v) {
+  if (v < 2)
+    return 0;
+  uint8_t e = 15;
+  while (!(v & 0x8000)) { // Normalize, MSB at bit 15
+    v <<= 1;
+    e--;
+  }
+  return (e << 4) | ((v >> 11) & 15);
+}
+
+/**************************************************************************/
+/*!
+    @brief  integer square root
+    @param v the value
+    @return floor(sqrt(v))
+*/
+/**************************************************************************/
+uint16_t Adafruit_ZeroSpectrum::isqrt(uint32_t v) {
+  uint32_t root = 0, bit = 1UL << 30;
+  while (bit > v)
+    bit >>= 2;
+  while (bit) {
+    if (v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
@@ -0,0 +1,131 @@
+/*!
+ * @file Adafruit_ZeroSpectrum.h
+ *
+ * Streaming spectrum analyzer built on ZeroFFTReal(). Samples are pushed in
+ * blocks of any length; every hop (a half or a quarter of a frame) the most
+ * recent frame is windowed and transformed, and the bin magnitudes are
+ * summed into log-spaced or Bark bands with averaging and peak decay, ready
+ * for an LED or GFX visualizer. Uses only integer math after begin() and
+ * has no hardware dependencies.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+
+#ifndef ADAFRUIT_ZEROFFT_ADAFRUIT_ZEROSPECTRUM_H_
+#define ADAFRUIT_ZEROFFT_ADAFRUIT_ZEROSPECTRUM_H_
+
+#include "Adafruit_ZeroFFT.h"
+
+#define ZERO_SPECTRUM_MAX_BANDS 32 ///< the most bands begin() accepts
+
+#define ZERO_SPECTRUM_LOG 0    ///< bands equally spaced in log frequency
+#define ZERO_SPECTRUM_BARK 1   ///< bands equally spaced on the Bark scale
+#define ZERO_SPECTRUM_LINEAR 2 ///< bands equally spaced in frequency
+
+#define ZERO_SPECTRUM_MAG_APPROX 0 ///< alpha-max-beta-min magnitude, ~3% error
+#define ZERO_SPECTRUM_MAG_SQRT 1   ///< exact integer square root magnitude
+
+/**************************************************************************/
+/*!
+    @brief  Overlapping-frame spectrum analyzer with band aggregation
+*/
+/**************************************************************************/
+class Adafruit_ZeroSpectrum {
+public:
+  Adafruit_ZeroSpectrum(void);
+
+  bool begin(q15_t *storage, uint16_t frameLen, uint8_t overlap,
+             uint16_t sampleRateHz, uint8_t nBands, uint8_t scale,
+             uint16_t fMin, uint16_t fMax);
+  uint8_t write(const int16_t *samples, uint16_t len);
+  void reset(void);
+
+  /**************************************************************************/
+  /*!
+      @brief  set the input gain, applied (with saturation) before the FFT.
+      ZeroFFTReal() scales its output by 1/(2 * frameLen), so quiet sources
+      such as the Circuit Playground microphone need a few bits of gain.
+      @param shift left shift of each sample, 0 to 15
+  */
+  /**************************************************************************/
+  void setGain(uint8_t shift) { gainShift = shift > 15 ? 15 : shift; }
+
+  /**************************************************************************/
+  /*!
+      @brief  set how bin magnitudes are computed
+      @param mode ZERO_SPECTRUM_MAG_APPROX or ZERO_SPECTRUM_MAG_SQRT
+  */
+  /**************************************************************************/
+  void setMagnitude(uint8_t mode) { magMode = mode; }
+
+  /**************************************************************************/
+  /*!
+      @brief  set the band time constants, in frames (hops). Levels rise at
+      once and fall by 1/2^avgShift of the difference each frame; peaks
+      fall by 1/2^decayShift of themselves each frame.
+      @param avgShift level smoothing, 0 for none
+      @param decayShift peak decay, 0 to drop peaks straight to the level
+  */
+  /**************************************************************************/
+  void setSmoothing(uint8_t avgShift, uint8_t decayShift) {
+    smoothShift = avgShift;
+    peakShift = decayShift;
+  }
+
+  /**************************************************************************/
+  /*!
+      @brief  the number of bands set by begin()
+      @return band count
+  */
+  /**************************************************************************/
+  uint8_t bands(void) const { return nBands; }
+
+  /**************************************************************************/
+  /*!
+      @brief  the smoothed level of a band
+      @param band band index, lowest frequency first
+      @return sum of the band's bin magnitudes, in ZeroFFTReal() units
+  */
+  /**************************************************************************/
+  uint16_t level(uint8_t band) const {
+    return band < nBands ? bandLevel[band] : 0;
+  }
+
+  /**************************************************************************/
+  /*!
+      @brief  the decaying peak of a band
+      @param band band index, lowest frequency first
+      @return peak level, never below level(band)
+  */
+  /**************************************************************************/
+  uint16_t peak(uint8_t band) const {
+    return band < nBands ? bandPeak[band] : 0;
+  }
+
+  /**************************************************************************/
+  /*!
+      @brief  the lowest FFT bin in a band
+      @param band band index, 0 to bands(); bands() gives the end of the last
+      @return bin index; frequency is FFT_BIN(index, sampleRateHz, frameLen)
+  */
+  /**************************************************************************/
+  uint16_t bandStart(uint8_t band) const {
+    return band <= nBands ? edge[band] : 0;
+  }
+
+  static uint8_t log8(uint16_t v);
+  static uint16_t isqrt(uint32_t v);
+
+private:
+  q15_t *history, *work;
+  uint16_t frameLen, hop, pos, sinceFrame;
+  uint8_t nBands, gainShift, magMode, smoothShift, peakShift;
+  uint16_t edge[ZERO_SPECTRUM_MAX_BANDS + 1];
+  uint16_t bandLevel[ZERO_SPECTRUM_MAX_BANDS];
+  uint16_t bandPeak[ZERO_SPECTRUM_MAX_BANDS];
+
+  void frame(void);
+};
+
+#endif /* ADAFRUIT_ZEROFFT_ADAFRUIT_ZEROSPECTRUM_H_ */
@@ -0,0 +1,71 @@
+/* This example times the two FFT kernels inside ZeroFFT: the radix-4 one
+ * it uses by default (with DSP instructions on Cortex-M4 boards such as
+ * the SAMD51) and the original radix-2 one.
+ *
+ * For each complex FFT size from 64 to 4096 points it runs both on the
+ * same test signal and prints microseconds per FFT, including the bit
+ * reversal, and the CPU cycles that works out to.
+ */
+
+#include "Adafruit_ZeroFFT.h"
+
+#define POINTS 4096 // the largest size the tables cover
+#define REPS 10
+
+extern "C" {
+void arm_bitreversal_q15(q15_t *pSrc16, uint32_t fftLen, uint16_t bitRevFactor,
+                         uint16_t *pBitRevTab);
+void arm_radix2_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
+                              uint16_t twidCoefModifier);
+void zero_radix4_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
+                               uint16_t twidCoefModifier);
+}
+
+typedef void (*Kernel)(q15_t *, uint32_t, q15_t *, uint16_t);
+
+q15_t ALIGN4 data[2 * POINTS]; // (real, imaginary) pairs
+
+// Microseconds per FFT of size points with kernel
+uint32_t timeKernel(Kernel kernel, uint16_t points) {
+  uint16_t mod = POINTS / points;
+  uint32_t total = 0, t;
+  for (uint8_t r = 0; r < REPS; r++) {
+    for (uint16_t i = 0; i < points; i++) { // a tone, 1/16 of the way up
+      data[2 * i] = 8000 * cos(2 * PI * i / 16);
+      data[2 * i + 1] = 8000 * sin(2 * PI * i / 16);
+    }
+    t = micros();
+    kernel(data, points, (q15_t *)twiddleCoefQ15, mod);
+    arm_bitreversal_q15(data, points, mod,
+                        (uint16_t *)&armBitRevTable[mod - 1]);
+    total += micros() - t;
+  }
+  return total / REPS;
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    ; // wait for serial to be ready
+
+  Serial.println("points\tradix-2 us (cycles)\tradix-4 us (cycles)");
+  for (uint16_t points = 64; points <= POINTS; points *= 2) {
+    uint32_t radix2 = timeKernel(arm_radix2_butterfly_q15, points);
+    uint32_t radix4 = timeKernel(zero_radix4_butterfly_q15, points);
+
+    Serial.print(points);
+    Serial.print('\t');
+    Serial.print(radix2);
+    Serial.print(" (");
+    Serial.print(radix2 * (F_CPU / 1000000));
+    Serial.print(")\t\t");
+    Serial.print(radix4);
+    Serial.print(" (");
+    Serial.print(radix4 * (F_CPU / 1000000));
+    Serial.println(")");
+  }
+}
+
+void loop() {
+  // don't even do anything
+}
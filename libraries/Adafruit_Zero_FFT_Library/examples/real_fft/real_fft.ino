@@ -0,0 +1,87 @@
+/* This example compares ZeroFFT() with ZeroFFTReal(), the real-input FFT.
+ *
+ * For each FFT size it times both on the same test signal (a 1000hz sine
+ * wave sampled at 8000hz) and prints microseconds per FFT, the CPU cycles
+ * that works out to, and which bin each one found the peak in.
+ *
+ * ZeroFFTReal() also lets you pick the window; try the others below.
+ */
+
+#include "Adafruit_ZeroFFT.h"
+
+#define FS 8000
+#define TONE_HZ 1000
+#define WINDOW ZERO_FFT_WINDOW_HANN // or _NONE, _HAMMING, _BLACKMAN
+#define REPS 10
+
+q15_t ALIGN4 data[2048]; // ZeroFFTReal() needs 4-byte aligned input
+
+void fillSignal(uint16_t size) {
+  for (uint16_t i = 0; i < size; i++)
+    data[i] = 8000 * sin(2 * PI * TONE_HZ * i / FS);
+}
+
+// Index of the largest bin; ZeroFFTReal() output is (real, imaginary) pairs
+uint16_t peakBin(uint16_t size, bool complexPairs) {
+  uint16_t best = 1;
+  int32_t bestMag = 0;
+  for (uint16_t k = 1; k < size / 2; k++) {
+    int32_t mag;
+    if (complexPairs)
+      mag = (int32_t)data[2 * k] * data[2 * k] +
+            (int32_t)data[2 * k + 1] * data[2 * k + 1];
+    else
+      mag = (int32_t)data[k] * data[k];
+    if (mag > bestMag) {
+      bestMag = mag;
+      best = k;
+    }
+  }
+  return best;
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    ; // wait for serial to be ready
+
+  Serial.println("size\tZeroFFT us (cycles)\tZeroFFTReal us (cycles)\tpeak Hz");
+  for (uint16_t size = 64; size <= 2048; size *= 2) {
+    uint32_t complexTime = 0, realTime = 0, t;
+    uint16_t complexPeak, realPeak;
+
+    for (uint8_t r = 0; r < REPS; r++) {
+      fillSignal(size);
+      t = micros();
+      ZeroFFT(data, size);
+      complexTime += micros() - t;
+    }
+    complexPeak = peakBin(size, false);
+
+    for (uint8_t r = 0; r < REPS; r++) {
+      fillSignal(size);
+      t = micros();
+      ZeroFFTReal(data, size, WINDOW);
+      realTime += micros() - t;
+    }
+    realPeak = peakBin(size, true);
+
+    Serial.print(size);
+    Serial.print('\t');
+    Serial.print(complexTime / REPS);
+    Serial.print(" (");
+    Serial.print(complexTime / REPS * (F_CPU / 1000000));
+    Serial.print(")\t\t");
+    Serial.print(realTime / REPS);
+    Serial.print(" (");
+    Serial.print(realTime / REPS * (F_CPU / 1000000));
+    Serial.print(")\t\t");
+    Serial.print(FFT_BIN(complexPeak, FS, size));
+    Serial.print(" / ");
+    Serial.println(FFT_BIN(realPeak, FS, size));
+  }
+}
+
+void loop() {
+  // don't even do anything
+}
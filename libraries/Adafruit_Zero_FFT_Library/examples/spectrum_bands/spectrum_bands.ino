@@ -0,0 +1,80 @@
+/* This example turns a Circuit Playground Express into a 10 band spectrum
+ * analyzer, one NeoPixel per band.
+ *
+ * The microphone streams in the background, and every block goes to an
+ * Adafruit_ZeroSpectrum. That analyzes a 512 sample frame every 128
+ * samples (75% overlap, about 170 frames a second) and sums the FFT bins
+ * into 10 log-spaced bands from 100hz to 8000hz. Each pixel's color shows
+ * its band's level; the peaks are printed for the serial plotter.
+ */
+
+#include <Adafruit_CircuitPlayground.h>
+#include "Adafruit_ZeroSpectrum.h"
+
+#define FS 22000 // Circuit Playground Express microphone rate
+#define FRAME_LEN 512
+#define OVERLAP 4 // New frame every FRAME_LEN / OVERLAP samples
+#define NUM_BANDS 10
+#define FREQ_MIN 100
+#define FREQ_MAX 8000
+#define GAIN_SHIFT 5 // Microphone samples are small; boost before the FFT
+#define FLOOR 60     // log8() level that shows as black
+
+#define NUM_BLOCKS 4
+#define BLOCK_LEN 128
+
+int16_t blocks[NUM_BLOCKS * BLOCK_LEN];
+q15_t ALIGN4 spectrumStorage[2 * FRAME_LEN];
+Adafruit_ZeroSpectrum spectrum;
+
+void setup() {
+  CircuitPlayground.begin();
+  Serial.begin(115200);
+  if (!spectrum.begin(spectrumStorage, FRAME_LEN, OVERLAP, FS, NUM_BANDS,
+                      ZERO_SPECTRUM_LOG, FREQ_MIN, FREQ_MAX) ||
+      !CircuitPlayground.mic.startStream(blocks, NUM_BLOCKS, BLOCK_LEN)) {
+    Serial.println("Spectrum setup failed");
+    while (1)
+      ;
+  }
+  spectrum.setGain(GAIN_SHIFT);
+  spectrum.setSmoothing(3, 5);
+}
+
+void loop() {
+  const int16_t *block = CircuitPlayground.mic.readBlock();
+  if (!block)
+    return;
+  uint8_t frames = spectrum.write(block, BLOCK_LEN);
+  CircuitPlayground.mic.releaseBlock();
+  if (!frames)
+    return;
+
+  for (uint8_t b = 0; b < NUM_BANDS; b++) {
+    uint8_t l = Adafruit_ZeroSpectrum::log8(spectrum.level(b));
+    l = (l > FLOOR) ? map(l, FLOOR, 255, 0, 255) : 0;
+    CircuitPlayground.strip.setPixelColor(b, Wheel(l));
+  }
+  CircuitPlayground.strip.show();
+
+  // Print peaks a few times a second, lowest band first
+  static uint32_t lastPrint = 0;
+  if (millis() - lastPrint >= 100) {
+    lastPrint = millis();
+    for (uint8_t b = 0; b < NUM_BANDS; b++) {
+      Serial.print(Adafruit_ZeroSpectrum::log8(spectrum.peak(b)));
+      Serial.print(b < NUM_BANDS - 1 ? ' ' : '\n');
+    }
+  }
+}
+
+// Input a value 0 to 255 to get a color value: black, then blue through
+// green to red as the level rises
+uint32_t Wheel(byte level) {
+  if (level == 0)
+    return 0;
+  if (level < 128)
+    return CircuitPlayground.strip.Color(0, level * 2, 255 - level * 2);
+  level -= 128;
+  return CircuitPlayground.strip.Color(level * 2, 255 - level * 2, 0);
+}
@@ -0,0 +1,172 @@
+// Checks zero_radix4_butterfly_q15() against arm_radix2_butterfly_q15(),
+// the kernel it replaced, and a double precision DFT.  For every length
+// from 16 to 4096 complex points, on noise, tones, an impulse and full
+// scale DC, both kernels (each followed by arm_bitreversal_q15()) must
+// match the DFT scaled by 1/(2 * length), and radix-4 must do no worse
+// than radix-2.
+//
+// Built twice: with the portable C helpers, and as radix4-dsp with
+// __ARM_FEATURE_DSP set and the Cortex-M4 instructions done in C by
+// stubs/Arduino.h.  With -s it prints only a checksum of every radix-4
+// output, which must be the same for both builds.
+//
+// Prints the worst error in counts for each length and kernel and the
+// number of failures, and exits non-zero if there were any.  With -b it
+// times both kernels from 64 to 4096 points instead.
+//
+// Usage: radix4 [-s | -b]
+#include <chrono>
+
+#include <Adafruit_ZeroFFT.h>
+
+extern "C" {
+void arm_bitreversal_q15(q15_t *pSrc16, uint32_t fftLen, uint16_t bitRevFactor,
+                         uint16_t *pBitRevTab);
+void arm_radix2_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
+                              uint16_t twidCoefModifier);
+void zero_radix4_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
+                               uint16_t twidCoefModifier);
+}
+
+#define POINTS 4096 // the most the twiddle and bit reversal tables cover
+// Radix-2 drops two bits going into its first stage, so it is allowed more
+#define RADIX4_TOLERANCE 5 // counts
+#define RADIX2_TOLERANCE 10 // counts
+
+typedef void (*Kernel)(q15_t *, uint32_t, q15_t *, uint16_t);
+
+static int bad = 0;
+
+static void fail(const char *what, int n, int kind) {
+  if (bad++ < 20)
+    printf("%s (%d points, signal %d)\n", what, n, kind);
+}
+
+static q15_t ALIGN4 input[2 * POINTS], data[2 * POINTS];
+
+static void fill(int n, int kind) {
+  for (int i = 0; i < n; i++) {
+    double re = 0, im = 0;
+    switch (kind) {
+    case 0: // noise
+      re = (double)rand() / RAND_MAX * 65535 - 32768;
+      im = (double)rand() / RAND_MAX * 65535 - 32768;
+      break;
+    case 1: // a tone between bins
+      re = 32000 * cos(2 * M_PI * 7.4 * i / n);
+      im = 32000 * sin(2 * M_PI * 7.4 * i / n);
+      break;
+    case 2: // a loud and a quiet tone on bins
+      re = 20000 * cos(2 * M_PI * 3 * i / n) + 200 * cos(2 * M_PI * i / 3);
+      im = -12000 * sin(2 * M_PI * (n / 4 + 1) * i / n);
+      break;
+    case 3: // impulse
+      re = i == 1 ? 32767 : 0;
+      im = i == 1 ? -32768 : 0;
+      break;
+    case 4: // DC, full scale
+      re = im = -32768;
+      break;
+    }
+    input[2 * i] = lround(fmax(fmin(re, 32767), -32768));
+    input[2 * i + 1] = lround(fmax(fmin(im, 32767), -32768));
+  }
+}
+
+static void run(Kernel kernel, int n) {
+  uint16_t mod = POINTS / n;
+  memcpy(data, input, 2 * n * sizeof(q15_t));
+  kernel(data, n, (q15_t *)twiddleCoefQ15, mod);
+  arm_bitreversal_q15(data, n, mod, (uint16_t *)&armBitRevTable[mod - 1]);
+}
+
+// worst difference between data and the DFT of input
+static double error(int n) {
+  static double c[POINTS], s[POINTS];
+  for (int i = 0; i < n; i++) {
+    c[i] = cos(2 * M_PI * i / n);
+    s[i] = sin(2 * M_PI * i / n);
+  }
+  double worst = 0;
+  for (int k = 0; k < n; k++) {
+    double re = 0, im = 0;
+    for (int i = 0, p = 0; i < n; i++, p = (p + k) & (n - 1)) {
+      re += input[2 * i] * c[p] + input[2 * i + 1] * s[p];
+      im += input[2 * i + 1] * c[p] - input[2 * i] * s[p];
+    }
+    worst = fmax(worst, fmax(fabs(data[2 * k] - re / (2 * n)),
+                             fabs(data[2 * k + 1] - im / (2 * n))));
+  }
+  return worst;
+}
+
+static void compare(void) {
+  for (int n = 16; n <= POINTS; n *= 2) {
+    double worst2 = 0, worst4 = 0;
+    for (int kind = 0; kind < 5; kind++) {
+      fill(n, kind);
+      run(arm_radix2_butterfly_q15, n);
+      double e2 = error(n);
+      run(zero_radix4_butterfly_q15, n);
+      double e4 = error(n);
+      if (e2 > RADIX2_TOLERANCE)
+        fail("radix-2 differs from the DFT", n, kind);
+      if (e4 > RADIX4_TOLERANCE)
+        fail("radix-4 differs from the DFT", n, kind);
+      if (e4 > e2 + 1)
+        fail("radix-4 worse than radix-2", n, kind);
+      worst2 = fmax(worst2, e2);
+      worst4 = fmax(worst4, e4);
+    }
+    printf("%4d: worst error radix-2 %.2f, radix-4 %.2f counts\n", n, worst2,
+           worst4);
+  }
+}
+
+// FNV-1a of the radix-4 output for every length and signal
+static uint32_t checksum(void) {
+  uint32_t h = 2166136261u;
+  for (int n = 16; n <= POINTS; n *= 2)
+    for (int kind = 0; kind < 5; kind++) {
+      fill(n, kind);
+      run(zero_radix4_butterfly_q15, n);
+      const uint8_t *b = (const uint8_t *)data;
+      for (size_t i = 0; i < 2 * n * sizeof(q15_t); i++)
+        h = (h ^ b[i]) * 16777619u;
+    }
+  return h;
+}
+
+// nanoseconds per transform, butterflies and bit reversal
+static double timed(Kernel kernel, int n) {
+  using namespace std::chrono;
+  int reps = 4000000 / n;
+  fill(n, 0);
+  auto t = steady_clock::now();
+  for (int r = 0; r < reps; r++)
+    run(kernel, n);
+  return (double)duration_cast<nanoseconds>(steady_clock::now() - t).count() /
+         reps;
+}
+
+static void bench(void) {
+  printf("points  radix-2 ns  radix-4 ns\n");
+  for (int n = 64; n <= POINTS; n *= 2)
+    printf("%6d  %10.0f  %10.0f\n", n, timed(arm_radix2_butterfly_q15, n),
+           timed(zero_radix4_butterfly_q15, n));
+}
+
+int main(int argc, char **argv) {
+  srand(1);
+  if (argc > 1 && !strcmp(argv[1], "-s")) {
+    printf("%08x\n", checksum());
+    return 0;
+  }
+  if (argc > 1 && !strcmp(argv[1], "-b")) {
+    bench();
+    return 0;
+  }
+  compare();
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
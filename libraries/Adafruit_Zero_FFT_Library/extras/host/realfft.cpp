@@ -0,0 +1,199 @@
+// Checks ZeroFFTWindow() and ZeroFFTReal() against double precision.
+// ZeroFFTWindow() must scale each sample by the periodic Hann, Hamming or
+// Blackman weight to within the rounding of Q15 arithmetic, and leave
+// the data alone for no window or a bad length.  ZeroFFTReal() must refuse
+// bad lengths and unaligned data without touching it, give exactly what
+// ZeroFFTWindow() followed by an unwindowed ZeroFFTReal() gives, and match
+// a plain DFT scaled by 1/(2 * length) for noise, tones, an impulse, DC and
+// a full scale square wave, at every size from 32 to ZERO_FFT_MAX.
+//
+// Prints the worst error in counts for each size and the number of
+// failures, and exits non-zero if there were any.  With -b it times
+// ZeroFFT(), ZeroFFTWindow() and ZeroFFTReal() for each size instead.
+//
+// Usage: realfft [-b]
+#include <chrono>
+
+#include <Adafruit_ZeroFFT.h>
+
+// The cosine table rounds, and the weight and the product truncate
+#define WINDOW_TOLERANCE 3 // counts
+// The butterflies truncate at every stage and the split step twice more
+#define FFT_TOLERANCE 5 // counts
+
+static int bad = 0;
+
+static void fail(const char *what, int size, int i) {
+  if (bad++ < 20)
+    printf("%s (size %d, %d)\n", what, size, i);
+}
+
+static double weight(int i, int n, int window) {
+  double c = cos(2 * M_PI * i / n);
+  switch (window) {
+  case ZERO_FFT_WINDOW_HANN:
+    return 0.5 - 0.5 * c;
+  case ZERO_FFT_WINDOW_HAMMING:
+    return 0.54 - 0.46 * c;
+  case ZERO_FFT_WINDOW_BLACKMAN:
+    return 0.42 - 0.5 * c + 0.08 * cos(4 * M_PI * i / n);
+  }
+  return 1;
+}
+
+static q15_t ALIGN4 data[ZERO_FFT_MAX + 2], copy[ZERO_FFT_MAX + 2];
+
+static void windows(void) {
+  for (int n = 2; n <= ZERO_FFT_MAX; n *= 2)
+    for (int w = ZERO_FFT_WINDOW_NONE; w <= ZERO_FFT_WINDOW_BLACKMAN; w++) {
+      for (int i = 0; i < n; i++)
+        data[i] = copy[i] = i % 3 ? rand() - RAND_MAX / 2 : (i & 1) - 32768;
+      ZeroFFTWindow(data, n, w);
+      for (int i = 0; i < n; i++)
+        if (fabs(data[i] - copy[i] * weight(i, n, w)) > WINDOW_TOLERANCE) {
+          fail("window weight", n, i);
+          break;
+        }
+    }
+  static const int wrong[] = {0, 1, 3, 48, ZERO_FFT_MAX + 1};
+  for (int n : wrong) {
+    for (int i = 0; i < ZERO_FFT_MAX + 1; i++)
+      data[i] = copy[i] = rand();
+    ZeroFFTWindow(data, n, ZERO_FFT_WINDOW_HANN);
+    if (memcmp(data, copy, sizeof(data)))
+      fail("ZeroFFTWindow() changed data for a bad length", n, 0);
+  }
+}
+
+static void refused(void) {
+  static const int wrong[] = {0, 16, 48, 1000, ZERO_FFT_MAX * 2};
+  for (int i = 0; i < ZERO_FFT_MAX + 2; i++)
+    data[i] = copy[i] = rand();
+  for (int n : wrong)
+    if (ZeroFFTReal(data, n, ZERO_FFT_WINDOW_HANN) != -1)
+      fail("ZeroFFTReal() took a bad length", n, 0);
+  if (ZeroFFTReal(data + 1, 64, ZERO_FFT_WINDOW_HANN) != -1)
+    fail("ZeroFFTReal() took unaligned data", 64, 0);
+  if (memcmp(data, copy, sizeof(data)))
+    fail("ZeroFFTReal() changed data it refused", 0, 0);
+}
+
+static void fill(int n, int kind) {
+  for (int i = 0; i < n; i++) {
+    double v = 0;
+    switch (kind) {
+    case 0: // noise
+      v = (double)rand() / RAND_MAX * 65535 - 32768;
+      break;
+    case 1: // a tone between bins
+      v = 30000 * sin(2 * M_PI * 5.3 * i / n + 1);
+      break;
+    case 2: // a loud and a quiet tone on bins
+      v = 20000 * cos(2 * M_PI * (n / 8) * i / n) +
+          300 * sin(2 * M_PI * (n / 2 - 3) * i / n);
+      break;
+    case 3: // impulse
+      v = i == 3 ? 32767 : 0;
+      break;
+    case 4: // DC
+      v = -32768;
+      break;
+    case 5: // square, full scale
+      v = i & 4 ? 32767 : -32768;
+      break;
+    }
+    data[i] = lround(fmax(fmin(v, 32767), -32768));
+  }
+}
+
+// ZeroFFTReal() of data as it is now against a DFT of the same samples
+static double accuracy(int n, int kind) {
+  static double re[ZERO_FFT_MAX / 2 + 1], im[ZERO_FFT_MAX / 2 + 1],
+      c[ZERO_FFT_MAX], s[ZERO_FFT_MAX];
+  for (int i = 0; i < n; i++) {
+    c[i] = cos(2 * M_PI * i / n);
+    s[i] = sin(2 * M_PI * i / n);
+  }
+  for (int k = 0; k <= n / 2; k++) {
+    double r = 0, j = 0;
+    for (int i = 0, p = 0; i < n; i++, p = (p + k) & (n - 1)) {
+      r += data[i] * c[p];
+      j -= data[i] * s[p];
+    }
+    re[k] = r / (2 * n);
+    im[k] = j / (2 * n);
+  }
+  if (ZeroFFTReal(data, n, ZERO_FFT_WINDOW_NONE)) {
+    fail("ZeroFFTReal() failed", n, kind);
+    return 0;
+  }
+  double worst = fmax(fabs(data[0] - re[0]), fabs(data[1] - re[n / 2]));
+  for (int k = 1; k < n / 2; k++)
+    worst = fmax(worst, fmax(fabs(data[2 * k] - re[k]),
+                             fabs(data[2 * k + 1] - im[k])));
+  return worst;
+}
+
+static void transforms(void) {
+  for (int n = 32; n <= ZERO_FFT_MAX; n *= 2) {
+    double worst = 0;
+    for (int kind = 0; kind < 6; kind++) {
+      fill(n, kind);
+      double e = accuracy(n, kind);
+      if (e > FFT_TOLERANCE)
+        fail("ZeroFFTReal() differs from the DFT", n, kind);
+      worst = fmax(worst, e);
+    }
+    // the window is just ZeroFFTWindow() first
+    for (int w = ZERO_FFT_WINDOW_HANN; w <= ZERO_FFT_WINDOW_BLACKMAN; w++) {
+      fill(n, 0);
+      memcpy(copy, data, n * sizeof(q15_t));
+      ZeroFFTReal(data, n, w);
+      ZeroFFTWindow(copy, n, w);
+      ZeroFFTReal(copy, n, ZERO_FFT_WINDOW_NONE);
+      if (memcmp(data, copy, n * sizeof(q15_t)))
+        fail("windowed ZeroFFTReal() differs from ZeroFFTWindow() first", n,
+             w);
+    }
+    printf("%4d: worst error %.2f counts\n", n, worst);
+  }
+}
+
+// nanoseconds per call of f on fresh noise
+template <typename F> static double timed(int n, F f) {
+  using namespace std::chrono;
+  int reps = 2000000 / n;
+  nanoseconds total(0);
+  for (int r = 0; r < reps; r++) {
+    fill(n, 0);
+    auto t = steady_clock::now();
+    f();
+    total += steady_clock::now() - t;
+  }
+  return (double)total.count() / reps;
+}
+
+static void bench(void) {
+  printf("size  ZeroFFT ns  ZeroFFTWindow ns  ZeroFFTReal ns\n");
+  for (int n = 32; n <= ZERO_FFT_MAX; n *= 2) {
+    // ZeroFFT() needs room for the imaginary parts, so stops at half
+    double full = n < ZERO_FFT_MAX ? timed(n, [=] { ZeroFFT(data, n); }) : 0,
+           window =
+               timed(n, [=] { ZeroFFTWindow(data, n, ZERO_FFT_WINDOW_HANN); }),
+           real = timed(n, [=] { ZeroFFTReal(data, n, ZERO_FFT_WINDOW_HANN); });
+    printf("%4d  %10.0f  %16.0f  %14.0f\n", n, full, window, real);
+  }
+}
+
+int main(int argc, char **argv) {
+  srand(1);
+  if (argc > 1 && !strcmp(argv[1], "-b")) {
+    bench();
+    return 0;
+  }
+  windows();
+  refused();
+  transforms();
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
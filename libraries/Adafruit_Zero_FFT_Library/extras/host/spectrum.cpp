@@ -0,0 +1,309 @@
+// Runs Adafruit_ZeroSpectrum on a wave file.  With just the file it prints
+// the bands of each frame as a row of characters, quiet to loud, the way a
+// visualizer would show them.
+//
+// With the tone list made by tones.py as well it checks the analyzer: for
+// log, Bark and linear bands at three frame sizes and overlaps, samples
+// are written in blocks of random length and every frame's band levels
+// must match a double precision DFT of the same samples, summed over the
+// band's bins, with the exact and the approximate magnitudes.  While a
+// tone plays the loudest band must be the one holding it.  Levels and
+// peaks with smoothing must follow an integer model of the attack and
+// decay, and writing the whole file at once must leave the same bands.
+// Also checks begin() refuses bad arguments, isqrt() and log8().
+//
+// Prints the worst level error for each setup, beyond the 1% allowed for
+// rounding, and the number of failures, and exits non-zero if there were
+// any.
+//
+// Usage: spectrum <wave> [<tones>]
+#include <Adafruit_ZeroSpectrum.h>
+
+#include <vector>
+
+// Every bin's real and imaginary parts may be a few counts out, and the
+// square root rounds down
+#define BIN_TOLERANCE 4 // counts per bin in the band
+#define TOLERANCE 0.01  // of the level
+// Alpha-max-beta-min is within 3% either way
+#define APPROX_TOLERANCE 0.03
+
+static int bad = 0;
+
+static void fail(const char *what, long i) {
+  if (bad++ < 20)
+    printf("%s (%ld)\n", what, i);
+}
+
+// The first channel of a 16-bit PCM wave file
+static bool readWave(const char *path, std::vector<int16_t> &samples,
+                     uint16_t &rate) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  std::vector<uint8_t> d;
+  for (int c; (c = fgetc(f)) >= 0;)
+    d.push_back(c);
+  fclose(f);
+  auto u16 = [&](size_t i) { return (uint16_t)(d[i] | d[i + 1] << 8); };
+  auto u32 = [&](size_t i) {
+    return (uint32_t)u16(i) | (uint32_t)u16(i + 2) << 16;
+  };
+  if (d.size() < 12 || memcmp(&d[0], "RIFF", 4) || memcmp(&d[8], "WAVE", 4))
+    return false;
+  uint16_t channels = 0;
+  for (size_t i = 12; i + 8 <= d.size(); i += 8 + ((u32(i + 4) + 1) & ~1UL)) {
+    uint32_t size = u32(i + 4);
+    if (i + 8 + size > d.size())
+      return false;
+    if (!memcmp(&d[i], "fmt ", 4)) {
+      if (size < 16 || u16(i + 8) != 1 || u16(i + 22) != 16)
+        return false; // not 16-bit PCM
+      channels = u16(i + 10);
+      rate = u32(i + 12);
+    } else if (!memcmp(&d[i], "data", 4) && channels) {
+      for (uint32_t k = 0; k + 2 * channels <= size; k += 2 * channels)
+        samples.push_back(u16(i + 8 + k));
+      return true;
+    }
+  }
+  return false;
+}
+
+static void show(const std::vector<int16_t> &samples, uint16_t rate) {
+  static q15_t ALIGN4 storage[2 * 512];
+  static const char shades[] = " .:-=+*#%@";
+  Adafruit_ZeroSpectrum s;
+  if (!s.begin(storage, 512, 2, rate, 24, ZERO_SPECTRUM_LOG, 50,
+               rate / 2 - 1)) {
+    puts("begin() failed");
+    return;
+  }
+  for (size_t i = 0; i + 256 <= samples.size(); i += 256) {
+    s.write(&samples[i], 256);
+    char row[ZERO_SPECTRUM_MAX_BANDS + 1];
+    for (uint8_t b = 0; b < s.bands(); b++)
+      row[b] = shades[Adafruit_ZeroSpectrum::log8(s.level(b)) * 10 / 256];
+    row[s.bands()] = 0;
+    printf("%7.2f |%s|\n", (double)(i + 256) / rate, row);
+  }
+}
+
+/** A tone from the list */
+struct Tone {
+  long first, samples;
+  double hz;
+};
+
+/** An analyzer setup to check */
+struct Setup {
+  uint16_t frameLen;
+  uint8_t overlap, bands, scale;
+  uint16_t fMin;
+};
+
+// |X[k]| / (2 * frameLen) of the frame ending at sample end, for bins up
+// to last, as the analyzer sees it: zeros before the start, the whole
+// counts of DC removed, saturating, and a periodic Hann window
+static void reference(const std::vector<int16_t> &x, long end, int n, int last,
+                      std::vector<double> &mag) {
+  std::vector<double> v(n);
+  long sum = 0;
+  for (int i = 0; i < n; i++) {
+    long t = end - n + i;
+    v[i] = t < 0 ? 0 : x[t];
+    sum += v[i];
+  }
+  for (int i = 0; i < n; i++)
+    v[i] = fmax(fmin(v[i] - sum / n, 32767), -32768) *
+           (0.5 - 0.5 * cos(2 * M_PI * i / n));
+  mag.assign(last + 1, 0);
+  for (int k = 1; k <= last; k++) {
+    double re = 0, im = 0;
+    for (int i = 0; i < n; i++) {
+      double a = 2 * M_PI * (long)k * i / n;
+      re += v[i] * cos(a);
+      im -= v[i] * sin(a);
+    }
+    mag[k] = hypot(re, im) / (2 * n);
+  }
+}
+
+static q15_t ALIGN4 storage[3][2 * 1024];
+
+static void check(const Setup &c, const std::vector<int16_t> &x, uint16_t rate,
+                  const std::vector<Tone> &tones) {
+  Adafruit_ZeroSpectrum exact, approx, smooth;
+  uint16_t fMax = rate / 2 - 1;
+  if (!exact.begin(storage[0], c.frameLen, c.overlap, rate, c.bands, c.scale,
+                   c.fMin, fMax) ||
+      !approx.begin(storage[1], c.frameLen, c.overlap, rate, c.bands, c.scale,
+                    c.fMin, fMax) ||
+      !smooth.begin(storage[2], c.frameLen, c.overlap, rate, c.bands, c.scale,
+                    c.fMin, fMax)) {
+    fail("begin() failed", c.frameLen);
+    return;
+  }
+  exact.setMagnitude(ZERO_SPECTRUM_MAG_SQRT);
+  exact.setSmoothing(0, 0);
+  approx.setSmoothing(0, 0);
+  smooth.setMagnitude(ZERO_SPECTRUM_MAG_SQRT);
+  smooth.setSmoothing(2, 4);
+
+  uint16_t hop = c.frameLen / c.overlap, last = exact.bandStart(c.bands) - 1;
+  for (uint8_t b = 0; b < c.bands; b++)
+    if (exact.bandStart(b + 1) <= exact.bandStart(b) || !exact.bandStart(0) ||
+        last >= c.frameLen / 2)
+      fail("band edges out of order or out of range", b);
+
+  double worst = 0;
+  long frames = 0;
+  uint16_t level[ZERO_SPECTRUM_MAX_BANDS] = {0};
+  uint16_t peak[ZERO_SPECTRUM_MAX_BANDS] = {0};
+  std::vector<double> mag;
+  for (long t = 0; t < (long)x.size();) {
+    // at most a hop, so a write analyzes at most one frame
+    uint16_t n = 1 + rand() % hop;
+    if (n > (long)x.size() - t)
+      n = x.size() - t;
+    uint8_t e = exact.write(&x[t], n), a = approx.write(&x[t], n),
+            s = smooth.write(&x[t], n);
+    long before = t / hop;
+    t += n;
+    if (e != t / hop - before || a != e || s != e)
+      fail("write() frame count", t);
+    if (!e)
+      continue;
+    frames++;
+    long end = t / hop * hop; // where the frame ended
+
+    reference(x, end, c.frameLen, last, mag);
+    int loudest = 0;
+    for (uint8_t b = 0; b < c.bands; b++) {
+      double want = 0;
+      uint16_t lo = exact.bandStart(b), hi = exact.bandStart(b + 1);
+      for (uint16_t k = lo; k < hi; k++)
+        want += mag[k];
+      double slack = TOLERANCE * want + BIN_TOLERANCE * (hi - lo);
+      double err = fabs(exact.level(b) - want);
+      worst = fmax(worst, fmax(err - TOLERANCE * want, 0) / (hi - lo));
+      if (err > slack)
+        fail("level differs from the DFT", end);
+      if (fabs(approx.level(b) - want) > APPROX_TOLERANCE * want + slack)
+        fail("approximate level out of range", end);
+      if (exact.level(b) > exact.level(loudest))
+        loudest = b;
+
+      // the model of smoothing, from this frame's exact level
+      uint16_t now = exact.level(b);
+      if (now >= level[b])
+        level[b] = now;
+      else
+        level[b] -= (level[b] - now + 3) >> 2;
+      peak[b] -= (peak[b] + 15) >> 4;
+      if (peak[b] < level[b])
+        peak[b] = level[b];
+      if (smooth.level(b) != level[b] || smooth.peak(b) != peak[b])
+        fail("smoothed level or peak differs from the model", t);
+    }
+
+    // while a tone plays the loudest band must hold it, or be next to it
+    // when the tone is within a bin of the edge between them
+    double binHz = (double)rate / c.frameLen;
+    for (const Tone &tone : tones) {
+      if (end - c.frameLen < tone.first || end > tone.first + tone.samples)
+        continue;
+      double k = tone.hz / binHz;
+      if (k < exact.bandStart(0) + 1 || k > last - 1)
+        break; // outside the bands
+      uint16_t lo = exact.bandStart(loudest), hi = exact.bandStart(loudest + 1);
+      if (k < lo - 1.5 || k > hi + 0.5)
+        fail("loudest band doesn't hold the tone", end);
+    }
+  }
+
+  // all at once, the largest blocks write() takes
+  Adafruit_ZeroSpectrum whole;
+  whole.begin(storage[0], c.frameLen, c.overlap, rate, c.bands, c.scale,
+              c.fMin, fMax);
+  whole.setMagnitude(ZERO_SPECTRUM_MAG_SQRT);
+  whole.setSmoothing(2, 4);
+  for (size_t t = 0; t < x.size(); t += 65535)
+    whole.write(&x[t], x.size() - t < 65535 ? x.size() - t : 65535);
+  for (uint8_t b = 0; b < c.bands; b++)
+    if (whole.level(b) != smooth.level(b) || whole.peak(b) != smooth.peak(b))
+      fail("one write() differs from many", b);
+
+  printf("%4u samples / %u, %2u bands: %ld frames, worst level error %.2f "
+         "counts a bin\n",
+         c.frameLen, c.overlap, c.bands, frames, worst);
+}
+
+static void arguments(void) {
+  Adafruit_ZeroSpectrum s;
+  if (s.begin(NULL, 256, 2, 16000, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0] + 1, 256, 2, 16000, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 16, 2, 16000, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 384, 2, 16000, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 256, 3, 16000, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 256, 2, 0, 8, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 256, 2, 16000, 0, ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 256, 2, 16000, ZERO_SPECTRUM_MAX_BANDS + 1,
+              ZERO_SPECTRUM_LOG, 50, 7000) ||
+      s.begin(storage[0], 256, 2, 16000, 8, ZERO_SPECTRUM_LOG, 7000, 50) ||
+      s.begin(storage[0], 32, 1, 16000, 20, ZERO_SPECTRUM_LOG, 50, 7000))
+    fail("begin() took a bad argument", 0);
+  if (s.bands() || s.write(storage[1], 100))
+    fail("analyzer works after begin() failed", 0);
+
+  for (uint32_t v = 0; v < 1UL << 20; v++)
+    if (Adafruit_ZeroSpectrum::isqrt(v) != (uint16_t)sqrt((double)v))
+      fail("isqrt()", v);
+  for (uint32_t r = 1024; r < 65536; r += 7)
+    if (Adafruit_ZeroSpectrum::isqrt(r * r) != r ||
+        Adafruit_ZeroSpectrum::isqrt(r * r - 1) != r - 1)
+      fail("isqrt() of a square", r);
+  for (uint32_t v = 2; v < 65536; v++) {
+    int e = (int)floor(log2((double)v));
+    int want = 16 * e + (int)floor(16.0 * ((double)v / (1 << e) - 1));
+    if (Adafruit_ZeroSpectrum::log8(v) != want)
+      fail("log8()", v);
+  }
+}
+
+int main(int argc, char **argv) {
+  std::vector<int16_t> samples;
+  uint16_t rate = 0;
+  if (argc < 2 || argc > 3 || !readWave(argv[1], samples, rate) || rate < 2) {
+    puts("usage: spectrum <16-bit PCM wave> [<tones>]");
+    return 2;
+  }
+  if (argc == 2) {
+    show(samples, rate);
+    return 0;
+  }
+  std::vector<Tone> tones;
+  FILE *f = fopen(argv[2], "r");
+  Tone tone;
+  while (f && fscanf(f, "%ld %ld %lf", &tone.first, &tone.samples,
+                     &tone.hz) == 3)
+    tones.push_back(tone);
+  if (f)
+    fclose(f);
+  if (tones.empty()) {
+    printf("no tones in %s\n", argv[2]);
+    return 2;
+  }
+
+  srand(1);
+  arguments();
+  static const Setup setups[] = {
+      {512, 2, 16, ZERO_SPECTRUM_LOG, 50},
+      {256, 4, 20, ZERO_SPECTRUM_BARK, 100},
+      {1024, 1, 8, ZERO_SPECTRUM_LINEAR, 200},
+  };
+  for (const Setup &c : setups)
+    check(c, samples, rate, tones);
+  printf("%d bad\n", bad);
+  return bad != 0;
+}
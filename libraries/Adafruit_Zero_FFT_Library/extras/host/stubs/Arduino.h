@@ -0,0 +1,43 @@
+// Just enough of the Arduino core to build ZeroFFT on a PC
+#ifndef Arduino_h
+#define Arduino_h
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+// The Cortex-M4 SIMD instructions the radix-4 kernel uses, done in C.  The
+// low halfword of each operand is the first (real) value.
+#define DSP_LO(x) ((int32_t)(int16_t)(x))
+#define DSP_HI(x) ((int32_t)(int16_t)((x) >> 16))
+#define DSP_PACK(lo, hi) (((uint32_t)(lo)&0xFFFF) | ((uint32_t)(hi) << 16))
+
+static inline uint32_t __SHADD16(uint32_t a, uint32_t b) {
+  return DSP_PACK((DSP_LO(a) + DSP_LO(b)) >> 1, (DSP_HI(a) + DSP_HI(b)) >> 1);
+}
+static inline uint32_t __SHSUB16(uint32_t a, uint32_t b) {
+  return DSP_PACK((DSP_LO(a) - DSP_LO(b)) >> 1, (DSP_HI(a) - DSP_HI(b)) >> 1);
+}
+static inline uint32_t __SHASX(uint32_t a, uint32_t b) {
+  return DSP_PACK((DSP_LO(a) - DSP_HI(b)) >> 1, (DSP_HI(a) + DSP_LO(b)) >> 1);
+}
+static inline uint32_t __SHSAX(uint32_t a, uint32_t b) {
+  return DSP_PACK((DSP_LO(a) + DSP_HI(b)) >> 1, (DSP_HI(a) - DSP_LO(b)) >> 1);
+}
+static inline uint32_t __SMUAD(uint32_t a, uint32_t b) {
+  return (uint32_t)(DSP_LO(a) * DSP_LO(b)) + (uint32_t)(DSP_HI(a) * DSP_HI(b));
+}
+static inline uint32_t __SMUSDX(uint32_t a, uint32_t b) {
+  return (uint32_t)(DSP_LO(a) * DSP_HI(b)) - (uint32_t)(DSP_HI(a) * DSP_LO(b));
+}
+#define __PKHBT(a, b, shift)                                                   \
+  (((uint32_t)(a)&0xFFFF) | ((uint32_t)(b) << (shift) & 0xFFFF0000))
+#endif
+#endif // Arduino_h
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+# Makes the wave files for the spectrum host test.
+#
+# Usage: tones.py <wave> <list> <rate> <channels>
+#
+# <wave> is 16-bit PCM at <rate> Hz with a LIST chunk before its data:
+# tones of 0.3 s each from 60 Hz to near half the rate at amplitudes from
+# 500 to 30000, each on a small DC offset, then noise and silence.  With 2
+# channels the right one holds other tones, which the test must ignore.
+# <list> has a line "<first sample> <samples> <Hz>" for each tone in the
+# left channel.
+
+import math
+import random
+import struct
+import sys
+
+
+def wave(rate, channels, frames, extra=b""):
+    data = b"".join(struct.pack("<%dh" % channels, *f) for f in frames)
+    fmt = struct.pack("<HHIIHH", 1, channels, rate, rate * 2 * channels,
+                      2 * channels, 16)
+    body = (b"WAVEfmt " + struct.pack("<I", 16) + fmt + extra + b"data" +
+            struct.pack("<I", len(data)) + data)
+    return b"RIFF" + struct.pack("<I", len(body)) + body
+
+
+def clip(v):
+    return max(-32768, min(32767, int(round(v))))
+
+
+def tones(path, listing, rate, channels):
+    random.seed(3)
+    length = int(0.3 * rate)
+    hz, f = [], 60.0
+    while f < rate * 0.45:
+        hz.append(f)
+        f *= 1.37
+    left, right, lines = [], [], []
+    for n, f in enumerate(hz):
+        amp = (500, 3000, 12000, 30000)[n % 4]
+        dc = random.randint(-400, 400)
+        lines.append("%d %d %.3f\n" % (len(left), length, f))
+        for i in range(length):
+            left.append(clip(dc + amp * math.sin(2 * math.pi * f * i / rate)))
+            right.append(clip(8000 * math.sin(2 * math.pi * rate / 5 * i /
+                                              rate + n)))
+    for i in range(length):
+        left.append(random.randint(-8000, 8000))
+        right.append(0)
+    left += [0] * length
+    right += [0] * length
+    frames = zip(left, right) if channels == 2 else ((s,) for s in left)
+    open(path, "wb").write(wave(rate, channels, frames,
+                                b"LIST" + struct.pack("<I", 6) + b"tones\0"))
+    open(listing, "w").writelines(lines)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 5 and sys.argv[4] in ("1", "2"):
+        tones(sys.argv[1], sys.argv[2], int(sys.argv[3]), int(sys.argv[4]))
+    else:
+        sys.exit("usage: tones.py <wave> <list> <rate> <channels>")
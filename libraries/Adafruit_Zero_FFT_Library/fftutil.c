@@ -167,6 +167,141 @@ void arm_radix2_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
   twidCoefModifier = twidCoefModifier << 1u;
 }
 
+/*
+ * Complex Q15 helpers for the radix-4 kernel. On Cortex-M4 (SAMD51) a value
+ * is one packed uint32_t (real part in the low half) and each helper is a
+ * single DSP instruction. Elsewhere the C versions keep real and imaginary
+ * parts in separate registers but round and wrap exactly like the
+ * instructions, so both builds give bit-identical results.
+ */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+typedef uint32_t fft_cq15; ///< packed complex Q15 value
+#define fft_load(p) (*(const uint32_t *)(p))
+#define fft_store(p, v) (*(uint32_t *)(p) = (v))
+#define fft_half(a) __SHADD16(a, 0)     ///< a / 2
+#define fft_hadd(a, b) __SHADD16(a, b)  ///< (a + b) / 2
+#define fft_hsub(a, b) __SHSUB16(a, b)  ///< (a - b) / 2
+#define fft_haddj(a, b) __SHASX(a, b)   ///< (a + jb) / 2
+#define fft_hsubj(a, b) __SHSAX(a, b)   ///< (a - jb) / 2
+#define fft_twiddle(pCoef, k) fft_load(&(pCoef)[2 * (k)])
+// x * conj(w): real = x.re*w.re + x.im*w.im, imag = x.im*w.re - x.re*w.im
+#define fft_cmul(x, w)                                                         \
+  __PKHBT((int32_t)__SMUAD(x, w) >> 15, (int32_t)__SMUSDX(w, x) >> 15, 16)
+#else
+typedef struct {
+  int32_t re; ///< real part, always in int16_t range
+  int32_t im; ///< imaginary part, always in int16_t range
+} fft_cq15;
+
+static inline fft_cq15 fft_make(int32_t re, int32_t im) {
+  fft_cq15 v;
+  v.re = re;
+  v.im = im;
+  return v;
+}
+static inline fft_cq15 fft_load(const q15_t *p) { return fft_make(p[0], p[1]); }
+static inline void fft_store(q15_t *p, fft_cq15 v) {
+  p[0] = v.re;
+  p[1] = v.im;
+}
+static inline fft_cq15 fft_half(fft_cq15 a) {
+  return fft_make(a.re >> 1, a.im >> 1);
+}
+static inline fft_cq15 fft_hadd(fft_cq15 a, fft_cq15 b) {
+  return fft_make((a.re + b.re) >> 1, (a.im + b.im) >> 1);
+}
+static inline fft_cq15 fft_hsub(fft_cq15 a, fft_cq15 b) {
+  return fft_make((a.re - b.re) >> 1, (a.im - b.im) >> 1);
+}
+static inline fft_cq15 fft_haddj(fft_cq15 a, fft_cq15 b) {
+  return fft_make((a.re - b.im) >> 1, (a.im + b.re) >> 1);
+}
+static inline fft_cq15 fft_hsubj(fft_cq15 a, fft_cq15 b) {
+  return fft_make((a.re + b.im) >> 1, (a.im - b.re) >> 1);
+}
+#define fft_twiddle(pCoef, k) fft_load(&(pCoef)[2 * (k)])
+// Sums wrap and results truncate to 16 bits, like SMUAD/SMUSDX + PKHBT
+static inline fft_cq15 fft_cmul(fft_cq15 x, fft_cq15 w) {
+  int32_t re = (int32_t)((uint32_t)(x.re * w.re) + (uint32_t)(x.im * w.im));
+  int32_t im = (int32_t)((uint32_t)(w.re * x.im) - (uint32_t)(w.im * x.re));
+  return fft_make((int16_t)(re >> 15), (int16_t)(im >> 15));
+}
+#endif
+
+/*
+ * @brief  In-place radix-4 decimation-in-frequency butterflies, with one
+ * radix-2 stage at the end when fftLen is not a power of 4. Output is in
+ * bit-reversed order (the two middle outputs of each radix-4 butterfly are
+ * swapped), so arm_bitreversal_q15() finishes the job exactly as after
+ * arm_radix2_butterfly_q15(). Every stage halves per add, for an overall
+ * scaling of 1/(2 * fftLen), the same as the radix-2 kernel.
+ * @param[in, out] *pSrc        points to the in-place buffer of Q15 data,
+ * 4-byte aligned.
+ * @param[in]      fftLen       length of the FFT, 16 to 4096.
+ * @param[in]      *pCoef       points to twiddleCoefQ15.
+ * @param[in]      twidCoefModifier  4096 / fftLen.
+ * @return none.
+ */
+void zero_radix4_butterfly_q15(q15_t *pSrc, uint32_t fftLen, q15_t *pCoef,
+                               uint16_t twidCoefModifier) {
+  uint32_t n1, n2, i0, i1, i2, i3, j, mod = twidCoefModifier;
+  fft_cq15 x0, x1, x2, x3, t0, t1, t2, t3;
+
+  // Extra halving in the first stage, to match radix-2 overall scaling
+  for (i0 = 0; i0 < fftLen; i0++)
+    fft_store(&pSrc[2 * i0], fft_half(fft_load(&pSrc[2 * i0])));
+
+  for (n1 = fftLen; n1 >= 4; n1 = n2, mod <<= 2) {
+    n2 = n1 >> 2;
+    for (j = 0; j < n2; j++) {
+      fft_cq15 w1 = fft_twiddle(pCoef, j * mod),
+               w2 = fft_twiddle(pCoef, 2 * j * mod),
+               w3 = fft_twiddle(pCoef, 3 * j * mod);
+      for (i0 = j; i0 < fftLen; i0 += n1) {
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+        x0 = fft_load(&pSrc[2 * i0]);
+        x1 = fft_load(&pSrc[2 * i1]);
+        x2 = fft_load(&pSrc[2 * i2]);
+        x3 = fft_load(&pSrc[2 * i3]);
+        t0 = fft_hadd(x0, x2);
+        t1 = fft_hsub(x0, x2);
+        t2 = fft_hadd(x1, x3);
+        t3 = fft_hsub(x1, x3);
+        x0 = fft_hadd(t0, t2);  // Bin 0
+        x2 = fft_hsub(t0, t2);  // Bin 2
+        x1 = fft_hsubj(t1, t3); // Bin 1: t1 - j t3
+        x3 = fft_haddj(t1, t3); // Bin 3: t1 + j t3
+        if (j) { // Twiddles are all 1 for the first butterfly of each group
+          x2 = fft_cmul(x2, w2);
+          x1 = fft_cmul(x1, w1);
+          x3 = fft_cmul(x3, w3);
+        }
+        fft_store(&pSrc[2 * i0], x0);
+        fft_store(&pSrc[2 * i1], x2);
+        fft_store(&pSrc[2 * i2], x1);
+        fft_store(&pSrc[2 * i3], x3);
+      }
+    }
+  }
+
+  if (n1 == 2) { // Radix-2 tail for 2 * 4^n lengths
+    for (i0 = 0; i0 < fftLen; i0 += 2) {
+      x0 = fft_load(&pSrc[2 * i0]);
+      x1 = fft_load(&pSrc[2 * i0 + 2]);
+      fft_store(&pSrc[2 * i0], fft_hadd(x0, x1));
+      fft_store(&pSrc[2 * i0 + 2], fft_hsub(x0, x1));
+    }
+  }
+}
+
+#ifdef ZERO_FFT_RADIX2
+#define ZERO_FFT_BUTTERFLY arm_radix2_butterfly_q15
+#else
+#define ZERO_FFT_BUTTERFLY zero_radix4_butterfly_q15
+#endif
+
 static inline void applyWindow(q15_t *src, const q15_t *window, uint16_t len) {
   while (len--) {
     int32_t val = *src * *window++;
@@ -305,8 +440,8 @@ int ZeroFFT(q15_t *source, uint16_t length) {
     *pOut++ = 0;       // imaginary
   }
 
-  arm_radix2_butterfly_q15(scratchData, length, (q15_t *)twiddleCoefQ15,
-                           twidCoefModifier);
+  ZERO_FFT_BUTTERFLY(scratchData, length, (q15_t *)twiddleCoefQ15,
+                     twidCoefModifier);
   arm_bitreversal_q15(scratchData, length, bitRevFactor, pBitRevTable);
 
   pSrc = source;
@@ -320,3 +455,84 @@ int ZeroFFT(q15_t *source, uint16_t length) {
 
   return 0;
 }
+
+// cos(2 * pi * i / n) in Q15 from the 4096-point twiddle table, for any i
+static inline q15_t tableCos(uint32_t i, uint16_t n) {
+  i &= n - 1;
+  if (i > n / 2)
+    i = n - i; // cos is symmetric, and the table only covers 3/4 turn
+  return twiddleCoefQ15[2 * i * (4096 / n)];
+}
+
+// Window weight for sample i of length, from the shared cosine table
+static inline int32_t windowWeight(uint16_t i, uint16_t length,
+                                   uint8_t window) {
+  int32_t c = tableCos(i, length), w;
+  if (window == ZERO_FFT_WINDOW_HAMMING) // 0.54 - 0.46 cos
+    w = 17695 - ((15073 * c) >> 15);
+  else if (window == ZERO_FFT_WINDOW_BLACKMAN) // 0.42 - 0.5 cos + 0.08 cos2
+    w = 13763 - (c >> 1) + ((2621 * (int32_t)tableCos(2 * i, length)) >> 15);
+  else // Hann: 0.5 - 0.5 cos
+    w = (32768 - c) >> 1;
+  if (w > 32767)
+    w = 32767;
+  else if (w < 0)
+    w = 0;
+  return w;
+}
+
+void ZeroFFTWindow(q15_t *source, uint16_t length, uint8_t window) {
+  if ((window == ZERO_FFT_WINDOW_NONE) || (length < 2) ||
+      (length > ZERO_FFT_MAX) || (length & (length - 1)))
+    return;
+
+  // Periodic windows are symmetric about length/2: w[i] == w[length - i]
+  source[0] = (source[0] * windowWeight(0, length, window)) >> 15;
+  for (uint16_t i = 1, j = length - 1; i <= j; i++, j--) {
+    int32_t w = windowWeight(i, length, window);
+    source[i] = (source[i] * w) >> 15;
+    if (j != i)
+      source[j] = (source[j] * w) >> 15;
+  }
+}
+
+int ZeroFFTReal(q15_t *source, uint16_t length, uint8_t window) {
+  if ((length < 32) || (length > ZERO_FFT_MAX) || (length & (length - 1)) ||
+      ((uintptr_t)source & 3))
+    return -1;
+
+  ZeroFFTWindow(source, length, window);
+
+  // Even samples as real, odd as imaginary parts: the input layout already
+  // is a length/2 complex array, so the complex FFT runs on it in place.
+  uint16_t half = length / 2;
+  uint16_t mod = 4096 / half;
+  ZERO_FFT_BUTTERFLY(source, half, (q15_t *)twiddleCoefQ15, mod);
+  arm_bitreversal_q15(source, half, mod, (uint16_t *)&armBitRevTable[mod - 1]);
+
+  // Split step. With A = Z[k] and B = conj(Z[half - k]), the even and odd
+  // sample spectra are E = (A + B) / 2 and O = (A - B) / 2j, and
+  // X[k] = E + W^k O, X[half - k] = conj(E - W^k O), W = e^(-2 pi j / N).
+  // Results are halved again to match ZeroFFT() scaling.
+  q15_t *z = source;
+  int32_t a = z[0], b = z[1];
+  z[0] = (a + b) >> 1; // Bin 0
+  z[1] = (a - b) >> 1; // Bin length/2
+  for (uint16_t k = 1; k < half / 2; k++) {
+    q15_t *p = &z[2 * k], *q = &z[2 * (half - k)];
+    int32_t er = p[0] + q[0], ei = p[1] - q[1]; // 2E
+    int32_t dr = p[0] - q[0], di = p[1] + q[1]; // 2jO = dr + j di
+    int32_t c = twiddleCoefQ15[2 * k * (4096 / length)],
+            s = twiddleCoefQ15[2 * k * (4096 / length) + 1];
+    int32_t tr = (c * di - s * dr) >> 15, // 2 W^k O
+        ti = (-c * dr - s * di) >> 15;
+    p[0] = (er + tr) >> 2;
+    p[1] = (ei + ti) >> 2;
+    q[0] = (er - tr) >> 2;
+    q[1] = (ti - ei) >> 2;
+  }
+  z[half] >>= 1; // Bin length/4: X = conj(Z) / 2
+  z[half + 1] = -z[half + 1] >> 1;
+
+  return 0;
+}
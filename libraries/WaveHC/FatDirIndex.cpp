@@ -0,0 +1,251 @@
+/* Arduino FatReader Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino FatReader Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino FatReader Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#if ARDUINO < 100
+#include <WProgram.h>
+#else // ARDUINO
+#include <Arduino.h>
+#endif // ARDUINO
+#include <FatDirIndex.h>
+//------------------------------------------------------------------------------
+// name character as stored in a directory entry
+static inline uint8_t nameChar(uint8_t c) {
+  return 'a' <= c && c <= 'z' ? c - 'a' + 'A' : c;
+}
+//------------------------------------------------------------------------------
+// convert "name.ext" to the 11 byte directory entry form, false if invalid
+static uint8_t makeName(const char *str, uint8_t name[11]) {
+  uint8_t i = 0;
+  uint8_t n = 8;
+  memset(name, ' ', 11);
+  for (uint8_t c; (c = *str); str++) {
+    if (c == '.') {
+      if (n == 11 || i == 0)
+        return false;
+      i = 8;
+      n = 11;
+    } else {
+      if (i >= n || c <= ' ' || c > '~')
+        return false;
+      name[i++] = nameChar(c);
+    }
+  }
+  return i != 0;
+}
+//------------------------------------------------------------------------------
+/**
+ * Hash an 11 byte directory entry name.
+ *
+ * \param[in] name The name field of a dir_t.  Lower case letters hash
+ * the same as upper case.
+ *
+ * \return A 16-bit hash of \a name.
+ */
+uint16_t FatDirIndex::hashName(const uint8_t name[11]) {
+  // 16-bit FNV-1a with a final mix, the low bits pick the slot
+  uint16_t h = 0X9DC5;
+  for (uint8_t i = 0; i < 11; i++) {
+    h ^= nameChar(name[i]);
+    h *= 0X0193;
+  }
+  return h ^ (h >> 7);
+}
+//------------------------------------------------------------------------------
+#if FAT_INDEX_ENTRY_DATA
+// second hash that confirms a match without reading the directory, made
+// differently from hashName() so names that share one seldom share both
+static uint16_t checkName(const uint8_t name[11]) {
+  uint16_t h = 0X1505;
+  for (uint8_t i = 11; i > 0; i--) {
+    h ^= nameChar(name[i - 1]);
+    h *= 0X0105;
+  }
+  return h ^ (h >> 9);
+}
+#endif // FAT_INDEX_ENTRY_DATA
+//------------------------------------------------------------------------------
+/**
+ * Build the index for a directory.
+ *
+ * \param[in] dir An open FatReader instance for the directory.  Must stay
+ * open while the index is used.
+ * \param[in] table Storage for the hash table, \a size entries.
+ * \param[in] size Number of table entries.  Must be greater than the
+ * number of names indexed; 1.5 times that keeps lookups short.
+ * \param[in] ext If not NULL only files with this extension, for example
+ * "WAV", are indexed.  Saves RAM in a directory with other files.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include \a dir is not a directory, \a table is
+ * too small or an I/O error occurred.
+ */
+uint8_t FatDirIndex::begin(FatReader &dir, dirIndex_t *table,
+                           uint16_t size, const char *ext) {
+  uint8_t match[11];
+  dir_t d;
+  int8_t n;
+
+  if (ext) {
+    // extension part of the name "x.ext"
+    char tmp[7] = {'x', '.'};
+    strncpy(&tmp[2], ext, 4);
+    if (!makeName(tmp, match))
+      return false;
+  }
+
+  dir_ = 0;
+  count_ = 0;
+  if (!dir.isDir() || !table || size < 2)
+    return false;
+  for (uint16_t i = 0; i < size; i++)
+    table[i].index = DIR_INDEX_EMPTY;
+
+  dir.rewind();
+  while ((n = dir.readDir(d)) > 0) {
+    if (ext && (!DIR_IS_FILE(d) || nameChar(d.name[8]) != match[8] ||
+                nameChar(d.name[9]) != match[9] ||
+                nameChar(d.name[10]) != match[10])) {
+      continue;
+    }
+    uint16_t index = dir.readPosition() / 32 - 1;
+    // keep an empty slot so lookups stop
+    if (index > DIR_INDEX_MASK || count_ + 1 >= size)
+      return false;
+    if (DIR_IS_SUBDIR(d))
+      index |= DIR_INDEX_SUBDIR;
+    uint16_t h = hashName(d.name);
+#if FAT_INDEX_ENTRY_DATA
+    uint16_t c = checkName(d.name);
+#endif // FAT_INDEX_ENTRY_DATA
+    uint16_t i = h % size;
+    for (; table[i].index != DIR_INDEX_EMPTY; i = i + 1 < size ? i + 1 : 0) {
+#if FAT_INDEX_ENTRY_DATA
+      if (table[i].hash == h && table[i].check == c) {
+#else  // FAT_INDEX_ENTRY_DATA
+      if (table[i].hash == h) {
+#endif // FAT_INDEX_ENTRY_DATA
+        table[i].index |= DIR_INDEX_SHARED;
+        index |= DIR_INDEX_SHARED;
+      }
+    }
+    table[i].hash = h;
+    table[i].index = index;
+#if FAT_INDEX_ENTRY_DATA
+    table[i].check = c;
+    table[i].firstCluster = (uint32_t)d.firstClusterHigh << 16;
+    table[i].firstCluster |= d.firstClusterLow;
+    table[i].fileSize = d.fileSize;
+#endif // FAT_INDEX_ENTRY_DATA
+    count_++;
+  }
+  if (n < 0)
+    return false;
+  dir_ = &dir;
+  table_ = table;
+  size_ = size;
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Find a file or subdirectory's directory entry index.
+ *
+ * \param[in] name A valid 8.3 DOS name, case is ignored.
+ *
+ * \return The index, as used by FatReader::open(dir, index), or -1 if
+ * \a name is not in the directory or an I/O error occurred.
+ */
+int32_t FatDirIndex::lookup(char *name) {
+  uint8_t n[11];
+  dir_t d;
+  if (!makeName(name, n))
+    return -1;
+  dirIndex_t *p = find(n, &d);
+  return p ? p->index & DIR_INDEX_MASK : -1;
+}
+//------------------------------------------------------------------------------
+/**
+ * Open a file or subdirectory by name using the index.
+ *
+ * \param[out] file The FatReader to open.
+ * \param[in] name A valid 8.3 DOS name, case is ignored.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the index has not been built, \a name is
+ * not in the directory or an I/O error occurred.
+ */
+uint8_t FatDirIndex::open(FatReader &file, char *name) {
+  uint8_t n[11];
+  dir_t d;
+  if (!makeName(name, n))
+    return false;
+  dirIndex_t *p = find(n, &d);
+  if (!p)
+    return false;
+#if FAT_INDEX_ENTRY_DATA
+  if (!(p->index & DIR_INDEX_SHARED)) {
+    // the hashes are unique, build the entry without reading the directory
+    memset(&d, 0, sizeof(d));
+    memcpy(d.name, n, 11);
+    d.attributes = p->index & DIR_INDEX_SUBDIR ? DIR_ATT_DIRECTORY : 0;
+    d.firstClusterHigh = p->firstCluster >> 16;
+    d.firstClusterLow = p->firstCluster;
+    d.fileSize = p->fileSize;
+  }
+#endif // FAT_INDEX_ENTRY_DATA
+  return file.open(*dir_->volume(), d);
+}
+//------------------------------------------------------------------------------
+// find name in the hash table, reading directory entries to check it unless
+// the second hash makes that unnecessary; entry is valid if read
+dirIndex_t *FatDirIndex::find(const uint8_t name[11], dir_t *entry) {
+  if (!dir_)
+    return 0;
+  uint16_t h = hashName(name);
+#if FAT_INDEX_ENTRY_DATA
+  uint16_t c = checkName(name);
+#endif // FAT_INDEX_ENTRY_DATA
+  for (uint16_t i = h % size_; table_[i].index != DIR_INDEX_EMPTY;
+       i = i + 1 < size_ ? i + 1 : 0) {
+    dirIndex_t *p = &table_[i];
+    if (p->hash != h)
+      continue;
+#if FAT_INDEX_ENTRY_DATA
+    if (p->check != c)
+      continue;
+    if (!(p->index & DIR_INDEX_SHARED))
+      return p;
+#endif // FAT_INDEX_ENTRY_DATA
+    if (!readEntry(p->index & DIR_INDEX_MASK, *entry))
+      return 0;
+    uint8_t k = 0;
+    while (k < 11 && nameChar(entry->name[k]) == name[k])
+      k++;
+    if (k == 11)
+      return p;
+  }
+  return 0;
+}
+//------------------------------------------------------------------------------
+// read directory entry index
+uint8_t FatDirIndex::readEntry(uint16_t index, dir_t &entry) {
+  return dir_->seekSet(32UL * index) && dir_->read(&entry, 32) == 32;
+}
@@ -0,0 +1,95 @@
+/* Arduino FatReader Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino FatReader Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino FatReader Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef FatDirIndex_h
+#define FatDirIndex_h
+#include <FatReader.h>
+/**
+ * \file
+ * FatDirIndex class
+ */
+#if defined(RAMEND) && RAMEND > 0X8FF
+/**
+ * If nonzero, index entries hold a second hash of the name and the first
+ * cluster and size of each file so FatDirIndex::open() doesn't read the
+ * directory.  Entries are 14 bytes.  With n files, about n in 2^32
+ * lookups of a name that isn't in the directory match both hashes of one
+ * that is and open the wrong file.
+ * If zero, entries are 4 bytes and open() reads one directory entry.
+ */
+#define FAT_INDEX_ENTRY_DATA 1
+#else // RAMEND
+/** Four byte index entries for Arduinos with 2 KB or less of RAM. */
+#define FAT_INDEX_ENTRY_DATA 0
+#endif // RAMEND
+
+// high bits of dirIndex_t index
+/** Another file in the index has the same name hashes */
+#define DIR_INDEX_SHARED 0X8000
+/** The entry is a subdirectory */
+#define DIR_INDEX_SUBDIR 0X4000
+/** Mask for the directory entry index */
+#define DIR_INDEX_MASK 0X3FFF
+/** index value of an unused slot */
+#define DIR_INDEX_EMPTY 0XFFFF
+//------------------------------------------------------------------------------
+/**
+ * \struct dirIndex_t
+ * \brief One file or subdirectory in a FatDirIndex hash table.
+ */
+struct dirIndex_t {
+  uint16_t hash;  /**< hash of the 8.3 name */
+  uint16_t index; /**< directory entry index and DIR_INDEX_ flags */
+#if FAT_INDEX_ENTRY_DATA
+  uint16_t check;        /**< second hash of the name to confirm a match */
+  uint32_t firstCluster; /**< first cluster of the file */
+  uint32_t fileSize;     /**< file size in bytes */
+#endif // FAT_INDEX_ENTRY_DATA
+};
+//------------------------------------------------------------------------------
+/**
+ * \class FatDirIndex
+ * \brief Hash table of the names in a directory for fast open by name.
+ *
+ * FatReader::open(dir, name) reads the directory from the start, including
+ * deleted entries, for every open.  begin() reads the directory once and
+ * stores a hash of each name with its directory entry index.  open() then
+ * finds a file without scanning.  Rebuild the index if the card is changed.
+ */
+class FatDirIndex {
+public:
+  /** Create an empty index.  Call begin() before use. */
+  FatDirIndex(void) : dir_(0), table_(0), size_(0), count_(0) {}
+  uint8_t begin(FatReader &dir, dirIndex_t *table, uint16_t size,
+                const char *ext = 0);
+  /** \return The number of files and subdirectories in the index. */
+  uint16_t fileCount(void) { return count_; }
+  int32_t lookup(char *name);
+  uint8_t open(FatReader &file, char *name);
+  static uint16_t hashName(const uint8_t name[11]);
+
+private:
+  FatReader *dir_;
+  dirIndex_t *table_;
+  uint16_t size_;
+  uint16_t count_;
+  dirIndex_t *find(const uint8_t name[11], dir_t *entry);
+  uint8_t readEntry(uint16_t index, dir_t &entry);
+};
+#endif // FatDirIndex_h
@@ -115,25 +115,36 @@ uint32_t FatVolume::nextCluster(uint32_t cluster) {
   if (!validCluster(cluster)) {
     return 0;
   }
+  uint32_t block;
+  uint16_t offset;
   if (fatType_ == 32) {
-    uint32_t next;
-    uint32_t block = fatStartBlock_ + (cluster >> 7);
-    uint16_t offset = 0X1FF & (cluster << 2);
-    if (!rawRead(block, offset, (uint8_t *)&next, 4)) {
-      return 0;
-    }
-    return next;
+    block = fatStartBlock_ + (cluster >> 7);
+    offset = 0X1FF & (cluster << 2);
+  } else if (fatType_ == 16) {
+    block = fatStartBlock_ + (cluster >> 8);
+    offset = 0X1FF & (cluster << 1);
+  } else {
+    return 0;
   }
-  if (fatType_ == 16) {
-    uint16_t next;
-    uint32_t block = fatStartBlock_ + (cluster >> 8);
-    uint16_t offset = 0X1FF & (cluster << 1);
-    if (!rawRead(block, offset, (uint8_t *)&next, 2)) {
+  // read the aligned piece of FAT holding the entry if not cached
+  uint16_t start = offset & ~(FAT_CACHE_SIZE - 1);
+  if (block != cacheBlock_ || start != cacheOffset_) {
+    if (!rawRead(block, start, cache_, FAT_CACHE_SIZE)) {
+      cacheBlock_ = 0;
       return 0;
     }
+    cacheBlock_ = block;
+    cacheOffset_ = start;
+  }
+  uint8_t *p = cache_ + (offset - start);
+  if (fatType_ == 32) {
+    uint32_t next;
+    memcpy(&next, p, 4);
     return next;
   }
-  return 0;
+  uint16_t next;
+  memcpy(&next, p, 2);
+  return next;
 }
 //------------------------------------------------------------------------------
 /**
@@ -235,6 +246,7 @@ uint8_t FatReader::open(FatVolume &vol, dir_t &dir) {
     return false;
   }
   vol_ = &vol;
+  extentCount_ = 0;
   rewind();
   return true;
 }
@@ -262,6 +274,7 @@ uint8_t FatReader::openRoot(FatVolume &vol) {
     return false;
   }
   vol_ = &vol;
+  extentCount_ = 0;
   rewind();
   return true;
 }
@@ -269,12 +282,47 @@ uint8_t FatReader::openRoot(FatVolume &vol) {
 /**
  * Check for a contiguous file and enable optimized reads if the
  * file is contiguous.
+ *
+ * The first FAT_EXTENT_COUNT runs of contiguous clusters are also recorded,
+ * so reads and seeks within them don't need the FAT.  If they cover the
+ * whole file isMapped() becomes true.
  */
 void FatReader::optimizeContiguous(void) {
-  if (isOpen() && firstCluster_) {
-    if (vol_->chainIsContiguous(firstCluster_)) {
-      type_ |= FILE_IS_CONTIGUOUS;
+  extentCount_ = 0;
+  if (!isOpen() || !firstCluster_)
+    return;
+  type_ &= ~(FILE_IS_CONTIGUOUS | FILE_IS_MAPPED);
+
+  uint32_t cluster = firstCluster_;
+  uint32_t next;
+  extents_[0].firstCluster = cluster;
+  extents_[0].clusterCount = 1;
+  extentCount_ = 1;
+  while ((next = vol_->nextCluster(cluster))) {
+    if (vol_->isEOC(next)) {
+      type_ |= FILE_IS_MAPPED;
+      if (extentCount_ == 1)
+        type_ |= FILE_IS_CONTIGUOUS;
+      break;
     }
+    if (next == cluster + 1) {
+      extents_[extentCount_ - 1].clusterCount++;
+    } else {
+      // out of room, the rest of the chain will come from the FAT
+      if (extentCount_ == FAT_EXTENT_COUNT)
+        break;
+      extents_[extentCount_].firstCluster = next;
+      extents_[extentCount_].clusterCount = 1;
+      extentCount_++;
+    }
+    cluster = next;
+  }
+
+  // find the run holding the current read position
+  for (extent_ = 0; extent_ < extentCount_; extent_++) {
+    uint32_t n = readCluster_ - extents_[extent_].firstCluster;
+    if (n < extents_[extent_].clusterCount)
+      break;
   }
 }
 //------------------------------------------------------------------------------
@@ -353,6 +401,7 @@ int8_t FatReader::readDir(dir_t &dir) {
 void FatReader::rewind(void) {
   readCluster_ = firstCluster_;
   readPosition_ = 0;
+  extent_ = 0;
 }
 /**
  * Set the read position for a file or directory to the current position plus
@@ -388,11 +437,28 @@ uint8_t FatReader::seekCur(uint32_t offset) {
     return true;
   }
 
-  // read FAT chain while nc != 0
-  while (nc-- != 0) {
+  while (nc != 0) {
+    // use the extent list while it covers the chain
+    if (extent_ < extentCount_) {
+      uint32_t last =
+          extents_[extent_].firstCluster + extents_[extent_].clusterCount - 1;
+      if (nc <= last - readCluster_) {
+        readCluster_ += nc;
+        return true;
+      }
+      nc -= last - readCluster_;
+      if (++extent_ < extentCount_) {
+        readCluster_ = extents_[extent_].firstCluster;
+        nc--;
+        continue;
+      }
+      readCluster_ = last;
+    }
+    // then read FAT chain
     if (!(readCluster_ = vol_->nextCluster(readCluster_))) {
       return false;
     }
+    nc--;
   }
   return true;
 }
@@ -437,6 +503,7 @@ uint8_t FatVolume::init(SdReader &dev, uint8_t part) {
   uint8_t buf[BPB_COUNT];
   uint32_t volumeStartBlock = 0;
   rawDevice_ = &dev;
+  cacheBlock_ = 0;
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
@@ -38,6 +38,27 @@
 /** offset to partition table in mbr */
 #define PART_OFFSET (512 - 64 - 2)
 
+// FAT cache and extent list sizes
+#if defined(RAMEND) && RAMEND <= 0X8FF
+/** Bytes of FAT cached by FatVolume for Arduinos with 2 KB or less of RAM. */
+#define FAT_CACHE_SIZE 4
+/** Cluster runs recorded by optimizeContiguous() with 2 KB or less of RAM. */
+#define FAT_EXTENT_COUNT 1
+#else // RAMEND
+/**
+ * Bytes of FAT cached by FatVolume, a power of two from 4 to 512.
+ * Following a cluster chain reads the card once per FAT_CACHE_SIZE/2
+ * (FAT16) or FAT_CACHE_SIZE/4 (FAT32) clusters instead of once per cluster.
+ */
+#define FAT_CACHE_SIZE 64
+/**
+ * Contiguous cluster runs recorded by optimizeContiguous().  Reads within
+ * these runs never touch the FAT, so a file with up to this many fragments
+ * plays as well as a contiguous one.
+ */
+#define FAT_EXTENT_COUNT 4
+#endif // RAMEND
+
 // format dir.name into name[13] as standard 8.3 string
 void dirName(dir_t &dir, char name[]);
 // Print name field of dir_t struct in 8.3 format
@@ -56,6 +77,9 @@ class FatVolume {
   uint8_t fatCount_;
   uint32_t fatStartBlock_;
   uint8_t fatType_;
+  uint32_t cacheBlock_;
+  uint16_t cacheOffset_;
+  uint8_t cache_[FAT_CACHE_SIZE];
   SdReader *rawDevice_;
   uint16_t rootDirEntryCount_;
   uint32_t rootDirStart_;
@@ -76,7 +100,7 @@ class FatVolume {
 
 public:
   /** Create an instance of FatVolume */
-  FatVolume(void) : fatType_(0) {}
+  FatVolume(void) : fatType_(0), cacheBlock_(0) {}
   /**
    * Initialize a FAT volume.  Try partition one first then try super
    * floppy format.
@@ -121,6 +145,12 @@ public:
   uint32_t totalBlocks(void) { return totalBlocks_; }
 };
 //------------------------------------------------------------------------------
+/** A run of contiguous clusters in a file's cluster chain */
+struct extent_t {
+  uint32_t firstCluster; /**< first cluster of the run */
+  uint32_t clusterCount; /**< number of clusters in the run */
+};
+//------------------------------------------------------------------------------
 /** \class FatReader
  * \brief FatReader implements a minimal FAT16/FAT32 file reader class.
  */
@@ -128,6 +158,8 @@ class FatReader {
 // values for type_
 /** File is contiguous file */
 #define FILE_IS_CONTIGUOUS 0X08
+/** File's whole cluster chain is in the extent list */
+#define FILE_IS_MAPPED 0X10
 /** File type mask */
 #define FILE_TYPE_MASK 0X07
 /** This FatReader has not been opened. */
@@ -147,13 +179,16 @@ class FatReader {
   uint32_t readCluster_;
   uint32_t readPosition_;
   uint32_t firstCluster_;
+  uint8_t extentCount_;
+  uint8_t extent_;
+  extent_t extents_[FAT_EXTENT_COUNT];
   FatVolume *vol_;
   int16_t readBlockData(uint8_t *dst, uint16_t count);
   void lsR(dir_t &d, uint8_t flags, uint8_t indent);
 
 public:
   /** Create an instance of FatReader. */
-  FatReader(void) : type_(FILE_TYPE_CLOSED) {}
+  FatReader(void) : type_(FILE_TYPE_CLOSED), extentCount_(0) {}
   void ls(uint8_t flags = 0);
   uint8_t openRoot(FatVolume &vol);
   uint8_t open(FatVolume &vol, dir_t &dir);
@@ -182,6 +217,10 @@ public:
    * \return True if the bit for optimized reads is set.
    * See optimizeContiguous(). */
   uint8_t isContiguous(void) { return type_ & FILE_IS_CONTIGUOUS; }
+  /**
+   * \return True if optimizeContiguous() recorded the whole cluster chain,
+   * so reads never need the FAT.  Always true for a contiguous file. */
+  uint8_t isMapped(void) { return type_ & FILE_IS_MAPPED; }
   /** \return True if this is a FatReader for a directory else false */
   uint8_t isDir(void) { return fileType() >= FILE_TYPE_MIN_DIR; }
   /** \return True if this is a FatReader for a file else false */
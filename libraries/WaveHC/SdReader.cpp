@@ -72,8 +72,9 @@ uint8_t SdReader::cardCommand(uint8_t cmd, uint32_t arg) {
   // select card
   spiSSLow();
 
-  // wait up to 300 ms if busy
-  waitNotBusy(300);
+  // wait up to 300 ms if busy - except for a stop, the card is sending data
+  if (cmd != CMD12)
+    waitNotBusy(300);
 
   // send command
   spiSend(cmd | 0x40);
@@ -90,6 +91,10 @@ uint8_t SdReader::cardCommand(uint8_t cmd, uint32_t arg) {
     crc = 0X87; // correct crc for CMD8 with arg 0X1AA
   spiSend(crc);
 
+  // skip the stuff byte sent after a stop
+  if (cmd == CMD12)
+    spiRec();
+
   // wait for response
   for (uint8_t retry = 0; ((r1 = spiRec()) & 0X80) && retry != 0XFF; retry++)
     ;
@@ -240,16 +245,29 @@ uint8_t SdReader::readData(uint32_t block, uint16_t offset, uint8_t *dst,
     return false;
   }
   if (!inBlock_ || block != block_ || offset < offset_) {
-    block_ = block;
+    if (inMultiBlock_ && block == block_ + 1) {
+      // next block of a multiple block read, no command needed
+      if (inBlock_)
+        skipBlockRest();
+    } else {
+      readEnd();
+      uint8_t cmd = multiBlockRead_ ? CMD18 : CMD17;
 
-    // use address if not SDHC card
-    if (type() != SD_CARD_TYPE_SDHC)
-      block <<= 9;
-    if (cardCommand(CMD17, block)) {
-      error(SD_CARD_ERROR_CMD17);
-      return false;
+      // use address if not SDHC card
+      uint32_t arg = type() != SD_CARD_TYPE_SDHC ? block << 9 : block;
+      if (cardCommand(cmd, arg)) {
+        error(cmd == CMD18 ? SD_CARD_ERROR_CMD18 : SD_CARD_ERROR_CMD17);
+        spiSSHigh();
+        return false;
+      }
+      inMultiBlock_ = cmd == CMD18;
     }
+    block_ = block;
     if (!waitStartBlock()) {
+      if (inMultiBlock_)
+        readEnd();
+      else
+        spiSSHigh();
       return false;
     }
     offset_ = 0;
@@ -280,27 +298,44 @@ uint8_t SdReader::readData(uint32_t block, uint16_t offset, uint8_t *dst,
     ;
   dst[n] = SPDR;
   offset_ += count;
-  if (!partialBlockRead_ || offset_ >= 512)
+  if (offset_ >= 512 && inMultiBlock_) {
+    // keep the card streaming for the next block
+    skipBlockRest();
+  } else if (!partialBlockRead_ || offset_ >= 512) {
     readEnd();
+  }
   return true;
 }
 //------------------------------------------------------------------------------
-/** Skip remaining data in a block when in partial block read mode. */
+/**
+ * Skip remaining data in a block when in partial block read mode and stop
+ * a multiple block read.
+ */
 void SdReader::readEnd(void) {
-  if (inBlock_) {
-    // skip data and crc
-    SPDR = 0XFF;
-    while (offset_++ < 513) {
-      while (!(SPSR & (1 << SPIF)))
-        ;
-      SPDR = 0XFF;
-    }
-    // wait for last crc byte
+  if (!inBlock_ && !inMultiBlock_)
+    return;
+  if (inBlock_)
+    skipBlockRest();
+  if (inMultiBlock_) {
+    inMultiBlock_ = 0;
+    if (cardCommand(CMD12, 0))
+      error(SD_CARD_ERROR_CMD12);
+  }
+  spiSSHigh();
+}
+//------------------------------------------------------------------------------
+// skip data and crc for the rest of the current block, leaving card selected
+void SdReader::skipBlockRest(void) {
+  SPDR = 0XFF;
+  while (offset_++ < 513) {
     while (!(SPSR & (1 << SPIF)))
       ;
-    spiSSHigh();
-    inBlock_ = 0;
+    SPDR = 0XFF;
   }
+  // wait for last crc byte
+  while (!(SPSR & (1 << SPIF)))
+    ;
+  inBlock_ = 0;
 }
 //------------------------------------------------------------------------------
 /** read CID or CSR register */
@@ -168,52 +168,85 @@ http://www.atmel.com/dyn/resources/prod_documents/doc8161.pdf
 #if PLAYBUFFLEN != 256 && PLAYBUFFLEN != 512
 #error PLAYBUFFLEN must be 256 or 512
 #endif // PLAYBUFFLEN
+#if PLAYBUFFCOUNT < 2 || PLAYBUFFCOUNT > WAVE_RING_MAX
+#error PLAYBUFFCOUNT must be 2 to WAVE_RING_MAX
+#endif // PLAYBUFFCOUNT
 
 WaveHC *playing = 0;
 
-uint8_t buffer1[PLAYBUFFLEN];
-uint8_t buffer2[PLAYBUFFLEN];
-uint8_t *playend; ///< end position for current buffer
-uint8_t *playpos; ///< position of next sample
-uint8_t *sdbuff;  ///< SD fill buffer
-uint8_t *sdend;   ///< end of data in sd buffer
+uint8_t playbuffers[PLAYBUFFCOUNT * PLAYBUFFLEN];
+WaveRing playring; ///< full buffers, the first one is being played
+uint8_t *playend;  ///< end position for current buffer
+uint8_t *playpos;  ///< position of next sample
 
 // status of sd
-#define SD_READY 1    ///< buffer is ready to be played
-#define SD_FILLING 2  ///< buffer is being filled from DS
-#define SD_END_FILE 3 ///< reached end of file
-uint8_t sdstatus = 0;
+volatile uint8_t sdfilling = 0; ///< refill ISR is running
+volatile uint8_t sdeof = 0;     ///< reached end of file
+uint8_t playheld = 0;           ///< playpos is in a ring buffer
+uint8_t underrun = 0;           ///< out of data since the last buffer
 
-//------------------------------------------------------------------------------
-// timer interrupt for DAC
-ISR(TIMER1_COMPA_vect) {
-  if (!playing)
-    return;
-
-  if (playpos >= playend) {
-    if (sdstatus == SD_READY) {
+WaveMixer *wavemixer = 0; ///< sound effects mixed over the wave data
 
-      // swap double buffers
-      playpos = sdbuff;
-      playend = sdend;
-      sdbuff = sdbuff != buffer1 ? buffer1 : buffer2;
+/** Have the refill ISR run unless it is running now */
+static inline void requestFill(void) {
+  if (!sdfilling)
+    TIMSK1 |= _BV(OCIE1B);
+}
+/** Start the DAC ISR at \a rate samples per second */
+static void dacStart(uint32_t rate) {
+  // Setup mode for DAC ports
+  mcpDacInit();
 
-      sdstatus = SD_FILLING;
-      // interrupt to call SD reader
-      TIMSK1 |= _BV(OCIE1B);
-    } else if (sdstatus == SD_END_FILE) {
+  // Set up timer one
+  // Normal operation - no pwm not connected to pins
+  TCCR1A = 0;
+  // no prescaling, CTC mode
+  TCCR1B = _BV(WGM12) | _BV(CS10);
+  // Sample rate
+  OCR1A = F_CPU / rate;
+  // SD fill interrupt happens at TCNT1 == 1
+  OCR1B = 1;
+  // Enable timer interrupt for DAC ISR
+  TIMSK1 |= _BV(OCIE1A);
+}
+//------------------------------------------------------------------------------
+/** Get the next wave data sample for the DAC, false if there is none */
+static inline uint8_t nextSample(uint8_t &dh, uint8_t &dl) {
+  if (playpos >= playend) {
+    // give back the finished buffer for refill
+    if (playheld) {
+      playring.release();
+      playheld = 0;
+      if (!sdeof)
+        requestFill();
+    }
+    uint16_t n;
+    uint8_t *b = playring.playBuffer(&n);
+    if (b) {
+      playpos = b;
+      playend = b + n;
+      playheld = 1;
+      underrun = 0;
+      // the ring drains normally once the file has been read
+      uint8_t ahead = playring.queued() - 1;
+      if (!sdeof && ahead < playing->minBuffersAhead)
+        playing->minBuffersAhead = ahead;
+    } else if (sdeof) {
       playing->stop();
-      return;
+      return false;
     } else {
       // count overrun error if not at end of file
       if (playing->remainingBytesInChunk) {
         playing->errors++;
+        if (!underrun) {
+          underrun = 1;
+          playing->underruns++;
+        }
       }
-      return;
+      return false;
     }
   }
 
-  uint8_t dh, dl;
   if (playing->BitsPerSample == 16) {
 
     // 16-bit is signed
@@ -234,6 +267,24 @@ ISR(TIMER1_COMPA_vect) {
   dh = tmp >> 8;
   dl = tmp;
 #endif // DVOLUME
+  return true;
+}
+//------------------------------------------------------------------------------
+// timer interrupt for DAC
+ISR(TIMER1_COMPA_vect) {
+  uint8_t dh, dl;
+  if (!playing || !nextSample(dh, dl)) {
+    // keep the mixer voices going without wave data
+    if (!wavemixer)
+      return;
+    dh = 0X80;
+    dl = 0;
+  }
+  if (wavemixer) {
+    int16_t s = wavemixer->mix((int16_t)((uint16_t)(0X80 ^ dh) << 8 | dl));
+    dh = 0X80 ^ (s >> 8);
+    dl = s;
+  }
 
   // dac chip select low
   mcpDacCsLow();
@@ -266,29 +317,47 @@ ISR(TIMER1_COMPA_vect) {
   mcpDacCsHigh();
 }
 //------------------------------------------------------------------------------
-// this is the interrupt that fills the playbuffer
+// this is the interrupt that fills the play buffers
 
 ISR(TIMER1_COMPB_vect) {
 
   // turn off calling interrupt
   TIMSK1 &= ~_BV(OCIE1B);
 
-  if (sdstatus != SD_FILLING)
+  // the DAC ISR may stop the player while this runs
+  WaveHC *w = playing;
+  if (!w || sdfilling)
     return;
+  sdfilling = 1;
 
   // enable interrupts while reading the SD
   sei();
 
-  int16_t read = playing->readWaveData(sdbuff, PLAYBUFFLEN);
+  // fill every free buffer, the DAC ISR keeps playing meanwhile
+  uint32_t t0 = micros();
+  uint8_t *b;
+  while (!sdeof && (b = playring.fillBuffer())) {
+    uint32_t r0 = micros();
+    int16_t read = w->readWaveData(b, PLAYBUFFLEN);
+    uint32_t dt = micros() - r0;
+    w->readCount++;
+    w->readMicros += dt;
+    if (dt > w->maxReadMicros)
+      w->maxReadMicros = dt;
+    if (read > 0)
+      playring.commit(read);
+    else
+      sdeof = 1;
+  }
+  uint32_t dt = micros() - t0;
+  if (dt > w->maxRefillMicros)
+    w->maxRefillMicros = dt;
 
   cli();
-  if (read > 0) {
-    sdend = sdbuff + read;
-    sdstatus = SD_READY;
-  } else {
-    sdend = sdbuff;
-    sdstatus = SD_END_FILE;
-  }
+  sdfilling = 0;
+  // a buffer freed after the loop gave up would otherwise wait
+  if (playing && !sdeof && playring.fillBuffer())
+    TIMSK1 |= _BV(OCIE1B);
 }
 //------------------------------------------------------------------------------
 /** create an instance of WaveHC. */
@@ -384,7 +453,7 @@ uint8_t WaveHC::create(FatReader &f) {
     if (RATE_ERROR_LEVEL > 1) {
       return false;
     }
-  } else if (byteRate > 44100 && !f.isContiguous()) {
+  } else if (byteRate > 44100 && !f.isMapped()) {
     putstring_nl("High rate fragmented file!");
     if (RATE_ERROR_LEVEL > 1) {
       return false;
@@ -394,7 +463,7 @@ uint8_t WaveHC::create(FatReader &f) {
 
   fd = &f;
 
-  errors = 0;
+  resetStats();
   isplaying = 0;
   remainingBytesInChunk = 0;
 
@@ -435,42 +504,38 @@ void WaveHC::pause(void) {
 void WaveHC::play(void) {
   // setup the interrupt as necessary
 
-  int16_t read;
-
-  playing = this;
-
-  // fill the play buffer
-  read = readWaveData(buffer1, PLAYBUFFLEN);
-  if (read <= 0)
-    return;
-  playpos = buffer1;
-  playend = buffer1 + read;
-
-  // fill the second buffer
-  read = readWaveData(buffer2, PLAYBUFFLEN);
-  if (read < 0)
+  // fill all the play buffers
+  playring.begin(playbuffers, PLAYBUFFCOUNT, PLAYBUFFLEN);
+  sdeof = 0;
+  sdfilling = 0;
+  uint8_t *b;
+  while ((b = playring.fillBuffer())) {
+    int16_t read = readWaveData(b, PLAYBUFFLEN);
+    if (read <= 0) {
+      sdeof = 1;
+      break;
+    }
+    playring.commit(read);
+  }
+  uint16_t n;
+  b = playring.playBuffer(&n);
+  if (!b)
     return;
-  sdbuff = buffer2;
-  sdend = sdbuff + read;
-  sdstatus = SD_READY;
+  playpos = b;
+  playend = b + n;
+  playheld = 1;
+  underrun = 0;
 
   // its official!
   isplaying = 1;
 
-  // Setup mode for DAC ports
-  mcpDacInit();
-
-  // Set up timer one
-  // Normal operation - no pwm not connected to pins
-  TCCR1A = 0;
-  // no prescaling, CTC mode
-  TCCR1B = _BV(WGM12) | _BV(CS10);
   // Sample rate - play stereo interleaved
-  OCR1A = F_CPU / (dwSamplesPerSec * Channels);
-  // SD fill interrupt happens at TCNT1 == 1
-  OCR1B = 1;
-  // Enable timer interrupt for DAC ISR
-  TIMSK1 |= _BV(OCIE1A);
+  cli();
+  playing = this;
+  if (wavemixer)
+    wavemixer->setOutputRate(dwSamplesPerSec * Channels);
+  dacStart(dwSamplesPerSec * Channels);
+  sei();
 }
 //------------------------------------------------------------------------------
 /*! Read wave data.
@@ -518,6 +583,19 @@ int16_t WaveHC::readWaveData(uint8_t *buff, uint16_t len) {
   return ret;
 }
 //------------------------------------------------------------------------------
+/** Clear the errors, underrun and SD read time counters. */
+void WaveHC::resetStats(void) {
+  cli();
+  errors = 0;
+  underruns = 0;
+  minBuffersAhead = 0XFF;
+  readCount = 0;
+  readMicros = 0;
+  maxReadMicros = 0;
+  maxRefillMicros = 0;
+  sei();
+}
+//------------------------------------------------------------------------------
 /** Resume a paused player. */
 void WaveHC::resume(void) {
   cli();
@@ -548,6 +626,13 @@ void WaveHC::seek(uint32_t pos) {
     if (fd->seekSet(pos)) {
       // assumes a lot about the wave file
       remainingBytesInChunk = maxPos - pos;
+
+      // drop buffers read from the old position, refill from the new one
+      if (playing == this && !sdfilling) {
+        playring.discard(playheld);
+        sdeof = 0;
+        requestFill();
+      }
     }
   }
   sei();
@@ -569,12 +654,36 @@ void WaveHC::setSampleRate(uint32_t samplerate) {
     ;
 
   OCR1A = F_CPU / samplerate;
+  if (wavemixer)
+    wavemixer->setOutputRate(samplerate);
+  sei();
+}
+//------------------------------------------------------------------------------
+/**
+ * Mix sound effects over the wave data.
+ *
+ * The DAC ISR keeps running after a file ends so \a mixer voices play with
+ * or without a wave file.  pause() pauses the voices too.
+ *
+ * \param[in] mixer The mixer, already started with WaveMixer::begin(),
+ * or NULL to remove it.
+ */
+void WaveHC::setMixer(WaveMixer *mixer) {
+  cli();
+  wavemixer = mixer;
+  if (!playing) {
+    if (mixer)
+      dacStart(mixer->outputRate());
+    else
+      TIMSK1 &= ~_BV(OCIE1A);
+  }
   sei();
 }
 //------------------------------------------------------------------------------
 /** Stop the player. */
 void WaveHC::stop(void) {
-  TIMSK1 &= ~_BV(OCIE1A); // turn off interrupt
+  // turn off interrupts, the mixer keeps the DAC ISR
+  TIMSK1 &= ~(wavemixer ? _BV(OCIE1B) : _BV(OCIE1A) | _BV(OCIE1B));
   playing->isplaying = 0;
   playing = 0;
 }
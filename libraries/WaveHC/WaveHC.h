@@ -17,6 +17,8 @@
 #define WaveHC_h
 #include "Arduino.h"
 #include <FatReader.h>
+#include <WaveMixer.h>
+#include <WaveRing.h>
 /**
  * \file
  * WaveHC class
@@ -53,9 +55,17 @@
 #define PLAYBUFFLEN 512UL
 #endif //__AVR_ATmega168P__
 
+/**
+ * Number of wave data buffers, 2 to WAVE_RING_MAX.  The SD refill keeps all
+ * but the one being played full, so more buffers ride out longer SD read
+ * delays.  Use the WaveHC underruns and minBuffersAhead counters to pick a
+ * value for a card.  Four 256 byte buffers use the same RAM as two of 512.
+ */
+#define PLAYBUFFCOUNT 2
+
 // Define max allowed SD read rate in bytes/sec.
 #if PLAYBUFFLEN == 512UL && OPTIMIZE_CONTIGUOUS
-/** Maximum SD read rate for 512 byte buffer and contiguous file */
+/** Maximum SD read rate for 512 byte buffer and contiguous or mapped file */
 #define MAX_BYTE_RATE 88200
 #else // MAX_BYTE_RATE
 /** Maximum SD read rate for 256 byte buffer or fragmented file */
@@ -94,6 +104,22 @@ public:
   volatile uint8_t isplaying;
   /** Number of times data was not available from the SD in the DAC ISR */
   uint32_t errors;
+  /** Number of times the DAC ISR ran out of buffers before end of file */
+  uint16_t underruns;
+  /**
+   * Fewest full buffers waiting behind the one being played when the DAC ISR
+   * started a buffer, at most PLAYBUFFCOUNT - 2.  Zero with more than two
+   * buffers means one more slow SD read would have caused an underrun.
+   */
+  uint8_t minBuffersAhead;
+  /** Number of SD reads into a buffer */
+  uint32_t readCount;
+  /** Total time of SD reads into buffers, microseconds */
+  uint32_t readMicros;
+  /** Longest single SD read into a buffer, microseconds */
+  uint32_t maxReadMicros;
+  /** Longest refill, one or more SD reads, microseconds */
+  uint32_t maxRefillMicros;
 
   /** Software volume control. Reduce volume by 6 dB per step. See DAC ISR. */
   uint8_t volume;
@@ -111,10 +137,12 @@ public:
   void pause(void);
   void play(void);
   int16_t readWaveData(uint8_t *buff, uint16_t len);
+  void resetStats(void);
   void resume(void);
   void seek(uint32_t pos);
   void setSampleRate(uint32_t samplerate);
   void stop(void);
+  static void setMixer(WaveMixer *mixer);
 };
 
 #endif // WaveHC_h
@@ -0,0 +1,268 @@
+/* Arduino WaveHC Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino WaveHC Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino WaveHC Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <WaveMixer.h>
+#include <WaveRing.h>
+#include <string.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+/** Run a block with the DAC ISR held off */
+#define MIXER_ATOMIC ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#else // __AVR__
+// PC build for testing, flash is ordinary memory
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define MIXER_ATOMIC
+#endif // __AVR__
+//------------------------------------------------------------------------------
+// read voice data from RAM or flash
+static inline uint8_t voiceByte(const uint8_t *p, uint8_t flags) {
+  return flags & VOICE_PROGMEM ? pgm_read_byte(p) : *p;
+}
+static inline uint16_t voiceWord(const uint8_t *p, uint8_t flags) {
+  if (flags & VOICE_PROGMEM)
+    return pgm_read_word(p);
+  return p[0] | (p[1] << 8);
+}
+static uint32_t voiceLong(const uint8_t *p, uint8_t flags) {
+  return voiceWord(p, flags) | (uint32_t)voiceWord(p + 2, flags) << 16;
+}
+// sample n of a voice as signed 16-bit
+static inline int16_t voiceSample(WaveVoice *v, uint16_t n) {
+  if (v->flags & VOICE_16BIT)
+    return voiceWord(v->data + 2 * n, v->flags);
+  // 8-bit is unsigned
+  return (int16_t)((0X80 ^ voiceByte(v->data + n, v->flags)) << 8);
+}
+//------------------------------------------------------------------------------
+/** Create a mixer with all voices stopped. Call begin() before use. */
+WaveMixer::WaveMixer(void) : clips(0), outputRate_(22050) {
+  memset(voice_, 0, sizeof(voice_));
+}
+//------------------------------------------------------------------------------
+/** \return The number of voices playing. */
+uint8_t WaveMixer::activeVoices(void) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < WAVE_MIXER_VOICES; i++) {
+    if (voice_[i].active)
+      n++;
+  }
+  return n;
+}
+//------------------------------------------------------------------------------
+/**
+ * Mix the active voices into one output sample.  Called by the DAC ISR.
+ *
+ * \param[in] in Wave file sample, signed 16-bit, zero if none.
+ *
+ * \return \a in plus the voices, clipped to signed 16-bit.
+ */
+int16_t WaveMixer::mix(int16_t in) {
+  int32_t sum = in;
+  for (uint8_t i = 0; i < WAVE_MIXER_VOICES; i++) {
+    WaveVoice *v = &voice_[i];
+    if (!v->active)
+      continue;
+    uint16_t n = v->phase >> 16;
+    if (n >= v->length) {
+      if (!(v->flags & VOICE_LOOP)) {
+        v->active = 0;
+        continue;
+      }
+      do {
+        v->phase -= (uint32_t)v->length << 16;
+        n = v->phase >> 16;
+      } while (n >= v->length);
+    }
+    int16_t s = voiceSample(v, n);
+
+    // interpolate between samples when resampling
+    uint8_t frac = v->phase >> 8;
+    if (frac) {
+      uint16_t m = n + 1;
+      if (m >= v->length)
+        m = v->flags & VOICE_LOOP ? 0 : n;
+      int16_t t = voiceSample(v, m);
+      s += (((int32_t)t - s) * frac) >> 8;
+    }
+    if (v->gain != 255)
+      s = ((int32_t)s * v->gain) >> 8;
+    sum += s;
+    v->phase += v->step;
+  }
+  if (sum > 32767) {
+    clips++;
+    return 32767;
+  }
+  if (sum < -32768) {
+    clips++;
+    return -32768;
+  }
+  return sum;
+}
+//------------------------------------------------------------------------------
+/**
+ * Start a voice from the beginning, replacing any sound on it.
+ *
+ * \param[in] voice Voice number, 0 to WAVE_MIXER_VOICES - 1.
+ * \param[in] data Mono samples in RAM, or in flash with VOICE_PROGMEM.
+ * \param[in] length Number of samples, at most VOICE_MAX_LENGTH.
+ * \param[in] rate Sample rate of \a data.  Change it to change pitch.
+ * \param[in] flags VOICE_PROGMEM, VOICE_16BIT and VOICE_LOOP bits.
+ * \param[in] gain Gain, 255 for full level.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for an invalid argument.
+ */
+uint8_t WaveMixer::play(uint8_t voice, const uint8_t *data, uint16_t length,
+                        uint16_t rate, uint8_t flags, uint8_t gain) {
+  if (voice >= WAVE_MIXER_VOICES || !data || !length ||
+      length > VOICE_MAX_LENGTH || !rate)
+    return false;
+  WaveVoice *v = &voice_[voice];
+
+  // the DAC ISR skips the voice until it is set up
+  v->active = 0;
+  WAVE_RING_BARRIER();
+  v->data = data;
+  v->length = length;
+  v->rate = rate;
+  v->phase = 0;
+  v->step = stepFor(rate);
+  v->gain = gain;
+  v->flags = flags;
+  // the DAC ISR must see the fields above before it sees the voice start
+  WAVE_RING_BARRIER();
+  v->active = 1;
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Start a voice playing a wave file image, for example a .WAV file
+ * converted to a PROGMEM array.
+ *
+ * \param[in] voice Voice number, 0 to WAVE_MIXER_VOICES - 1.
+ * \param[in] wav The wave file, in RAM or in flash with VOICE_PROGMEM.
+ * Must be mono PCM with 8 or 16 bits per sample.
+ * \param[in] flags VOICE_PROGMEM and VOICE_LOOP bits.
+ * \param[in] gain Gain, 255 for full level.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for an invalid or unsupported file.
+ */
+uint8_t WaveMixer::playWav(uint8_t voice, const uint8_t *wav, uint8_t flags,
+                           uint8_t gain) {
+  if (!wav || voiceLong(wav, flags) != 0X46464952UL ||  // "RIFF"
+      voiceLong(wav + 8, flags) != 0X45564157UL) {      // "WAVE"
+    return false;
+  }
+  uint32_t riffEnd = voiceLong(wav + 4, flags) + 8;
+  uint16_t rate = 0;
+  uint8_t bits = 0;
+  for (uint32_t pos = 12; pos + 8 <= riffEnd;) {
+    uint32_t id = voiceLong(wav + pos, flags);
+    uint32_t size = voiceLong(wav + pos + 4, flags);
+    const uint8_t *body = wav + pos + 8;
+    if (id == 0X20746D66UL) { // "fmt "
+      // PCM, mono, rate below 64K
+      if (size < 16 || voiceWord(body, flags) != 1 ||
+          voiceWord(body + 2, flags) != 1 || voiceWord(body + 6, flags)) {
+        return false;
+      }
+      rate = voiceWord(body + 4, flags);
+      bits = voiceWord(body + 14, flags);
+      if (bits != 8 && bits != 16)
+        return false;
+    } else if (id == 0X61746164UL) { // "data"
+      if (!rate)
+        return false;
+      if (bits == 16) {
+        flags |= VOICE_16BIT;
+        size /= 2;
+      } else {
+        flags &= ~VOICE_16BIT;
+      }
+      if (size > VOICE_MAX_LENGTH)
+        return false;
+      return play(voice, body, size, rate, flags, gain);
+    }
+    // chunks are padded to an even size
+    pos += 8 + size + (size & 1);
+  }
+  return false;
+}
+//------------------------------------------------------------------------------
+/**
+ * Set the gain of a voice.  May be called while it plays.
+ *
+ * \param[in] voice Voice number.
+ * \param[in] gain Gain, 255 for full level.
+ */
+void WaveMixer::setGain(uint8_t voice, uint8_t gain) {
+  if (voice < WAVE_MIXER_VOICES)
+    voice_[voice].gain = gain;
+}
+//------------------------------------------------------------------------------
+/**
+ * Set the output sample rate and resample the voices to it.
+ *
+ * \param[in] outputRate Output samples per second.
+ */
+void WaveMixer::setOutputRate(uint32_t outputRate) {
+  outputRate_ = outputRate ? outputRate : 1;
+  for (uint8_t i = 0; i < WAVE_MIXER_VOICES; i++) {
+    uint32_t step = stepFor(voice_[i].rate);
+    MIXER_ATOMIC { voice_[i].step = step; }
+  }
+}
+//------------------------------------------------------------------------------
+/**
+ * Change the sample rate, and so the pitch, of a voice.  May be called
+ * while it plays.
+ *
+ * \param[in] voice Voice number.
+ * \param[in] rate New sample rate.
+ */
+void WaveMixer::setRate(uint8_t voice, uint16_t rate) {
+  if (voice >= WAVE_MIXER_VOICES || !rate)
+    return;
+  uint32_t step = stepFor(rate);
+  MIXER_ATOMIC {
+    voice_[voice].rate = rate;
+    voice_[voice].step = step;
+  }
+}
+//------------------------------------------------------------------------------
+/** Stop a voice. */
+void WaveMixer::stop(uint8_t voice) {
+  if (voice < WAVE_MIXER_VOICES)
+    voice_[voice].active = 0;
+}
+//------------------------------------------------------------------------------
+/** Stop all voices. */
+void WaveMixer::stopAll(void) {
+  for (uint8_t i = 0; i < WAVE_MIXER_VOICES; i++)
+    voice_[i].active = 0;
+}
+//------------------------------------------------------------------------------
+// phase step for a voice rate, 16.16 fixed point
+uint32_t WaveMixer::stepFor(uint16_t rate) {
+  return (((uint32_t)rate << 16) + outputRate_ / 2) / outputRate_;
+}
@@ -0,0 +1,119 @@
+/* Arduino WaveHC Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino WaveHC Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino WaveHC Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef WaveMixer_h
+#define WaveMixer_h
+#include <stdint.h>
+/**
+ * \file
+ * WaveMixer class
+ */
+#ifndef WAVE_MIXER_VOICES
+/**
+ * Number of sound effect voices mixed over the wave file.  Each active
+ * voice adds to the DAC ISR time, see the MixerBenchHC example.
+ */
+#define WAVE_MIXER_VOICES 3
+#endif // WAVE_MIXER_VOICES
+
+/** Voice data is in flash, declared PROGMEM. */
+#define VOICE_PROGMEM 1
+/** Voice data is 16-bit signed samples, else 8-bit unsigned. */
+#define VOICE_16BIT 2
+/** Voice starts over at its end until stopped. */
+#define VOICE_LOOP 4
+
+/** Most samples in a voice. */
+#define VOICE_MAX_LENGTH 0X8000
+//------------------------------------------------------------------------------
+/**
+ * \struct WaveVoice
+ * \brief State of one sound effect voice.
+ */
+struct WaveVoice {
+  /** First sample of the voice data. */
+  const uint8_t *data;
+  /** Number of samples. */
+  uint16_t length;
+  /** Voice data sample rate. */
+  uint16_t rate;
+  /** Position in samples, 16.16 fixed point. */
+  uint32_t phase;
+  /** Phase increment per output sample, rate / output rate in 16.16. */
+  uint32_t step;
+  /** Gain, 255 is full level. */
+  uint8_t gain;
+  /** VOICE_PROGMEM, VOICE_16BIT and VOICE_LOOP bits. */
+  uint8_t flags;
+  /** Nonzero while the voice is playing. */
+  volatile uint8_t active;
+};
+//------------------------------------------------------------------------------
+/**
+ * \class WaveMixer
+ * \brief Mix mono sound effects from RAM or flash over the wave file.
+ *
+ * Each output sample the DAC ISR passes the wave file sample to mix().
+ * Voices are resampled to the output rate with linear interpolation,
+ * scaled by their gain and added, and the sum is clipped to 16 bits.
+ * Attach a mixer with WaveHC::setMixer().
+ *
+ * Has no hardware dependencies so it can be built and tested on a PC.
+ */
+class WaveMixer {
+public:
+  /** Number of output samples clipped because the sum was too loud. */
+  uint32_t clips;
+
+  WaveMixer(void);
+  /**
+   * Stop all voices and set the output rate.
+   *
+   * \param[in] outputRate Output sample rate used when no wave file is
+   * playing.  WaveHC changes it to the rate of each file it plays.
+   */
+  void begin(uint32_t outputRate) {
+    stopAll();
+    clips = 0;
+    setOutputRate(outputRate);
+  }
+  /** \return Nonzero if \a voice is playing. */
+  uint8_t isPlaying(uint8_t voice) {
+    return voice < WAVE_MIXER_VOICES && voice_[voice].active;
+  }
+  /** \return The output sample rate. */
+  uint32_t outputRate(void) { return outputRate_; }
+  uint8_t activeVoices(void);
+  int16_t mix(int16_t in);
+  uint8_t play(uint8_t voice, const uint8_t *data, uint16_t length,
+               uint16_t rate, uint8_t flags = 0, uint8_t gain = 255);
+  uint8_t playWav(uint8_t voice, const uint8_t *wav, uint8_t flags = 0,
+                  uint8_t gain = 255);
+  void setGain(uint8_t voice, uint8_t gain);
+  void setOutputRate(uint32_t outputRate);
+  void setRate(uint8_t voice, uint16_t rate);
+  void stop(uint8_t voice);
+  void stopAll(void);
+
+private:
+  uint32_t outputRate_;
+  WaveVoice voice_[WAVE_MIXER_VOICES];
+  uint32_t stepFor(uint16_t rate);
+};
+#endif // WaveMixer_h
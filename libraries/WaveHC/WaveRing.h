@@ -0,0 +1,141 @@
+/* Arduino WaveHC Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino WaveHC Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino WaveHC Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef WaveRing_h
+#define WaveRing_h
+#include <stddef.h>
+#include <stdint.h>
+/**
+ * \file
+ * WaveRing class
+ */
+/** Maximum number of buffers in a WaveRing */
+#define WAVE_RING_MAX 8
+
+/** Keep the compiler from moving buffer stores past the index update */
+#define WAVE_RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+//------------------------------------------------------------------------------
+/**
+ * \class WaveRing
+ * \brief Ring of play buffers shared by the SD refill and DAC interrupts.
+ *
+ * The refill side (producer) only writes head_ and the DAC side (consumer)
+ * only writes tail_, so neither needs to disable interrupts.  The consumer
+ * holds the buffer it is playing until release(), so the producer can have
+ * at most count - 1 buffers queued ahead of it.  Indices run from 0 to
+ * 2 * count - 1 so a full ring can be told from an empty one for any count.
+ * Has no hardware dependencies.
+ */
+class WaveRing {
+  uint8_t *buf_;
+  uint16_t len_;
+  uint8_t count_;
+  volatile uint8_t head_;
+  volatile uint8_t tail_;
+  uint16_t fill_[WAVE_RING_MAX];
+  uint8_t next(uint8_t i) { return i + 1 == 2 * count_ ? 0 : i + 1; }
+  uint8_t slot(uint8_t i) { return i < count_ ? i : i - count_; }
+
+public:
+  /** Create an empty WaveRing. Call begin() before use. */
+  WaveRing(void) : buf_(0), len_(0), count_(0), head_(0), tail_(0) {}
+  /**
+   * Set up the ring over caller supplied storage and empty it.
+   * Must not be called while either side is running.
+   *
+   * \param[in] storage \a count * \a len bytes.
+   * \param[in] count Number of buffers, 2 to WAVE_RING_MAX.
+   * \param[in] len Bytes per buffer.
+   *
+   * \return The value one, true, is returned for success and
+   * the value zero, false, is returned for an invalid argument.
+   */
+  uint8_t begin(uint8_t *storage, uint8_t count, uint16_t len) {
+    if (!storage || count < 2 || count > WAVE_RING_MAX || !len)
+      return false;
+    buf_ = storage;
+    count_ = count;
+    len_ = len;
+    head_ = 0;
+    tail_ = 0;
+    return true;
+  }
+  /** \return Number of full buffers, including one being played. */
+  uint8_t queued(void) {
+    int8_t n = head_ - tail_;
+    return n < 0 ? n + 2 * count_ : n;
+  }
+  /** \return Bytes per buffer. */
+  uint16_t bufferLength(void) { return len_; }
+  /**
+   * PRODUCER: the buffer to fill next.
+   *
+   * \return Pointer to bufferLength() bytes, or NULL if all buffers are full.
+   */
+  uint8_t *fillBuffer(void) {
+    if (queued() >= count_)
+      return 0;
+    return buf_ + (uint16_t)slot(head_) * len_;
+  }
+  /**
+   * PRODUCER: queue the buffer from fillBuffer() for the consumer.
+   *
+   * \param[in] n Number of bytes stored in it.
+   */
+  void commit(uint16_t n) {
+    fill_[slot(head_)] = n;
+    WAVE_RING_BARRIER();
+    head_ = next(head_);
+  }
+  /**
+   * CONSUMER: the oldest full buffer.  Returns the same buffer until
+   * release() is called.
+   *
+   * \param[out] n Number of bytes in the buffer.
+   *
+   * \return Pointer to the buffer, or NULL if none is full.
+   */
+  uint8_t *playBuffer(uint16_t *n) {
+    if (head_ == tail_)
+      return 0;
+    WAVE_RING_BARRIER();
+    *n = fill_[slot(tail_)];
+    return buf_ + (uint16_t)slot(tail_) * len_;
+  }
+  /** CONSUMER: done with the buffer from playBuffer(), let it be refilled. */
+  void release(void) {
+    if (head_ != tail_) {
+      WAVE_RING_BARRIER();
+      tail_ = next(tail_);
+    }
+  }
+  /**
+   * Drop queued buffers, keeping the oldest \a keep.  Both sides must be
+   * stopped, for example with interrupts disabled and no refill running.
+   *
+   * \param[in] keep Number of buffers to keep, e.g. one being played.
+   */
+  void discard(uint8_t keep) {
+    uint8_t h = tail_;
+    for (uint8_t i = 0; i < keep && i < queued(); i++)
+      h = next(h);
+    head_ = h;
+  }
+};
+#endif // WaveRing_h
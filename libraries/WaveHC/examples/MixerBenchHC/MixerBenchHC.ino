@@ -0,0 +1,88 @@
+/*
+ * Measure the DAC ISR time used by WaveMixer for each number of voices.
+ *
+ * Each line shows the microseconds WaveMixer::mix() takes per output
+ * sample and the percent of a 22050 Hz sample period used by it plus the
+ * DAC write and wave data read, about 10 microseconds on a 16 MHz Arduino.
+ * Resampled voices interpolate between samples and cost more than voices
+ * at the output rate.  Keep the total well below 100 percent so the SD
+ * refill ISR and loop() get time to run.
+ *
+ * No SD card or Wave Shield is needed.
+ */
+#include <WaveHC.h>
+#include <WaveMixer.h>
+#include <WaveUtil.h>
+
+WaveMixer mixer;
+
+#define OUTPUT_RATE 22050
+#define MIX_COUNT 2000
+#define ISR_OVERHEAD_US 10.0
+
+// one cycle of a sine wave, 8-bit unsigned like an 8-bit wave file
+const uint8_t sine32[32] PROGMEM = {
+  128, 148, 166, 184, 199, 211, 220, 226, 228, 226, 220, 211, 199, 184, 166,
+  148, 128, 108, 90, 72, 57, 45, 36, 30, 28, 30, 36, 45, 57, 72, 90, 108};
+
+// 16-bit samples in RAM
+int16_t ramSamples[128];
+
+void setup() {
+  Serial.begin(9600);
+  for (uint8_t i = 0; i < 128; i++) {
+    ramSamples[i] = (pgm_read_byte(&sine32[i & 31]) - 128) << 8;
+  }
+  mixer.begin(OUTPUT_RATE);
+  PgmPrintln("voices,data,rate,us/sample,% of ISR period");
+  for (uint8_t resample = 0; resample < 2; resample++) {
+    for (uint8_t flash = 0; flash < 2; flash++) {
+      for (uint8_t n = 0; n <= WAVE_MIXER_VOICES; n++) {
+        bench(n, flash, resample);
+      }
+    }
+  }
+  PgmPrint("FreeRam: ");
+  Serial.println(FreeRam());
+}
+
+void loop() {}
+
+// time mix() with n looping voices
+void bench(uint8_t n, uint8_t flash, uint8_t resample) {
+  uint16_t rate = resample ? 11025 + 100 : OUTPUT_RATE;
+  mixer.stopAll();
+  for (uint8_t v = 0; v < n; v++) {
+    if (flash) {
+      mixer.play(v, sine32, 32, rate, VOICE_PROGMEM | VOICE_LOOP, 80);
+    } else {
+      mixer.play(v, (uint8_t *)ramSamples, 128, rate, VOICE_16BIT | VOICE_LOOP,
+                 80);
+    }
+  }
+  int16_t sum = 0;
+  uint32_t m = micros();
+  for (uint16_t i = 0; i < MIX_COUNT; i++) {
+    sum += mixer.mix(i);
+  }
+  m = micros() - m;
+  float us = (float)m / MIX_COUNT;
+  Serial.print(n);
+  if (flash) {
+    PgmPrint(",8-bit flash");
+  } else {
+    PgmPrint(",16-bit RAM");
+  }
+  if (resample) {
+    PgmPrint(",resampled,");
+  } else {
+    PgmPrint(",output rate,");
+  }
+  Serial.print(us, 2);
+  Serial.print(',');
+  Serial.println((us + ISR_OVERHEAD_US) * OUTPUT_RATE / 1e4, 1);
+  // keep the compiler from dropping the mix
+  if (sum == 12345) {
+    Serial.println();
+  }
+}
@@ -0,0 +1,138 @@
+/*
+ * Play MUSIC.WAV over and over with sound effects mixed on top.
+ *
+ * A coin sound plays when a button on analog pin 1 is pressed and a
+ * laser sound when a button on analog pin 2 is pressed.  Buttons connect
+ * the pin to ground.  Both sounds are a 32 sample sine wave in flash played
+ * at different rates to set the pitch, so they need no SD reads.
+ *
+ * A 16 KHz or 22 KHz MUSIC.WAV leaves time in the DAC ISR for the mixer.
+ * Loud music and effects are clipped; mixer.clips counts clipped samples.
+ */
+#include <WaveHC.h>
+#include <WaveMixer.h>
+#include <WaveUtil.h>
+
+SdReader card;    // This object holds the information for the card
+FatVolume vol;    // This holds the information for the partition on the card
+FatReader root;   // This holds the information for the volumes root directory
+FatReader file;   // This object represent the WAV file
+WaveHC wave;      // The music bed
+WaveMixer mixer;  // The sound effects
+
+#define COIN_PIN A1
+#define LASER_PIN A2
+
+#define COIN_VOICE 0
+#define LASER_VOICE 1
+
+// one cycle of a sine wave, 8-bit unsigned like an 8-bit wave file
+const uint8_t sine32[32] PROGMEM = {
+  128, 148, 166, 184, 199, 211, 220, 226, 228, 226, 220, 211, 199, 184, 166,
+  148, 128, 108, 90, 72, 57, 45, 36, 30, 28, 30, 36, 45, 57, 72, 90, 108};
+
+/*
+ * Define macro to put error messages in flash memory
+ */
+#define error(msg) error_P(PSTR(msg))
+
+//////////////////////////////////// SETUP
+void setup() {
+  Serial.begin(9600);
+  Serial.println("Mixer test!");
+  pinMode(COIN_PIN, INPUT_PULLUP);
+  pinMode(LASER_PIN, INPUT_PULLUP);
+
+  // try card.init(true) if errors occur on V1.0 Wave Shield
+  if (!card.init()) {
+    error("Card init. failed!");
+  }
+  // enable optimize read - some cards may timeout
+  card.partialBlockRead(true);
+  // stream sequential blocks with one read command - disable if other SPI
+  // devices share the bus
+  card.multiBlockRead(true);
+
+  if (!vol.init(card)) {
+    error("No partition!");
+  }
+  if (!root.openRoot(vol)) {
+    error("Couldn't open root");
+  }
+  char name[] = "MUSIC.WAV";
+  if (!file.open(root, name)) {
+    error("Couldn't open MUSIC.WAV");
+  }
+  // the mixer runs the DAC at this rate until the music starts
+  mixer.begin(22050);
+  WaveHC::setMixer(&mixer);
+}
+
+// sound effect state
+uint8_t coinStep = 0;
+uint32_t coinTime;
+uint8_t laserStep = 0;
+
+//////////////////////////////////// LOOP
+void loop() {
+  // restart the music when it ends
+  if (!wave.isplaying) {
+    file.rewind();
+    if (!wave.create(file)) {
+      error("MUSIC.WAV is not a valid WAV");
+    }
+    wave.play();
+  }
+
+  // coin: a short B5 then a longer E6, rate = 32 * frequency
+  if (coinStep == 0 && digitalRead(COIN_PIN) == LOW) {
+    mixer.play(COIN_VOICE, sine32, 32, 32 * 988, VOICE_PROGMEM | VOICE_LOOP,
+               160);
+    coinTime = millis();
+    coinStep = 1;
+  } else if (coinStep == 1 && millis() - coinTime >= 80) {
+    mixer.setRate(COIN_VOICE, 32 * 1319);
+    coinStep = 2;
+  } else if (coinStep == 2 && millis() - coinTime >= 400) {
+    mixer.stop(COIN_VOICE);
+    coinStep = 0;
+  }
+
+  // laser: a falling sweep that fades out
+  if (laserStep == 0 && digitalRead(LASER_PIN) == LOW) {
+    mixer.play(LASER_VOICE, sine32, 32, 32 * 1800, VOICE_PROGMEM | VOICE_LOOP,
+               200);
+    laserStep = 1;
+  } else if (laserStep) {
+    if (++laserStep == 40) {
+      mixer.stop(LASER_VOICE);
+      laserStep = 0;
+    } else {
+      mixer.setRate(LASER_VOICE, 32 * (1800 - 40 * laserStep));
+      mixer.setGain(LASER_VOICE, 200 - 5 * laserStep);
+    }
+  }
+  delay(5);
+}
+
+/////////////////////////////////// HELPERS
+/*
+ * print error message and halt
+ */
+void error_P(const char *str) {
+  PgmPrint("Error: ");
+  SerialPrint_P(str);
+  sdErrorCheck();
+  while(1);
+}
+/*
+ * print error message and halt if SD I/O error, great for debugging!
+ */
+void sdErrorCheck(void) {
+  if (!card.errorCode()) return;
+  PgmPrint("\r\nSD I/O error: ");
+  Serial.print(card.errorCode(), HEX);
+  PgmPrint(", ");
+  Serial.println(card.errorData(), HEX);
+  while(1);
+}
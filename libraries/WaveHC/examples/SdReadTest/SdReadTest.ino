@@ -59,6 +59,24 @@ uint8_t partDmp(void) {
   return true;
 }
 
+// time reading nBlock consecutive blocks, one command per block or one
+// multiple block read for the whole run
+uint32_t seqReadTest(uint8_t multi, uint16_t nBlock) {
+  static uint8_t blk[512];
+  card.multiBlockRead(multi);
+  uint32_t t0 = millis();
+  for (uint16_t i = 0; i < nBlock; i++) {
+    if (!card.readBlock(i, blk)) {
+      card.multiBlockRead(false);
+      return 0;
+    }
+  }
+  card.readEnd();
+  uint32_t t = millis() - t0;
+  card.multiBlockRead(false);
+  return t;
+}
+
 void sdError(void) {
   putstring_nl("SD error");
   putstring("errorCode: ");
@@ -135,6 +153,19 @@ void loop(void) {
   putstring("mills: ");
   Serial.println(m1 - m0);
   if(r) {
+    uint16_t nSeq = 1000;
+    putstring_nl("\nSequential read, KB/sec");
+    for (uint8_t multi = 0; multi < 2; multi++) {
+      if (multi) putstring("multiple block: ");
+      else putstring("single block: ");
+      uint32_t t = seqReadTest(multi, nSeq);
+      if (t == 0) {
+        putstring_nl("read failed");
+        sdError();
+        return;
+      }
+      Serial.println(512UL * nSeq / t);
+    }
     putstring_nl("\nDone");
   }
   else {
@@ -31,6 +31,9 @@ void setup() {
   }
   // enable optimize read - some cards may timeout
   card.partialBlockRead(true);
+  // stream sequential blocks with one read command - disable if other SPI
+  // devices share the bus
+  card.multiBlockRead(true);
   
   if (!vol.init(card)) {
     error("No partition!");
@@ -37,6 +37,9 @@ void setup() {
   
   // enable optimize read - some cards may timeout. Disable if you're having problems
   card.partialBlockRead(true);
+  // stream sequential blocks with one read command - disable if other SPI
+  // devices share the bus
+  card.multiBlockRead(true);
   
   // Now we will look for a FAT partition!
   uint8_t part;
@@ -14,8 +14,12 @@
  * Run this sketch using the prepared SD.  Notice the
  * difference in latency between play by name and
  * play by index.
+ *
+ * Play by hashed name uses a FatDirIndex of the .WAV files in root.
+ * It opens by name as fast as play by index.
  */
 
+#include <FatDirIndex.h>
 #include <WaveHC.h>
 #include <WaveUtil.h>
 
@@ -41,6 +45,9 @@ void setup() {
 
   // enable optimized read - some cards may timeout
   card.partialBlockRead(true);
+  // stream sequential blocks with one read command - disable if other SPI
+  // devices share the bus
+  card.multiBlockRead(true);
 
   if (!vol.init(card)) error("vol.init");
 
@@ -54,6 +61,9 @@ void setup() {
 
   PgmPrintln("Play files by name");
   playByName();
+
+  PgmPrintln("Play files by hashed name");
+  playByHashedName();
 }
 
 //////////////////////////////////// LOOP
@@ -93,6 +103,11 @@ char fileLetter[] =  {'0', '1', '2', '3', '4', '5', '6',
       
 // index of DTMF files in the root directory
 uint16_t fileIndex[FILE_COUNT];
+
+// hash table of .WAV file names in the root directory
+#define HASH_TABLE_SIZE 24
+dirIndex_t hashTable[HASH_TABLE_SIZE];
+FatDirIndex wavIndex;
 /*
  * Find files and save file index.  A file's index is is the
  * index of it's directory entry in it's directory file. 
@@ -182,3 +197,47 @@ void playByName(void) {
   }
   PgmPrintln("Done");
 }
+/*
+ * Play file by name using the FatDirIndex and print latency in ms
+ */
+void playByHashedName(void) {
+  char name[10];
+
+  // read the directory once, the time is paid before play starts
+  uint32_t t = millis();
+  if (!wavIndex.begin(root, hashTable, HASH_TABLE_SIZE, "WAV")) {
+    error("wavIndex.begin");
+  }
+  PgmPrint("Index built in ");
+  Serial.print(millis() - t);
+  PgmPrintln(" ms");
+
+  // copy flash string to RAM
+  strcpy_P(name, PSTR("DTMFx.WAV"));
+
+  for (uint8_t i = 0; i < FILE_COUNT; i++) {
+    // start time
+    t = millis();
+
+    // make file name
+    name[4] = fileLetter[i];
+
+    // open file by name without scanning the directory
+    if (!wavIndex.open(file, name)) error("open by hashed name");
+
+    // create wave and start play
+    if (!wave.create(file)) error("wave.create");
+    wave.play();
+
+    // print time
+    Serial.println(millis() - t);
+
+    // stop after PLAY_TIME ms
+    while((millis() - t) < PLAY_TIME);
+    wave.stop();
+
+    // check for play errors
+    sdErrorCheck();
+  }
+  PgmPrintln("Done");
+}
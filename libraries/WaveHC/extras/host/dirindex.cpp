@@ -0,0 +1,168 @@
+// Tests FatDirIndex on a disk image made by "fatimage.py dir": opens every
+// file in the list by index, in mixed case, checks it is the right one and
+// compares the simulated time with FatReader::open(dir, name).  Names that
+// aren't on the disk, including ones that share a hash with a file that
+// is, must not be found.
+//
+// Usage: dirindex <image> <list> <multi>
+#include <Arduino.h>
+#include <FatDirIndex.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "hostcard.h"
+
+/** A file in the list */
+struct Listed {
+  std::string dir, name;
+  uint32_t cluster, size;
+};
+//------------------------------------------------------------------------------
+int main(int argc, char **argv) {
+  static SdReader card;
+  static FatVolume vol;
+  static FatReader root, sfx, file, byIndex;
+  static dirIndex_t rootTable[600], sfxTable[450], wavTable[40];
+  static FatDirIndex rootIndex, sfxIndex, wavIndex;
+  std::vector<Listed> files;
+  std::vector<std::string> missing;
+  char name[20];
+  int fails = 0;
+
+  if (argc != 4 || !cardLoad(argv[1])) {
+    puts("usage: dirindex <image> <list> <multi>");
+    return 2;
+  }
+  FILE *f = fopen(argv[2], "r");
+  if (!f)
+    return 2;
+  char dir[16];
+  unsigned long cluster, size;
+  while (fscanf(f, "%15s %15s", dir, name) == 2) {
+    if (!strcmp(dir, "missing")) {
+      missing.push_back(name);
+    } else if (fscanf(f, "%lu %lu", &cluster, &size) == 2) {
+      files.push_back({dir, name, (uint32_t)cluster, (uint32_t)size});
+    }
+  }
+  fclose(f);
+
+  strcpy(name, "sfx");
+  if (!card.init()) {
+    puts("card.init failed");
+    return 1;
+  }
+  card.partialBlockRead(true);
+  card.multiBlockRead(atoi(argv[3]));
+  if (!vol.init(card) || !root.openRoot(vol) || !sfx.open(root, name) ||
+      !sfx.isDir()) {
+    puts("can't open SFX");
+    return 1;
+  }
+  unsigned long long t0 = simNs;
+  if (!rootIndex.begin(root, rootTable, 600) ||
+      !sfxIndex.begin(sfx, sfxTable, 450)) {
+    puts("FAIL: begin");
+    return 1;
+  }
+  double buildMs = (simNs - t0) / 1e6;
+  uint16_t shared = 0;
+  for (uint16_t i = 0; i < 600; i++) {
+    if (rootTable[i].index != DIR_INDEX_EMPTY &&
+        (rootTable[i].index & DIR_INDEX_SHARED)) {
+      shared++;
+    }
+  }
+
+  double indexUs = 0, scanUs = 0, worstIndexUs = 0, worstScanUs = 0;
+  srand(1);
+  for (size_t i = 0; i < files.size(); i++) {
+    Listed &e = files[i];
+    FatReader &d = e.dir == "/" ? root : sfx;
+    FatDirIndex &index = e.dir == "/" ? rootIndex : sfxIndex;
+    strcpy(name, e.name.c_str());
+    for (char *p = name; *p; p++) {
+      if (rand() & 1)
+        *p = tolower(*p);
+    }
+    t0 = simNs;
+    if (!index.open(file, name) || file.firstCluster() != e.cluster ||
+        file.fileSize() != e.size) {
+      printf("FAIL: open %s\n", name);
+      fails++;
+      continue;
+    }
+    double us = (simNs - t0) / 1e3;
+    indexUs += us;
+    if (us > worstIndexUs)
+      worstIndexUs = us;
+    uint8_t buf[16];
+    int16_t n = file.read(buf, sizeof(buf));
+    if (n < 1 || memcmp(buf, e.name.c_str(), n < (int16_t)e.name.size() ?
+                                                 n : e.name.size())) {
+      printf("FAIL: %s has the wrong data\n", name);
+      fails++;
+    }
+    int32_t at = index.lookup(name);
+    if (at < 0 || !byIndex.open(d, (uint16_t)at) ||
+        byIndex.firstCluster() != e.cluster) {
+      printf("FAIL: lookup %s\n", name);
+      fails++;
+    }
+    t0 = simNs;
+    if (!file.open(d, name) || file.firstCluster() != e.cluster) {
+      printf("FAIL: FatReader::open %s\n", name);
+      fails++;
+    }
+    us = (simNs - t0) / 1e3;
+    scanUs += us;
+    if (us > worstScanUs)
+      worstScanUs = us;
+  }
+
+  const char *invalid[] = {"NOPE.WAV", "DTMFX.WAV", "S999.WAV",
+                           "TOOLONGNAME.WAV", "A.B.C", ".WAV", ""};
+  for (uint8_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    missing.push_back(invalid[i]);
+  for (size_t i = 0; i < missing.size(); i++) {
+    strcpy(name, missing[i].c_str());
+    if (rootIndex.open(file, name) || sfxIndex.open(file, name) ||
+        rootIndex.lookup(name) >= 0) {
+      printf("FAIL: found %s\n", name);
+      fails++;
+    }
+  }
+
+  // an index of just the .WAV files
+  if (!wavIndex.begin(root, wavTable, 40, "wav") ||
+      wavIndex.fileCount() != 20) {
+    printf("FAIL: %u files in the WAV index\n", wavIndex.fileCount());
+    fails++;
+  }
+  strcpy(name, "dtmf7.wav");
+  char txt[] = "7.TXT";
+  if (!wavIndex.open(file, name) || wavIndex.open(file, txt)) {
+    puts("FAIL: WAV index");
+    fails++;
+  }
+  if (wavIndex.begin(root, wavTable, 40, "WAVE") ||
+      wavIndex.begin(root, wavTable, 10, "WAV")) {
+    puts("FAIL: begin accepted a bad extension or a small table");
+    fails++;
+  }
+  strcpy(name, "Sfx");
+  if (!rootIndex.open(file, name) || !file.isDir()) {
+    puts("FAIL: open SFX");
+    fails++;
+  }
+
+  size_t n = files.size();
+  printf("entry data %d multi %s: %zu files, %u + %u indexed, %u shared, "
+         "built in %.1f ms\n  open us average/worst: index %.0f/%.0f, "
+         "FatReader %.0f/%.0f\n",
+         FAT_INDEX_ENTRY_DATA, atoi(argv[3]) ? "on" : "off", n,
+         rootIndex.fileCount(), sfxIndex.fileCount(), shared, buildMs,
+         indexUs / n, worstIndexUs, scanUs / n, worstScanUs);
+  return fails != 0;
+}
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+
+# Makes the FAT16 disk images and wave files for the host tests.
+#
+# Usage: fatimage.py play <image> <wave>
+#        fatimage.py dir <image> <list>
+#        fatimage.py effects <coin> <button> <bed>
+#
+# play:    PLAY.WAV, ten seconds of 22050 Hz 16-bit mono in three fragments,
+#          and a copy of it in <wave> to compare with what the DAC was sent.
+# dir:     a root with 362 files and a fragmented subdirectory SFX with 300,
+#          among deleted and long name entries.  Two root names share a
+#          FatDirIndex hash.  <list> has a line "<dir> <name> <cluster>
+#          <size>" for each file, / for the root, and "missing <name>" for
+#          names not on the disk that share a hash with one that is.  Each
+#          file holds its name, repeated.
+# effects: no image, just wave files for the mixer test: an 8-bit 11025 Hz
+#          coin sound with a LIST chunk before its data, a loud 16-bit
+#          8000 Hz chirp and a 16-bit 22050 Hz tone to mix them over.
+
+import math
+import random
+import struct
+import sys
+
+SECTOR = 512
+CLUSTER_SECTORS = 4
+CLUSTER = SECTOR * CLUSTER_SECTORS
+CLUSTERS = 4200  # at least 4085 for FAT16
+ROOT_ENTRIES = 512
+ATTR_FILE = 0x20
+ATTR_DIR = 0x10
+
+
+class FatImage:
+    def __init__(self):
+        self.fat_sectors = ((CLUSTERS + 2) * 2 + SECTOR - 1) // SECTOR
+        self.root_start = 1 + 2 * self.fat_sectors
+        self.data_start = self.root_start + ROOT_ENTRIES * 32 // SECTOR
+        total = self.data_start + CLUSTERS * CLUSTER_SECTORS
+        self.img = bytearray(total * SECTOR)
+        self.fat = [0] * (CLUSTERS + 2)
+        self.fat[0], self.fat[1] = 0xFFF8, 0xFFFF
+        self.next = 2
+        self.root = []
+        boot = bytearray(SECTOR)
+        boot[0:11] = b"\xEB\x3C\x90MSDOS5.0"
+        struct.pack_into("<HBHBHHBHHHII", boot, 11, SECTOR, CLUSTER_SECTORS,
+                         1, 2, ROOT_ENTRIES, 0, 0xF8, self.fat_sectors, 63,
+                         255, 0, total)
+        boot[510:512] = b"\x55\xAA"
+        self.img[0:SECTOR] = boot
+
+    def chain(self, runs):
+        # runs of (first cluster, count), linked in the order given
+        clusters = [c for first, n in runs for c in range(first, first + n)]
+        for a, b in zip(clusters, clusters[1:]):
+            self.fat[a] = b
+        self.fat[clusters[-1]] = 0xFFFF
+        self.next = max(self.next, max(clusters) + 1)
+        return clusters
+
+    def alloc(self, size, gap=0):
+        # contiguous clusters after the last used, gap clusters on
+        n = max(1, (size + CLUSTER - 1) // CLUSTER)
+        first = self.next + gap
+        return [(first, n)]
+
+    def write(self, clusters, data):
+        for k, c in enumerate(clusters):
+            off = (self.data_start + (c - 2) * CLUSTER_SECTORS) * SECTOR
+            chunk = data[k * CLUSTER:(k + 1) * CLUSTER]
+            self.img[off:off + len(chunk)] = chunk
+
+    def add(self, entries, name, data, runs=None, attr=ATTR_FILE):
+        runs = runs or self.alloc(len(data))
+        clusters = self.chain(runs)
+        self.write(clusters, data)
+        size = 0 if attr == ATTR_DIR else len(data)
+        entries.append(entry(name, clusters[0], size, attr))
+        return clusters[0]
+
+    def save(self, path):
+        for f in range(2):
+            base = (1 + f * self.fat_sectors) * SECTOR
+            for i, v in enumerate(self.fat):
+                struct.pack_into("<H", self.img, base + 2 * i, v)
+        assert len(self.root) <= ROOT_ENTRIES
+        root = b"".join(self.root)
+        start = self.root_start * SECTOR
+        self.img[start:start + len(root)] = root
+        open(path, "wb").write(self.img)
+
+
+def name11(name):
+    if name in (".", ".."):
+        return name.ljust(11).encode()
+    base, _, ext = name.partition(".")
+    return (base.ljust(8) + ext.ljust(3)).encode()
+
+
+def entry(name, cluster, size, attr=ATTR_FILE):
+    return (name11(name) + bytes([attr]) + bytes(8) +
+            struct.pack("<HHHHI", cluster >> 16, 0, 0, cluster & 0xFFFF,
+                        size))
+
+
+def hash_name(name):
+    # FatDirIndex::hashName()
+    h = 0x9DC5
+    for c in name11(name):
+        h = ((h ^ c) * 0x0193) & 0xFFFF
+    return h ^ (h >> 7)
+
+
+def directory(fat, names):
+    entries, files = [], []
+    for name in names:
+        if random.random() < 0.15:
+            entries.append(b"\xE5LDFILE TXT\x20" + bytes(20))  # deleted
+        if random.random() < 0.1:
+            entries.append(b"\x41" + bytes(10) + b"\x0F" + bytes(20))  # LFN
+        size = random.randint(1, 3000)
+        data = (name.encode() + b"|") * (size // (len(name) + 1) + 1)
+        cluster = fat.add(entries, name, data[:size])
+        files.append((name, cluster, size))
+    return entries, files
+
+
+def dirs(image, path):
+    random.seed(5)
+    fat = FatImage()
+    # the first two names that share a hash
+    seen, pair = {}, []
+    for i in range(100000):
+        name = "C%d.WAV" % i
+        h = hash_name(name)
+        if h in seen:
+            pair = [seen[h], name]
+            break
+        seen[h] = name
+    names = (["CONTIG.WAV", "TUNE.WAV"] + ["%d.TXT" % k for k in range(340)] +
+             ["DTMF%s.WAV" % c for c in "0123456789ABCDPS"] + pair)
+    fat.root, files = directory(fat, names)
+    sfx, sfx_files = directory(fat, ["S%03d.WAV" % k for k in range(300)])
+    data = (entry(".", 0, 0, ATTR_DIR) + entry("..", 0, 0, ATTR_DIR) +
+            b"".join(sfx) + bytes(32))
+    clusters = (len(data) + CLUSTER - 1) // CLUSTER
+    start = fat.next
+    runs = [(start + 3 * k, 1) for k in range(clusters)]
+    fat.chain(runs)
+    fat.write([c for c, n in runs], data)
+    fat.root.insert(5, entry("SFX", start, 0, ATTR_DIR))
+    fat.save(image)
+    # names not on the disk that share a hash with a file that is
+    on_disk = {hash_name(n): n for n in names}
+    missing = []
+    for i in range(100000):
+        name = "M%d.WAV" % i
+        if hash_name(name) in on_disk and len(missing) < 8:
+            missing.append(name)
+    with open(path, "w") as f:
+        for name, cluster, size in files:
+            f.write("/ %s %d %d\n" % (name, cluster, size))
+        for name, cluster, size in sfx_files:
+            f.write("SFX %s %d %d\n" % (name, cluster, size))
+        for name in missing:
+            f.write("missing %s\n" % name)
+
+
+def wave(rate, samples, bits=16, extra=b""):
+    if bits == 8:
+        data = bytes(samples)
+    else:
+        data = struct.pack("<%dh" % len(samples), *samples)
+    fmt = struct.pack("<HHIIHH", 1, 1, rate, rate * bits // 8, bits // 8, bits)
+    body = (b"WAVEfmt " + struct.pack("<I", 16) + fmt + extra + b"data" +
+            struct.pack("<I", len(data)) + data)
+    if len(data) & 1:
+        body += b"\0"
+    return b"RIFF" + struct.pack("<I", len(body)) + body
+
+
+def play(image, path):
+    # every sample different from the last so a dropped or repeated one shows
+    samples = [((i * 31 + (i >> 8) * 7) & 0xFFFF) - 0x8000
+               for i in range(220500)]
+    data = wave(22050, samples)
+    fat = FatImage()
+    fat.add(fat.root, "PLAY.WAV", data, [(500, 80), (1500, 80), (1000, 56)])
+    fat.save(image)
+    open(path, "wb").write(data)
+
+
+def effects(coin, button, bed):
+    # two notes with a decay
+    c = [int(round(128 + 100 * math.sin(2 * math.pi * (988 if i < 900 else 1319)
+                                        * i / 11025) * math.exp(-i / 2000)))
+         for i in range(3000)]
+    open(coin, "wb").write(wave(11025, c, 8, b"LIST" + struct.pack("<I", 5) +
+                                b"abcde\0"))
+    b = [int(30000 * math.sin(2 * math.pi * (300 + i * 0.5) * i / 8000))
+         for i in range(4000)]
+    open(button, "wb").write(wave(8000, b))
+    random.seed(2)
+    m = [int(12000 * math.sin(2 * math.pi * 220 * i / 22050) +
+             random.randint(-500, 500)) for i in range(22050)]
+    open(bed, "wb").write(wave(22050, m))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 4 and sys.argv[1] == "play":
+        play(sys.argv[2], sys.argv[3])
+    elif len(sys.argv) == 4 and sys.argv[1] == "dir":
+        dirs(sys.argv[2], sys.argv[3])
+    elif len(sys.argv) == 5 and sys.argv[1] == "effects":
+        effects(sys.argv[2], sys.argv[3], sys.argv[4])
+    else:
+        sys.exit("usage: fatimage.py play <image> <wave>\n"
+                 "       fatimage.py dir <image> <list>\n"
+                 "       fatimage.py effects <coin> <button> <bed>")
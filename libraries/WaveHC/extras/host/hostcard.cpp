@@ -0,0 +1,148 @@
+// Emulated SPI mode SDHC card, see hostcard.h
+#include <Arduino.h>
+#include <WavePinDefs.h>
+#include <avr/pgmspace.h>
+#include <deque>
+#include <stdlib.h>
+#include "hostcard.h"
+
+HostSerial Serial;
+SpdrReg SPDR;
+uint8_t SPSR = 1 << SPIF, SPCR;
+
+std::vector<uint8_t> cardImage;
+CardStats cardStats;
+unsigned long long simNs;
+unsigned nsPerByte = 1200;
+void (*spiHook)(void);
+unsigned (*latencyFn)(bool first);
+
+unsigned long millis(void) { return simNs / 1000000; }
+unsigned long micros(void) { return simNs / 1000; }
+void pinMode(uint8_t, uint8_t) {}
+
+// WaveUtil.cpp uses the AVR heap, so these are here instead
+void SerialPrint_P(PGM_P str) { fputs(str, stdout); }
+void SerialPrintln_P(PGM_P str) { puts(str); }
+
+static bool selected;         // chip select is low
+static std::deque<int> miso;  // bytes the card will send
+static uint8_t cmd[6];        // command being received
+static uint8_t cmdLen;        // bytes of it so far
+static bool streaming;        // a CMD18 read is running
+static uint32_t streamBlock;  // block it sent last
+//------------------------------------------------------------------------------
+bool cardLoad(const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  cardImage.clear();
+  for (int c; (c = fgetc(f)) >= 0;)
+    cardImage.push_back(c);
+  fclose(f);
+  return true;
+}
+//------------------------------------------------------------------------------
+static void queueBlock(uint32_t block, bool first) {
+  unsigned busy = latencyFn ? latencyFn(first) : first ? 300 : 8;
+  for (unsigned i = 0; i < busy; i++)
+    miso.push_back(0XFF);
+  miso.push_back(0XFE); // data token
+  for (uint32_t i = 0; i < 512; i++) {
+    uint32_t k = block * 512 + i;
+    miso.push_back(k < cardImage.size() ? cardImage[k] : 0);
+  }
+  miso.push_back(0X12); // CRC, not checked
+  miso.push_back(0X34);
+  cardStats.dataBlocks++;
+}
+//------------------------------------------------------------------------------
+static void command(void) {
+  uint8_t index = cmd[0] & 0X3F;
+  uint32_t arg = (uint32_t)cmd[1] << 24 | (uint32_t)cmd[2] << 16 |
+                 (uint32_t)cmd[3] << 8 | cmd[4];
+  if (index == 12) {
+    cardStats.cmd12++;
+    streaming = false;
+    miso.clear();
+    miso.push_back(0X3F); // stuff byte
+    miso.push_back(0X00); // R1
+    miso.push_back(0X00); // busy
+    return;
+  }
+  if (streaming) {
+    printf("card: CMD%d during CMD18\n", index);
+    exit(1);
+  }
+  miso.clear();
+  switch (index) {
+  case 0:  // GO_IDLE_STATE
+  case 55: // APP_CMD
+    miso.push_back(0X01);
+    break;
+  case 8: // SEND_IF_COND, voltage accepted
+    for (int b : {0X01, 0X00, 0X00, 0X01, 0XAA})
+      miso.push_back(b);
+    break;
+  case 41: // SD_SEND_OP_COND, ready
+    miso.push_back(0X00);
+    break;
+  case 58: // READ_OCR, powered up and high capacity
+    for (int b : {0X00, 0XC0, 0XFF, 0X80, 0X00})
+      miso.push_back(b);
+    break;
+  case 17:
+    cardStats.cmd17++;
+    miso.push_back(0X00);
+    queueBlock(arg, true);
+    break;
+  case 18:
+    cardStats.cmd18++;
+    miso.push_back(0X00);
+    streaming = true;
+    streamBlock = arg;
+    queueBlock(arg, true);
+    break;
+  default: // illegal command
+    miso.push_back(0X04);
+  }
+}
+//------------------------------------------------------------------------------
+SpdrReg &SpdrReg::operator=(uint8_t b) {
+  cardStats.bytes++;
+  simNs += nsPerByte;
+  if (spiHook)
+    spiHook();
+  rx = 0XFF;
+  if (!selected)
+    return *this;
+  if (!miso.empty()) {
+    rx = miso.front();
+    miso.pop_front();
+  }
+  if (streaming && miso.empty())
+    queueBlock(++streamBlock, false);
+  if (cmdLen == 0 && (b & 0XC0) == 0X40) {
+    cmd[cmdLen++] = b;
+  } else if (cmdLen) {
+    cmd[cmdLen++] = b;
+    if (cmdLen == 6) {
+      cmdLen = 0;
+      command();
+    }
+  }
+  return *this;
+}
+//------------------------------------------------------------------------------
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin != SS)
+    return;
+  selected = !value;
+  if (selected)
+    return;
+  if (streaming) {
+    printf("card: deselected during CMD18\n");
+    exit(1);
+  }
+  miso.clear();
+}
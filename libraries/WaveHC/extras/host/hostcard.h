@@ -0,0 +1,33 @@
+// Emulated SPI mode SDHC card over a disk image, with a simulated clock that
+// advances as bytes cross the SPI bus.
+#ifndef hostcard_h
+#define hostcard_h
+#include <stdint.h>
+#include <vector>
+
+/** Counts of what the card has been asked to do */
+struct CardStats {
+  unsigned long bytes;      ///< SPI bytes transferred
+  unsigned long cmd17;      ///< single block reads
+  unsigned long cmd18;      ///< multiple block reads started
+  unsigned long cmd12;      ///< multiple block reads stopped
+  unsigned long dataBlocks; ///< data blocks sent
+};
+
+extern std::vector<uint8_t> cardImage;
+extern CardStats cardStats;
+/** simulated time in nanoseconds */
+extern unsigned long long simNs;
+/** SPI byte time in nanoseconds, 8 MHz SPI plus the AVR's overhead */
+extern unsigned nsPerByte;
+/** called on every SPI byte, so interrupts can be serviced during reads */
+extern void (*spiHook)(void);
+/**
+ * Returns how many busy bytes the card sends before a data block, to model
+ * slow blocks.  \a first is true for the first block of a read command.
+ * If NULL, 300 bytes before the first block and 8 between blocks.
+ */
+extern unsigned (*latencyFn)(bool first);
+
+bool cardLoad(const char *path);
+#endif // hostcard_h
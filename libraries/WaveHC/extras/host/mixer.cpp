@@ -0,0 +1,147 @@
+// Tests WaveMixer against wave file fixtures made by fatimage.py: parses
+// them with playWav(), checks the mix against a floating point reference,
+// checks looping and setRate(), then times mix() for each number of voices.
+//
+// Usage: mixer <coin> <button> <bed>
+#include <WaveMixer.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+/** A voice as the reference sees it */
+struct Reference {
+  const uint8_t *data;
+  uint32_t length;
+  uint8_t bits;
+  uint16_t rate;
+  double gain;
+};
+//------------------------------------------------------------------------------
+static bool readFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  for (int c; (c = fgetc(f)) >= 0;)
+    data.push_back(c);
+  fclose(f);
+  return true;
+}
+//------------------------------------------------------------------------------
+static double sample(const Reference &r, uint32_t n) {
+  if (r.bits == 16)
+    return (int16_t)(r.data[2 * n] | r.data[2 * n + 1] << 8);
+  return (r.data[n] - 128) * 256.0;
+}
+//------------------------------------------------------------------------------
+// The voice linearly interpolated at output sample t, NAN once it has ended.
+// The position uses the mixer's 16.16 step so only the rounding differs.
+static double at(const Reference &r, uint32_t t, uint32_t outputRate) {
+  uint32_t step = (((uint32_t)r.rate << 16) + outputRate / 2) / outputRate;
+  double pos = (double)t * step / 65536;
+  uint32_t n = pos;
+  if (n >= r.length)
+    return NAN;
+  double f = pos - n;
+  uint32_t m = n + 1 < r.length ? n + 1 : n;
+  return (sample(r, n) * (1 - f) + sample(r, m) * f) * r.gain;
+}
+//------------------------------------------------------------------------------
+// Count the sign changes of a mix of silence
+static int crossings(WaveMixer &mixer, uint32_t samples) {
+  int n = 0;
+  int16_t last = mixer.mix(0);
+  for (uint32_t t = 1; t < samples; t++) {
+    int16_t s = mixer.mix(0);
+    n += (s > 0) != (last > 0);
+    last = s;
+  }
+  return n;
+}
+//------------------------------------------------------------------------------
+int main(int argc, char **argv) {
+  static WaveMixer mixer;
+  std::vector<uint8_t> coin, button, bed;
+  int fails = 0;
+
+  if (argc != 4 || !readFile(argv[1], coin) || !readFile(argv[2], button) ||
+      !readFile(argv[3], bed)) {
+    puts("usage: mixer <coin> <button> <bed>");
+    return 2;
+  }
+  mixer.begin(22050);
+  if (!mixer.playWav(0, coin.data(), 0, 255) ||
+      !mixer.playWav(1, button.data(), 0, 128)) {
+    puts("FAIL: playWav rejected a fixture");
+    fails++;
+  }
+  uint8_t junk[44] = {'R', 'I', 'F', 'F'};
+  if (mixer.playWav(2, junk) || mixer.activeVoices() != 2) {
+    puts("FAIL: playWav accepted a file with no WAVE header");
+    fails++;
+  }
+
+  // coin's data follows its 14 byte LIST chunk
+  Reference rc = {coin.data() + 58, 3000, 8, 11025, 1.0};
+  Reference rb = {button.data() + 44, 4000, 16, 8000, 128 / 256.0};
+  const uint8_t *bedData = bed.data() + 44;
+  uint32_t bedLength = (bed.size() - 44) / 2;
+  double maxError = 0;
+  for (uint32_t t = 0; t < bedLength; t++) {
+    int16_t in = bedData[2 * t] | bedData[2 * t + 1] << 8;
+    double ref = in, v;
+    if (!isnan(v = at(rc, t, 22050)))
+      ref += v;
+    if (!isnan(v = at(rb, t, 22050)))
+      ref += v;
+    ref = ref > 32767 ? 32767 : ref < -32768 ? -32768 : ref;
+    double e = fabs(mixer.mix(in) - ref);
+    if (e > maxError)
+      maxError = e;
+  }
+  printf("mix: max error %.1f, %.2f 12-bit DAC steps, %lu clipped samples\n",
+         maxError, maxError / 16, (unsigned long)mixer.clips);
+  // the phase fraction is cut to 8 bits, worth up to 128 on a loud voice
+  if (maxError > 200 || mixer.activeVoices()) {
+    puts("FAIL: mix differs from the reference or voices did not end");
+    fails++;
+  }
+
+  // a looped square wave in flash, 1 kHz then 500 Hz
+  static const uint8_t square[4] = {0XC0, 0XC0, 0X40, 0X40};
+  mixer.play(2, square, 4, 4 * 1000, VOICE_PROGMEM | VOICE_LOOP);
+  int n1 = crossings(mixer, 22050);
+  mixer.setRate(2, 4 * 500);
+  int n2 = crossings(mixer, 22050);
+  printf("loop: %d then %d crossings in a second\n", n1, n2);
+  if (abs(n1 - 2000) > 4 || abs(n2 - 1000) > 4) {
+    puts("FAIL: looped voice has the wrong frequency");
+    fails++;
+  }
+  mixer.stopAll();
+
+  // time per output sample for each number of voices
+  std::vector<uint8_t> noise(32768);
+  for (size_t i = 0; i < noise.size(); i++)
+    noise[i] = rand();
+  for (uint8_t resample = 0; resample < 2; resample++) {
+    for (uint8_t voices = 0; voices <= WAVE_MIXER_VOICES; voices++) {
+      for (uint8_t v = 0; v < voices; v++) {
+        mixer.play(v, noise.data(), 16384, resample ? 11025 : 22050,
+                   VOICE_LOOP | (v & 1 ? VOICE_16BIT : 0), 200);
+      }
+      volatile int16_t sink;
+      auto t0 = std::chrono::steady_clock::now();
+      for (uint32_t t = 0; t < 1000000; t++)
+        sink = mixer.mix(t);
+      (void)sink;
+      std::chrono::duration<double, std::nano> dt =
+          std::chrono::steady_clock::now() - t0;
+      printf("%u voices%s: %.1f ns per sample\n", voices,
+             resample ? " resampled" : "", dt.count() / 1000000);
+      mixer.stopAll();
+    }
+  }
+  return fails != 0;
+}
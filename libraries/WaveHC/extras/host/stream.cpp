@@ -0,0 +1,170 @@
+// Plays PLAY.WAV from a disk image through WaveHC with simulated timer
+// interrupts, checks every word sent to the DAC against the file and prints
+// the underrun and read time telemetry.
+//
+// Usage: stream <image> <wave> <multi> <stall %> <stall bytes> [mix]
+//
+// The DAC ISR runs every 1/22050 s of simulated time, which moves on as
+// bytes cross the emulated SPI bus, so it interrupts the refill ISR's reads
+// as it would on a 16 MHz AVR.  Each data block has a <stall %> chance of
+// <stall bytes> busy bytes before it, for cards that stop to do their own
+// housekeeping.  With no stalls no underrun is allowed.
+//
+// With mix, a WaveMixer plays a looped square wave over the file, and the
+// DAC words are checked against a second mixer fed the file directly.  The
+// voice must keep playing after the file ends.
+#include <Arduino.h>
+#include <WaveHC.h>
+#include <avr/interrupt.h>
+#include <stdlib.h>
+#include <vector>
+#include "hostcard.h"
+
+volatile uint8_t hostSREG_I = 1;
+uint8_t TIMSK1, TCCR1A, TCCR1B, TCNT0;
+uint16_t OCR1A, OCR1B;
+uint8_t dacH, dacL;
+
+static std::vector<uint16_t> played; // words sent to the DAC
+void dacWord(uint8_t dh, uint8_t dl) { played.push_back(dh << 8 | dl); }
+
+static unsigned long long nextTick; // time the next DAC interrupt is due
+static unsigned long long period;   // between DAC interrupts
+static uint8_t depth;               // nested interrupts being serviced
+static const unsigned dacNs = 8000; // DAC ISR time on an AVR, roughly
+static double stallChance;
+static unsigned stallBytes;
+//------------------------------------------------------------------------------
+// Run the timer interrupts that are due while interrupts are enabled
+static void service(void) {
+  while (hostSREG_I && TIMSK1 && simNs >= nextTick && depth < 3) {
+    nextTick += period;
+    depth++;
+    if (TIMSK1 & _BV(OCIE1A)) {
+      hostSREG_I = 0;
+      simNs += dacNs;
+      TIMER1_COMPA_vect();
+      hostSREG_I = 1;
+    }
+    if (TIMSK1 & _BV(OCIE1B)) {
+      hostSREG_I = 0;
+      TIMER1_COMPB_vect();
+      hostSREG_I = 1;
+    }
+    depth--;
+  }
+}
+//------------------------------------------------------------------------------
+static unsigned latency(bool first) {
+  if (rand() < stallChance * RAND_MAX)
+    return stallBytes;
+  return first ? 300 : 8;
+}
+//------------------------------------------------------------------------------
+static bool readFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  for (int c; (c = fgetc(f)) >= 0;)
+    data.push_back(c);
+  fclose(f);
+  return true;
+}
+//------------------------------------------------------------------------------
+int main(int argc, char **argv) {
+  static SdReader card;
+  static FatVolume vol;
+  static FatReader root, file;
+  static WaveHC wave;
+  static WaveMixer mixer, refMixer;
+  static const uint8_t square[4] = {0XC0, 0XC0, 0X40, 0X40};
+  std::vector<uint8_t> ref;
+
+  if (argc != 6 && argc != 7) {
+    puts("usage: stream <image> <wave> <multi> <stall %> <stall bytes> [mix]");
+    return 2;
+  }
+  if (!cardLoad(argv[1]) || !readFile(argv[2], ref)) {
+    puts("can't read the image or wave file");
+    return 2;
+  }
+  stallChance = atof(argv[4]) / 100;
+  stallBytes = atoi(argv[5]);
+  bool mixing = argc == 7;
+
+  if (!card.init()) {
+    puts("card.init failed");
+    return 1;
+  }
+  card.partialBlockRead(PLAYBUFFLEN < 512);
+  card.multiBlockRead(atoi(argv[3]));
+  if (!vol.init(card) || !root.openRoot(vol) ||
+      !file.open(root, (char *)"PLAY.WAV") || !wave.create(file)) {
+    puts("can't open PLAY.WAV");
+    return 1;
+  }
+  srand(1);
+  latencyFn = latency;
+  if (mixing) {
+    // play() must set the mixer to the file's rate
+    mixer.begin(8000);
+    WaveHC::setMixer(&mixer);
+    mixer.play(0, square, 4, 4 * 700, VOICE_LOOP, 200);
+    refMixer.begin(22050);
+    refMixer.play(0, square, 4, 4 * 700, VOICE_LOOP, 200);
+  }
+  wave.play();
+  if (mixing && mixer.outputRate() != wave.dwSamplesPerSec) {
+    puts("FAIL: play() did not set the mixer's rate");
+    return 1;
+  }
+  period = 1000000000ULL / wave.dwSamplesPerSec;
+  nextTick = simNs + period;
+  spiHook = service;
+  while (wave.isplaying) {
+    simNs += 1000;
+    service();
+  }
+  spiHook = 0;
+
+  // the DAC must have been sent each sample once, in order
+  size_t samples = (ref.size() - 44) / 2, bad = 0;
+  for (size_t i = 0; i < samples && i < played.size(); i++) {
+    uint16_t w = (0X80 ^ ref[44 + 2 * i + 1]) << 8 | ref[44 + 2 * i];
+    if (mixing)
+      w = 0X8000 ^ (uint16_t)refMixer.mix(w ^ 0X8000);
+    if (played[i] != w)
+      bad++;
+  }
+  printf("%3u x %u multi %s%s stall %4.1f%% %5u: underruns %3u minAhead %u "
+         "reads %5lu avg %4lu us max %5lu us refill max %5lu us\n",
+         (unsigned)PLAYBUFFLEN, (unsigned)PLAYBUFFCOUNT,
+         atoi(argv[3]) ? "on " : "off", mixing ? " mix" : "", stallChance * 100, stallBytes,
+         wave.underruns, wave.minBuffersAhead, (unsigned long)wave.readCount,
+         (unsigned long)(wave.readMicros / (wave.readCount ? wave.readCount : 1)),
+         (unsigned long)wave.maxReadMicros,
+         (unsigned long)wave.maxRefillMicros);
+  // with a mixer the DAC ISR that stopped the player still sent a word
+  if (bad || played.size() != samples + mixing) {
+    printf("FAIL: %zu of %zu samples played, %zu wrong\n", played.size(),
+           samples, bad);
+    return 1;
+  }
+  if (!stallChance && wave.underruns) {
+    puts("FAIL: underruns with no stalls");
+    return 1;
+  }
+  if (mixing) {
+    // run the DAC ISR for a while longer
+    size_t end = played.size();
+    for (uint16_t i = 0; i < 1000; i++) {
+      simNs += period;
+      service();
+    }
+    if (played.size() - end < 990) {
+      puts("FAIL: the mixer stopped with the file");
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,42 @@
+// Just enough of the Arduino core to build WaveHC on a PC.  The AVR SPI
+// registers are wired to the emulated SD card in hostcard.cpp.
+#ifndef Arduino_h
+#define Arduino_h
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#define PROGMEM
+#define PSTR(s) (s)
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define DEC 10
+#define HEX 16
+unsigned long millis(void);
+unsigned long micros(void);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+struct HostSerial {
+  void write(uint8_t c) { putchar(c); }
+  void print(const char *s) { fputs(s, stdout); }
+  void print(unsigned long v, int = DEC) { printf("%lu", v); }
+  void println(const char *s = "") { puts(s); }
+  void println(unsigned long v, int = DEC) { printf("%lu\n", v); }
+};
+extern HostSerial Serial;
+struct SpdrReg {
+  uint8_t rx;
+  SpdrReg &operator=(uint8_t b); // a byte goes out, one comes back
+  operator uint8_t() const { return rx; }
+};
+extern SpdrReg SPDR;
+extern uint8_t SPSR, SPCR;
+#define SPIF 7
+#define SPE 6
+#define MSTR 4
+#define SPR1 1
+#define SPR0 0
+#define SPI2X 0
+#endif // Arduino_h
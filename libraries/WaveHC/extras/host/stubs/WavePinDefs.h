@@ -0,0 +1,5 @@
+// SD card chip select and SPI pins for the emulated card
+#define SS 10
+#define MOSI 11
+#define MISO_PIN 12
+#define SCK 13
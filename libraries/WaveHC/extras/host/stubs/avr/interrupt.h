@@ -0,0 +1,21 @@
+// Timer 1 and the interrupt enable bit, serviced by the test drivers
+#ifndef avr_interrupt_h
+#define avr_interrupt_h
+#include <stdint.h>
+extern volatile uint8_t hostSREG_I;
+#define sei() (hostSREG_I = 1)
+#define cli() (hostSREG_I = 0)
+#define ISR(vector) void vector(void)
+void TIMER1_COMPA_vect(void);
+void TIMER1_COMPB_vect(void);
+extern uint8_t TIMSK1, TCCR1A, TCCR1B, TCNT0;
+extern uint16_t OCR1A, OCR1B;
+#define OCIE1A 1
+#define OCIE1B 2
+#define WGM12 3
+#define CS10 0
+#define _BV(b) (1 << (b))
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif // F_CPU
+#endif // avr_interrupt_h
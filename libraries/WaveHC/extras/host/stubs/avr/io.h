@@ -0,0 +1 @@
+#include <avr/interrupt.h>
@@ -0,0 +1,2 @@
+#define PGM_P const char *
+#define PSTR(s) (s)
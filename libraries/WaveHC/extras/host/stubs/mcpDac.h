@@ -0,0 +1,11 @@
+// Collect each word the DAC ISR sends instead of bit banging it out
+#include <stdint.h>
+void dacWord(uint8_t dh, uint8_t dl);
+extern uint8_t dacH, dacL;
+#define mcpDacInit()
+#define mcpDacCsLow()
+#define mcpDacSdiLow()
+#define mcpDacSdiHigh()
+#define mcpDacSckPulse()
+#define mcpDacSendBit(reg, bit) (&(reg) == &dh ? dacH = (reg) : dacL = (reg))
+#define mcpDacCsHigh() dacWord(dacH, dacL)